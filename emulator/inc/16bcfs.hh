@@ -10,12 +10,6 @@
 //===================================================================================================================
 
 
-//
-// -- conditionally compile the emulator for a pedantic copy of the EEPROM into SRAM
-//    ------------------------------------------------------------------------------
-#define PEDANTIC_COPY 0
-
-
 //
 // -- want to use this macro to set the number of pins properly
 //    ---------------------------------------------------------
@@ -32,7 +26,17 @@
 //
 // -- c/c++ standard include files here
 //    ---------------------------------
-typedef enum {
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+
+//
+// -- the state of a single net; a byte is plenty, and keeps the `pins` array of each IC small
+//    ----------------------------------------------------------------------------------------
+typedef enum : int8_t {
     LOW = 0,
     GND = 0,
     HIGH = 1,
@@ -47,6 +51,12 @@ typedef enum {
 extern bool debug;
 
 
+//
+// -- when set, the emulator runs without building any of the GUI (batch runs)
+//    ------------------------------------------------------------------------
+extern bool headless;
+
+
 //
 // -- A helper macro for debugging
 //    ----------------------------
@@ -57,12 +67,25 @@ extern bool debug;
 // -- Qt6 include files here
 //    ----------------------
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QFileSystemWatcher>
+#include <QtCore/QHash>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
 #include <QtCore/QObject>
 #include <QtCore/QList>
 #include <QtCore/QMap>
+#include <QtCore/QPointer>
+#include <QtCore/QSemaphore>
+#include <QtCore/QDateTime>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QThread>
 #include <QtCore/QTimer>
 #include <QtCore/QTime>
 #include <QtCore/QSettings>
+#include <QtGui/QDoubleValidator>
+#include <QtGui/QPainter>
 #include <QtGui/QPalette>
 #include <QtGui/QPicture>
 #include <QtGui/QPixmap>
@@ -73,6 +96,7 @@ extern bool debug;
 #include <QtWidgets/QDialog>
 #include <QtWidgets/QFileDialog>
 #include <QtWidgets/QGridLayout>
+#include <QtWidgets/QInputDialog>
 #include <QtWidgets/QGroupBox>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QLineEdit>
@@ -119,23 +143,35 @@ class IC_at28c256_t;
 
 class HW_Alu_t;
 class HW_AluAdder_t;
+class HW_Bench_t;
 class HW_Bus_1_t;
 class HW_Bus_8_t;
 class HW_Bus_16_t;
 class HW_BusDriver_t;
 class HW_Computer_t;
+class HW_History_t;
+class HW_IsaEngine_t;
 class HW_MomentarySwitch_t;
+class HW_Netlist_t;
 class HW_Oscillator_t;
 class HW_Pot_t;
+class HW_Profile_t;
+class HW_RomImage_t;
+class HW_Scheduler_t;
+class HW_SimThread_t;
+class HW_Snapshot_t;
 class HW_SpdtSwitch_t;
+class HW_Trace_t;
 class HW_PushButton_t;
 
 class GUI_Application_t;
 class GUI_BusLeds_t;
 class GUI_BusTester_t;
 class GUI_DipSwitch_t;
+class GUI_Frame_t;
 class GUI_MomentarySwitch_t;
 class GUI_Led_t;
+class GUI_LedBank_t;
 class GUI_SettingsDialog_t;
 
 class SubDemux3_t;
@@ -161,11 +197,26 @@ class CtrlRomModule_t;
 extern GUI_Application_t *app;
 const QString key = "control-rom/folder";   // -- I expect the linker to handle the duplicate constants here
 const QString lastPgm = "pgm-rom/last-pgm";
+const QString fastBootKey = "control-rom/fast-boot";
+const QString historyIntervalKey = "history/interval";
+const QString historyBudgetKey = "history/budget-mb";
+const QString profileKey = "profile/json";
+const QString frameRateKey = "gui/frame-rate";
+const QString cpuTargetKey = "clock/target-hz";
 
 
 //
 // -- project speific include files here
 //    ----------------------------------
+#include "hw/hw-logic.hh"                   // -- the buses resolve their drivers as packed words
+#include "hw/hw-snapshot.hh"                // -- the components name their state to a snapshot stream
+#include "hw/hw-bus-drivers.hh"             // -- the buses keep their drivers by slot
+#include "hw/hw-profile.hh"                 // -- the ICs count their input updates
+#include "hw/hw-netlist.hh"                 // -- the ICs need to see the netlist kernel to be scheduled by it
+#include "hw/hw-scheduler.hh"               // -- the ICs and oscillators need to see the scheduler's time type
+#include "hw/hw-sim-thread.hh"              // -- the input widgets post to the simulation thread
+
+#include "ic/ic-quad-gate.hh"
 #include "ic/ic-74xx00.hh"
 #include "ic/ic-74xx02.hh"
 #include "ic/ic-74xx03.hh"
@@ -209,21 +260,28 @@ const QString lastPgm = "pgm-rom/last-pgm";
 
 #include "hw/hw-alu.hh"
 #include "hw/hw-alu-adder.hh"
+#include "hw/hw-bench.hh"
 #include "hw/hw-bus-1.hh"
 #include "hw/hw-bus-8.hh"
 #include "hw/hw-bus-16.hh"
 #include "hw/hw-bus-driver.hh"
 #include "hw/hw-computer.hh"
+#include "hw/hw-history.hh"
+#include "hw/hw-isa-engine.hh"
 #include "hw/hw-momentary-switch.hh"
 #include "hw/hw-oscillator.hh"
 #include "hw/hw-pot.hh"
+#include "hw/hw-rom-image.hh"
 #include "hw/hw-spdt-switch.hh"
+#include "hw/hw-trace.hh"
 
 #include "gui/gui-application.hh"
 #include "gui/gui-bus-leds.hh"
 #include "gui/gui-bus-tester.hh"
 #include "gui/gui-dip-switch.hh"
+#include "gui/gui-frame.hh"
 #include "gui/gui-led.hh"
+#include "gui/gui-led-bank.hh"
 #include "gui/gui-settings-dialog.hh"
 #include "gui/gui-momentary-switch.hh"
 
@@ -21,26 +21,16 @@ class GUI_BusLeds_t : public QGroupBox {
 
 
 private:
-    GUI_Led_t *ledF;
-    GUI_Led_t *ledE;
-    GUI_Led_t *ledD;
-    GUI_Led_t *ledC;
-    GUI_Led_t *ledB;
-    GUI_Led_t *ledA;
-    GUI_Led_t *led9;
-    GUI_Led_t *led8;
-    GUI_Led_t *led7;
-    GUI_Led_t *led6;
-    GUI_Led_t *led5;
-    GUI_Led_t *led4;
-    GUI_Led_t *led3;
-    GUI_Led_t *led2;
-    GUI_Led_t *led1;
-    GUI_Led_t *led0;
+    GUI_LedBank_t *leds;
+    int slot;                               // where the bus is in the published state
 
 
 public:
     GUI_BusLeds_t(QString name, HW_Bus_16_t *bus, QWidget *parent = nullptr);
     ~GUI_BusLeds_t() {}
+
+
+private slots:
+    void ProcessFrame(void);
 };
 
@@ -48,7 +48,10 @@ public:
 
 
 public slots:
-    void ProcessOEChange(int val) { if (val == Qt::Unchecked) emit SignalOeUpdated(HIGH); else emit SignalOeUpdated(LOW); }
+    void ProcessOEChange(int val) {
+        TriState_t oe = (val == Qt::Unchecked) ? HIGH : LOW;
+        HW_SimThread_t::Get()->Post([this, oe](void) { emit SignalOeUpdated(oe); });
+    }
 
 
 signals:
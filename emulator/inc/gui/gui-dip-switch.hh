@@ -28,7 +28,7 @@ public:
 
 public slots:
     void ProcessClick(void) { setSliderPosition(value()==1?0:1); }
-    void ProcessStateChange(void) { emit SignalSwitchChanged(value()==1?HIGH:LOW); }
+    void ProcessStateChange(void) { Apply(value()); }
 
 
 
@@ -38,7 +38,32 @@ signals:
 
 
 public:
-    void TriggerFirstUpdate(void) { ProcessStateChange(); }
+    void TriggerFirstUpdate(void) { Apply(pos); }
+    void ReplayInput(int v) { Apply(v); Show(v); }
+
+    // -- the position is put back quietly; whatever it drives has its own state restored
+    void Snapshot(HW_Snapshot_t::Stream_t &s) {
+        s & pos;
+        if (s.IsRestoring()) Show(pos);
+    }
+
+
+private:
+    int pos;                                // the position as the simulation sees it
+
+    // -- the switch is moved on the GUI thread, but the input is logged and changed on the simulation thread
+    void Apply(int v) {
+        HW_SimThread_t::Get()->Post([this, v](void) {
+            pos = v;
+            HW_History_t::Get()->LogInput(this, v);
+            emit SignalSwitchChanged(v==1?HIGH:LOW);
+        });
+    }
+
+    // -- move the switch on the GUI thread to where the simulation put it
+    void Show(int v) {
+        HW_SimThread_t::Get()->PostGui(this, [this, v](void) { QSignalBlocker block(this); setValue(v); });
+    }
 };
 
 
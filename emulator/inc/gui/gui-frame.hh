@@ -0,0 +1,66 @@
+//===================================================================================================================
+//  gui-frame.hh -- Paces the repainting of the GUI, independent of how fast the simulation runs
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  The simulation only records the latest state of what is displayed (an LED keeps the state it was last given,
+//  a bus display reads the bus when it is asked to).  At a fixed rate a frame is signalled, and each display then
+//  compares that state against what it showed in the last frame and repaints only what is different.  A bit that
+//  toggles a thousand times between frames costs the simulation nothing beyond recording the state.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- The frame pacer
+//    ---------------
+class GUI_Frame_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    enum {
+        DEFAULT_RATE = 30,                  // frames per second
+        MIN_RATE = 1,
+        MAX_RATE = 120,
+    };
+
+
+private:
+    // -- singleton instance
+    static GUI_Frame_t *singleton;
+
+
+private:
+    QTimer *timer;
+
+
+private:
+    explicit GUI_Frame_t(void);
+    virtual ~GUI_Frame_t() {}
+
+    GUI_Frame_t(const GUI_Frame_t &) = delete;
+    GUI_Frame_t &operator=(const GUI_Frame_t &) = delete;
+
+
+public:
+    static GUI_Frame_t *Get(void);
+
+    // -- start signalling frames `rate` times a second
+    void Start(int rate);
+    void Stop(void) { timer->stop(); }
+
+
+signals:
+    void SignalFrame(void);
+};
+
+
@@ -0,0 +1,99 @@
+//===================================================================================================================
+//  gui-led-bank.hh -- A row of LEDs showing the bits of one value, painted as a single widget
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  A bus or a register needs 8 or 16 LEDs.  Rather than a `GUI_Led_t` (a QLabel with its own palette) for each
+//  bit, plus the layout and spacers to line them up, the bank keeps the value and the undriven bits together in
+//  one atomic word (so the GUI thread reads them whole) and paints every LED in one `paintEvent`.  The bits are
+//  set as they change, either one at a time or a byte at a time, and the bank is repainted at the next frame
+//  only when the value is different from the one it last painted.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- A bank of up to 16 LEDs, bit 0 on the right
+//    -------------------------------------------
+class GUI_LedBank_t : public QWidget {
+    Q_OBJECT
+
+
+public:
+    enum {
+        LED_WIDTH = 5,                      // the same size as a `GUI_Led_t`
+        LED_HEIGHT = 8,
+        LED_SPACING = 1,
+        GROUP_GAP = 4,                      // the extra space between groups of bits
+    };
+
+
+private:
+    int bits;
+    int group;                              // bits in each group, counted from bit 0
+    bool numbered;                          // label each LED with its bit number
+    QColor onColor;
+
+    // -- the latest value (low 16 bits) and undriven bits (high 16), kept as the simulation thread changes them
+    std::atomic<uint32_t> latest;
+    uint16_t shownValue;                    // the value last painted
+    uint16_t shownZMask;
+
+
+public:
+    explicit GUI_LedBank_t(int bits, Qt::GlobalColor on = Qt::green, int group = 4, bool numbered = false,
+            QWidget *parent = nullptr);
+    virtual ~GUI_LedBank_t() {}
+
+
+public:
+    virtual QSize sizeHint(void) const override;
+    virtual QSize minimumSizeHint(void) const override { return sizeHint(); }
+
+    uint16_t GetValue(void) const { return latest.load(std::memory_order_relaxed) & 0xffff; }
+    void SetValue(uint16_t val, uint16_t z = 0) { latest.store(val | ((uint32_t)z << 16), std::memory_order_relaxed); }
+
+
+protected:
+    virtual void paintEvent(QPaintEvent *event) override;
+
+
+private:
+    int CellWidth(void) const;
+    void SetBit(int bit, TriState_t state);
+    void SetByte(int shift, uint8_t val, uint8_t drive);
+
+
+public slots:
+    void ProcessFrame(void);
+
+    void ProcessUpdateLsb(uint8_t val, uint8_t drive) { SetByte(0, val, drive); }
+    void ProcessUpdateMsb(uint8_t val, uint8_t drive) { SetByte(8, val, drive); }
+
+    void ProcessUpdateBit0(TriState_t state) { SetBit(0, state); }
+    void ProcessUpdateBit1(TriState_t state) { SetBit(1, state); }
+    void ProcessUpdateBit2(TriState_t state) { SetBit(2, state); }
+    void ProcessUpdateBit3(TriState_t state) { SetBit(3, state); }
+    void ProcessUpdateBit4(TriState_t state) { SetBit(4, state); }
+    void ProcessUpdateBit5(TriState_t state) { SetBit(5, state); }
+    void ProcessUpdateBit6(TriState_t state) { SetBit(6, state); }
+    void ProcessUpdateBit7(TriState_t state) { SetBit(7, state); }
+    void ProcessUpdateBit8(TriState_t state) { SetBit(8, state); }
+    void ProcessUpdateBit9(TriState_t state) { SetBit(9, state); }
+    void ProcessUpdateBitA(TriState_t state) { SetBit(10, state); }
+    void ProcessUpdateBitB(TriState_t state) { SetBit(11, state); }
+    void ProcessUpdateBitC(TriState_t state) { SetBit(12, state); }
+    void ProcessUpdateBitD(TriState_t state) { SetBit(13, state); }
+    void ProcessUpdateBitE(TriState_t state) { SetBit(14, state); }
+    void ProcessUpdateBitF(TriState_t state) { SetBit(15, state); }
+};
+
+
@@ -36,10 +36,14 @@ public:
 
 
 public slots:
-    void ProcessStateChange(TriState_t state) { setPalette(!(state^onWhen)?onColor:offColor); }
+    // -- only the state is kept (from the simulation thread); the LED is repainted at the next frame if it changed
+    void ProcessStateChange(TriState_t s) { state.store(s, std::memory_order_relaxed); }
+    void ProcessFrame(void);
 
 private:
     QPalette onColor;
     static QPalette offColor;
     LedWiring_t onWhen;
+    std::atomic<TriState_t> state;
+    bool lit;
 };
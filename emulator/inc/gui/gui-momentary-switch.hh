@@ -31,10 +31,24 @@ public:
     GUI_MomentarySwitch_t(const QString &name, TriState_t p = HIGH, TriState_t r = LOW, QWidget *parent = nullptr);
     ~GUI_MomentarySwitch_t() {}
 
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & current; }
+    void ReplayInput(int v) { if (v) ProcessClick(); else ProcessRelease(); }
+
 
 public slots:
-    void ProcessClick(void) { current = whenPressed; emit SignalSwitchChanged(whenPressed); }
-    void ProcessRelease(void) { current = whenReleased; emit SignalSwitchChanged(whenReleased); }
+    void ProcessClick(void) { Apply(1, whenPressed); }
+    void ProcessRelease(void) { Apply(0, whenReleased); }
+
+
+private:
+    // -- the switch is clicked on the GUI thread, but the input is logged and changed on the simulation thread
+    void Apply(int v, TriState_t s) {
+        HW_SimThread_t::Get()->Post([this, v, s](void) {
+            HW_History_t::Get()->LogInput(this, v);
+            current = s;
+            emit SignalSwitchChanged(s);
+        });
+    }
 
 
 signals:
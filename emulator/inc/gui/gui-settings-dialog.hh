@@ -25,6 +25,8 @@ class GUI_SettingsDialog_t : public QDialog {
 private:
     QString ctrlDir;
     QLineEdit *dir;
+    QCheckBox *fastBoot;
+    QLineEdit *targetMhz;
 
 
 public:
@@ -28,6 +28,12 @@ private:
 
     HW_BusDriver_t *driver;
 
+    // -- the inputs and the carry chain are nets, levelized so each adder is evaluated once per change
+    HW_Netlist_t *netlist;
+    HW_Netlist_t::Net_t carryIn;
+    HW_Netlist_t::Net_t aNets[16];
+    HW_Netlist_t::Net_t bNets[16];
+
 
 public:
     HW_AluAdder_t(IC_74xx541_t *aluALsb, IC_74xx541_t *aluAMsb,
@@ -40,8 +46,18 @@ public:
     void TriggerFirstUpdate(void);
 
 
+private:
+    void UpdateByte(const HW_Netlist_t::Net_t *nets, uint8_t val);
+
+
 public slots:
-    void ProcessCarryInUpdate(TriState_t state) { bits0->ProcessCInUpdate(state); }
+    void ProcessCarryInUpdate(TriState_t state) { netlist->Drive(carryIn, state); }
+
+    // -- word-level inputs from the ALU A/B line drivers; any bit in high-Z is treated as low
+    void ProcessAluALsbUpdate(uint8_t y, uint8_t drive) { UpdateByte(&aNets[0], y & drive); }
+    void ProcessAluAMsbUpdate(uint8_t y, uint8_t drive) { UpdateByte(&aNets[8], y & drive); }
+    void ProcessAluBLsbUpdate(uint8_t y, uint8_t drive) { UpdateByte(&bNets[0], y & drive); }
+    void ProcessAluBMsbUpdate(uint8_t y, uint8_t drive) { UpdateByte(&bNets[8], y & drive); }
 
 
 signals:
@@ -43,6 +43,11 @@ public:
     HW_AluAdder_t *GetAluAdder(void) { return adder; }
 
 
+public slots:
+    void ProcessAluAUpdate(uint16_t val) { lsbA->ProcessUpdateDWord(val & 0xff); msbA->ProcessUpdateDWord(val >> 8); }
+    void ProcessAluBUpdate(uint16_t val) { lsbB->ProcessUpdateDWord(val & 0xff); msbB->ProcessUpdateDWord(val >> 8); }
+
+
 signals:
     void SignalAluResultBit0(TriState_t state);
     void SignalAluResultBit1(TriState_t state);
@@ -0,0 +1,80 @@
+//===================================================================================================================
+//  hw-bench.hh -- Benchmarks for the simulation hot paths and for the whole machine
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  The micro benchmarks time one update path in isolation, reported in ns per operation: a bit and a word
+//  driven onto a 16-bit bus, one input of each 74xx IC, SRAM reads and writes, and a full 16-bit add in the ALU
+//  adder.  Each is run several times and the fastest run is kept, since anything slower was only disturbed.
+//
+//  The macro benchmarks build the whole computer and step the scheduler directly (unpaced): the time from reset
+//  to the first instruction fetch, and CPU clock cycles per second running a fixed program.
+//
+//  Results are printed as a table and written as JSON, so runs can be compared from one release to the next.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- The benchmark runner
+//    --------------------
+class HW_Bench_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    enum {
+        MICRO_OPS = 1000000,                // operations in each timed run
+        MICRO_RUNS = 5,                     // timed runs; the fastest is kept
+        FORMAT_VERSION = 1,                 // bumped whenever the JSON changes shape
+    };
+
+    typedef struct Result_t {
+        QString name;
+        QString unit;
+        double value;
+        unsigned long ops;
+    } Result_t;
+
+
+private:
+    QList<Result_t> results;
+    QString filter;
+
+
+public:
+    explicit HW_Bench_t(const QString &only = QString()) : filter(only) {}
+    virtual ~HW_Bench_t() {}
+
+
+public:
+    void RunMicro(void);
+    bool RunMacro(unsigned long cycles, bool pedantic);
+
+    const QList<Result_t> &GetResults(void) const { return results; }
+    void Report(void) const;
+    QByteArray ToJson(void) const;
+
+
+private:
+    bool Wanted(const QString &name) const { return filter.isEmpty() || name.contains(filter); }
+    void Add(const QString &name, const QString &unit, double value, unsigned long ops);
+    void Time(const QString &name, std::function<void(unsigned long)> op, unsigned long ops = MICRO_OPS);
+    bool FirstFetch(const QString &name, bool fast);
+
+
+signals:
+    // -- a driver for the bus benchmarks, so the bus sees a real sender
+    void SignalBit(TriState_t state);
+    void SignalWord(uint16_t val, uint16_t drive);
+};
+
+
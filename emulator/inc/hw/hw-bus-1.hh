@@ -22,9 +22,12 @@ class HW_Bus_1_t : public QObject {
 
 
 private:
-    typedef QMap<QObject *, TriState_t> Asserts_t;
-    typedef QMap<int, Asserts_t *> Map_t;
-    Map_t *assertedBits;
+    // -- each driver is given a slot the first time it drives the bus
+    HW_BusDrivers_t drivers;
+
+    // -- the drivers (by slot) asserting the bit high or low
+    uint32_t assertHigh;
+    uint32_t assertLow;
 
 
 public:
@@ -32,6 +35,10 @@ public:
     virtual ~HW_Bus_1_t() {}
 
 
+public:
+    void Snapshot(HW_Snapshot_t::Stream_t &s);
+
+
 private:
     void MaintainBit(TriState_t state);
 
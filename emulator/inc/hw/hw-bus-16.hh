@@ -42,9 +42,29 @@ public:
 
 
 private:
-    typedef QMap<QObject *, TriState_t> Asserts_t;
-    typedef QMap<int, Asserts_t *> Map_t;
-    Map_t *assertedBits;
+    // -- each driver is given a slot the first time it drives the bus
+    HW_BusDrivers_t drivers;
+
+    // -- what each driver (by slot) is putting on the bus
+    HW_Logic16_t driven[HW_BusDrivers_t::MAX_DRIVERS];
+
+    // -- the resolved state of the bus as a word; a bit in `driveMask` is set when something is driving that bit
+    uint16_t value;
+    uint16_t driveMask;
+
+    // -- for each bit, how many drivers are putting it HIGH or LOW; these are kept up to date as each driver
+    //    changes, so resolving the bus never has to look at every driver
+    HW_Count16_t highCnt;
+    HW_Count16_t lowCnt;
+
+    // -- the bits with more than one driver at a proper level
+    uint16_t multiMask;
+
+    // -- the bits driven both ways at once (contended)
+    uint16_t contendedMask;
+
+    // -- the var this bus is recorded as while it is traced, -1 when it is not
+    int traceVar;
 
 
 public:
@@ -52,8 +72,25 @@ public:
     virtual ~HW_Bus_16_t() {}
 
 
+public:
+    void Snapshot(HW_Snapshot_t::Stream_t &s);
+
+
+public:
+    uint16_t GetValue(void) const { return value; }
+    uint16_t GetDriveMask(void) const { return driveMask; }
+    uint16_t GetZMask(void) const { return ~driveMask; }
+    uint16_t GetContendedMask(void) const { return contendedMask; }
+    void SetTraceVar(int var) { traceVar = var; }
+
+
 private:
+    void Recount(void);
+    void Change(int slot, HW_Logic16_t w);
+    void Resolve(int slot, uint16_t mask);
+    void EmitBit(int bit, TriState_t state);
     void MaintainBit(int bit, TriState_t state);
+    void MaintainWord(uint16_t val, uint16_t drive, uint16_t mask);
 
 
 public slots:
@@ -74,6 +111,11 @@ public slots:
     void ProcessUpdateBitE(TriState_t state) { MaintainBit(BIT_E, state); }
     void ProcessUpdateBitF(TriState_t state) { MaintainBit(BIT_F, state); }
 
+    // -- word-level inputs; a bit in `drive` is clear when the driver has that bit in high-Z
+    void ProcessUpdateWord(uint16_t val, uint16_t drive) { MaintainWord(val, drive, 0xffff); }
+    void ProcessUpdateLsb(uint8_t val, uint8_t drive) { MaintainWord(val, drive, 0x00ff); }
+    void ProcessUpdateMsb(uint8_t val, uint8_t drive) { MaintainWord(val << 8, drive << 8, 0xff00); }
+
     void ProcessSanityCheck(void);
 
 
@@ -94,6 +136,8 @@ signals:
     void SignalBitDUpdated(TriState_t state);
     void SignalBitEUpdated(TriState_t state);
     void SignalBitFUpdated(TriState_t state);
+
+    void SignalWordUpdated(uint16_t val);
 };
 
 
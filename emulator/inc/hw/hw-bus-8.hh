@@ -34,9 +34,12 @@ public:
 
 
 private:
-    typedef QMap<QObject *, TriState_t> Asserts_t;
-    typedef QMap<int, Asserts_t *> Map_t;
-    Map_t *assertedBits;
+    // -- each driver is given a slot the first time it drives the bus
+    HW_BusDrivers_t drivers;
+
+    // -- for each bit, the drivers (by slot) asserting it high or low
+    uint32_t assertHigh[BIT_7 + 1];
+    uint32_t assertLow[BIT_7 + 1];
 
 
 public:
@@ -44,6 +47,10 @@ public:
     virtual ~HW_Bus_8_t() {}
 
 
+public:
+    void Snapshot(HW_Snapshot_t::Stream_t &s);
+
+
 private:
     void MaintainBit(int bit, TriState_t state);
 
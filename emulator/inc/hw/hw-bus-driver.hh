@@ -54,6 +54,7 @@ public slots:
     void ProcessUpdateBitD(TriState_t state) { msb->ProcessUpdateD5(state); }
     void ProcessUpdateBitE(TriState_t state) { msb->ProcessUpdateD6(state); }
     void ProcessUpdateBitF(TriState_t state) { msb->ProcessUpdateD7(state); }
+    void ProcessUpdateWord(uint16_t val) { lsb->ProcessUpdateDWord(val & 0xff); msb->ProcessUpdateDWord(val >> 8); }
 };
 
 
@@ -0,0 +1,142 @@
+//===================================================================================================================
+//  hw-bus-drivers.hh -- The table of drivers on a bus, each given the slot the bus keeps its state in
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  A bus keeps what each of its drivers is asserting by slot (a bit in a mask, or an entry in a table), so each
+//  driver is given a slot the first time it drives the bus.  The set of drivers is fixed at wire-up, so the
+//  lookup nearly always finds the same driver as the last time.
+//
+//  A bus has room for `MAX_DRIVERS` drivers.  One more is a wiring error, and stops the emulator: sharing a slot
+//  would mix up the state of two drivers without a word.
+//
+//  Slots are handed out in the order the drivers first drive the bus, which need not be the same from one run
+//  to the next.  So a snapshot saves which driver had each slot, by its place in the snapshot registration
+//  order, and a restore puts the live drivers back into those slots before the bus restores its state by slot.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- The drivers of a bus, by slot
+//    -----------------------------
+class HW_BusDrivers_t {
+public:
+    enum { MAX_DRIVERS = 32 };
+
+
+private:
+    QObject *drivers[MAX_DRIVERS];
+    int count;
+    int last;
+
+
+public:
+    HW_BusDrivers_t(void) : count(0), last(-1) {}
+
+
+public:
+    int GetCount(void) const { return count; }
+
+
+    //
+    // -- Find the slot for a driver, giving it a new one the first time it is seen; -1 when there is no driver
+    //    -----------------------------------------------------------------------------------------------------
+    int Slot(QObject *obj, const QObject *bus) {
+        if (obj == nullptr) return -1;
+        if (likely(last >= 0 && drivers[last] == obj)) return last;
+
+        for (int i = 0; i < count; i ++) {
+            if (drivers[i] == obj) return (last = i);
+        }
+
+        if (unlikely(count == MAX_DRIVERS)) {
+            qFatal("Bus %s has more than %d drivers", qPrintable(bus->objectName()), (int)MAX_DRIVERS);
+        }
+
+        drivers[count] = obj;
+        return (last = count ++);
+    }
+
+
+    //
+    // -- Save or restore which driver has each slot; a saved driver which cannot be found fails the restore
+    //
+    //    A driver which is not registered for snapshots (saved as -1) cannot be named, so the saved ones are
+    //    matched in slot order with the live drivers which are not registered either.  Any live driver not in
+    //    the snapshot goes after the saved ones, into a slot which was not driving anything when it was taken.
+    //    ---------------------------------------------------------------------------------------------------
+    void Snapshot(HW_Snapshot_t::Stream_t &s) {
+        HW_Snapshot_t *snap = HW_Snapshot_t::Get();
+        int32_t live[MAX_DRIVERS];
+        int32_t saved[MAX_DRIVERS];
+        int32_t n = count;
+
+        // -- the pointers are only compared here, never de-referenced; a driver may have been deleted
+        for (int i = 0; i < count; i ++) live[i] = saved[i] = snap->IndexOf(drivers[i]);
+
+        s.Checked(n);
+
+        if (n < 0 || n > MAX_DRIVERS) {
+            s.Fail();
+            return;
+        }
+
+        for (int i = 0; i < n; i ++) s.Checked(saved[i]);
+
+        QObject *table[MAX_DRIVERS];
+        bool placed[MAX_DRIVERS] = { false };
+        int other = 0;                      // the next live driver to try for a saved one with no name
+        int k = 0;
+
+        for ( ; k < n; k ++) {
+            int j = -1;
+
+            if (saved[k] >= 0) {
+                for (int i = 0; i < count && j < 0; i ++) {
+                    if (live[i] == saved[k]) j = i;
+                }
+
+                table[k] = (j >= 0 ? drivers[j] : snap->GetComponent(saved[k]));
+            } else {
+                while (other < count && live[other] >= 0) other ++;
+                j = (other < count ? other ++ : -1);
+                table[k] = (j >= 0 ? drivers[j] : nullptr);
+            }
+
+            if (table[k] == nullptr) {
+                s.Fail();
+                return;
+            }
+
+            if (j >= 0) placed[j] = true;
+        }
+
+        for (int i = 0; i < count; i ++) {
+            if (placed[i]) continue;
+
+            if (k == MAX_DRIVERS) {
+                s.Fail();
+                return;
+            }
+
+            table[k ++] = drivers[i];
+        }
+
+        if (!s.IsRestoring()) return;
+
+        for (int i = 0; i < k; i ++) drivers[i] = table[i];
+        count = k;
+        last = -1;
+    }
+};
+
+
@@ -19,8 +19,19 @@
 class HW_Computer_t : public QMainWindow {
     Q_OBJECT
 
+public:
+    // -- how faithfully a module is to be emulated; read once per module at startup
+    typedef enum {
+        GATE_LEVEL,                     // every IC on the module is built and wired up
+        BEHAVIORAL,                     // the module is modeled as its registers and logic
+    } Fidelity_t;
+
+
 private:
     static QString pgmRomFolder;
+    static QString ctrlRomFolder;
+    static Fidelity_t defaultFidelity;
+    static std::atomic<bool> fastBoot;      // set from the settings dialog, read at a reset
 
 
 private:
@@ -33,6 +44,9 @@ private:
     // -- The central widget
     static QWidget *central;
 
+    // -- The CPU clock achieved (and the target), on the status bar
+    static QLabel *speed;
+
     // -- Insert the Control Logic Mid-Plane
     static ControlLogic_MidPlane_t *ctrlLogic;
 
@@ -138,6 +152,15 @@ public:
 public:
     static const QString &GetPgmRomFolder(void) { return pgmRomFolder; }
     static void SetPgmRomFolder(const QString &f) { pgmRomFolder = f; }
+    static const QString &GetCtrlRomFolder(void) { return ctrlRomFolder; }
+    static Fidelity_t GetFidelity(const QString &module);
+    static void SetDefaultFidelity(Fidelity_t f) { defaultFidelity = f; }
+    static Fidelity_t GetDefaultFidelity(void) { return defaultFidelity; }
+    static void ShowMessage(const QString &msg);
+    static bool IsFastBoot(void) { return fastBoot.load(std::memory_order_relaxed); }
+
+    // -- takes effect at the next reset
+    static void SetFastBoot(bool f) { fastBoot.store(f, std::memory_order_relaxed); }
 
 
 public:
@@ -154,6 +177,13 @@ private slots:
     void ProcessUpdateCLatch(int state);
     void ProcessUpdateNVLLatch(int state);
     void ProcessSettingsWindow(void);
+    void ProcessSaveSnapshot(void);
+    void ProcessRestoreSnapshot(void);
+    void ProcessTrace(bool on);
+    void ProcessStepBack(void);
+    void ProcessJumpToCycle(void);
+    void ProcessResume(void);
+    void ProcessFrame(void);
 
 
 private:
@@ -162,6 +192,7 @@ private:
     static void WireUp(void);
     static void FinalWireUp(void);
     static void TriggerFirstUpdate(void);
+    static QString FormatHz(double hz);
 };
 
 
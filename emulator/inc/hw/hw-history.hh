@@ -0,0 +1,127 @@
+//===================================================================================================================
+//  hw-history.hh -- Checkpoints and an input log, so the machine can be stepped backwards or jumped to any cycle
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  Every `interval` CPU clock cycles a snapshot of the machine is taken and kept in memory (compressed; most of
+//  a snapshot is control ROM SRAM, which does not change once it is loaded).  Every change made to an external
+//  input (the switches, the DIP settings, the speed pot) is logged with the simulated time it was made.  Since a
+//  run is deterministic apart from those inputs, any cycle after the first checkpoint can be reached again by
+//  restoring the checkpoint before it and running forward, putting each logged input back at the same place.
+//
+//  The checkpoints are held to a memory budget.  When it is exceeded every other checkpoint is dropped (but
+//  never the first) and the interval is doubled, so the whole run stays reachable, just more slowly the further
+//  back it goes.
+//
+//  An input is only ever changed between scheduler edges, right after the edge at the time it was logged, so it
+//  is replayed 1 ns later: after that edge and before the next one.  Changing an input after jumping back starts
+//  a new timeline; the log and checkpoints after that point are thrown away.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- The machine history
+//    -------------------
+class HW_History_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    enum {
+        DEFAULT_INTERVAL = 10000,           // CPU clock cycles between checkpoints
+        DEFAULT_BUDGET_MB = 256,            // the memory the checkpoints may use
+    };
+
+
+private:
+    typedef struct Checkpoint_t {
+        unsigned long cycle;
+        HW_Scheduler_t::Time_t time;
+        unsigned long seq;                  // orders checkpoints against input changes made at the same time
+        QByteArray state;                   // the snapshot, compressed
+    } Checkpoint_t;
+
+    typedef struct Input_t {
+        QObject *obj;
+        std::function<void(int)> replay;
+    } Input_t;
+
+    typedef struct Change_t {
+        HW_Scheduler_t::Time_t time;
+        unsigned long seq;
+        int input;
+        int value;
+    } Change_t;
+
+
+    // -- singleton instance
+    static HW_History_t *singleton;
+
+
+private:
+    QList<Input_t> inputs;
+    QList<Checkpoint_t> checkpoints;
+    QList<Change_t> changes;
+    QList<HW_Scheduler_t::EventId_t> replays;  // inputs waiting to be put back
+
+    bool started;
+    bool replaying;                         // an input is being put back; do not log it again
+    bool capturePending;
+    bool jumping;                           // the snapshot being restored is one of the checkpoints
+    unsigned long interval;
+    unsigned long nextCheckpoint;
+    unsigned long seq;
+    int next;                               // the next change to be replayed; `changes.size()` when caught up
+    qsizetype budget;
+    qsizetype used;
+
+
+private:
+    explicit HW_History_t(void);
+    virtual ~HW_History_t() {}
+
+    HW_History_t(const HW_History_t &) = delete;
+    HW_History_t &operator=(const HW_History_t &) = delete;
+
+
+public:
+    static HW_History_t *Get(void);
+
+    // -- register an input which puts back a logged value with `obj->ReplayInput(int)`
+    template <typename T> void RegisterInput(T *obj) { AddInput(obj, [obj](int v) { obj->ReplayInput(v); }); }
+    void LogInput(QObject *obj, int value);
+
+    void Start(unsigned long cycles = DEFAULT_INTERVAL, int budgetMb = DEFAULT_BUDGET_MB);
+    bool IsStarted(void) const { return started; }
+
+    bool JumpTo(unsigned long cycle);       // leaves the scheduler stopped at `cycle`
+    bool StepBack(void);
+
+    unsigned long GetEarliestCycle(void) const { return checkpoints.isEmpty() ? 0 : checkpoints.first().cycle; }
+    int GetCheckpointCount(void) const { return checkpoints.size(); }
+    qsizetype GetMemoryUsed(void) const { return used; }
+
+
+private:
+    void AddInput(QObject *obj, std::function<void(int)> fn);
+    void TakeCheckpoint(void);
+    void Thin(void);
+    void Replay(int i);
+    void Diverge(void);
+
+
+private slots:
+    void ProcessCpuClock(TriState_t state);
+    void ProcessRestored(void);
+};
+
+
@@ -0,0 +1,147 @@
+//===================================================================================================================
+//  hw-isa-engine.hh -- An instruction-level engine executing straight from the control ROM images
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  This engine does not build any of the hardware.  It loads the 16 `ctrlN.bin` images produced by
+//  `control-logic/src/control.cc` into a control store indexed exactly like `GenerateControlSignals()`: the
+//  flags in bits 14:12 and the instruction in bits 11:0 (which is also just what the instruction bus presents
+//  to the control ROM SRAMs).  Each CPU clock cycle then applies the architectural effect of the 128-bit
+//  control word to the registers in plain C++:
+//
+//  * on the rising edge the control word for the instruction on the instruction bus is latched, the fetch
+//    register captures the program ROM word at Address Bus 1, and the registers latch their outputs
+//  * while the clock is high, the buses are driven and any register with LOAD set takes the Main Bus
+//  * on the falling edge, the INC/DEC counters move and the flags latch
+//
+//  So the pipeline is the same as the hardware: the control word in effect is for the instruction fetched 2
+//  cycles earlier.  Anything with no module in the emulator yet (memory, the devices, the logic and shift
+//  units, the interrupt context) reads as the pulled-down bus and is otherwise ignored.
+//
+//  The control word is never looked at bit-by-bit while running.  The first time a control ROM address is
+//  executed its word is decoded into a `Decoded_t` (the bus sources, the LOAD/INC/DEC register masks, the flag
+//  masks) and every later cycle at that address just uses the decoded copy.  Loading new images clears it.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- The instruction-level engine
+//    ----------------------------
+class HW_IsaEngine_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    // -- the registers, numbered as the Main Bus assert field numbers them (less 1)
+    typedef enum {
+        R1, R2, R3, R4, R5, R6, R7, R8, R9, R10, R11, R12,
+        PGM_SP, PGM_RA, PGM_PC,
+        INT_SP, INT_RA, INT_PC,
+        REG_CNT,
+    } Register_t;
+
+
+    // -- the flags, as bits in a flags word
+    enum {
+        FLAG_Z = 1 << 0,
+        FLAG_C = 1 << 1,
+        FLAG_N = 1 << 2,
+        FLAG_V = 1 << 3,
+        FLAG_L = 1 << 4,
+    };
+
+
+private:
+    enum {
+        CTRL_ROMS = 16,                     // the number of control ROMs (8 bits each)
+        CTRL_SIZE = 32 * 1024,              // the size of each control ROM
+        PGM_SIZE = 32 * 1024,               // the program ROM is a pair of 28C256s
+    };
+
+
+    // -- bus sources which are not registers
+    enum {
+        SRC_NONE = -1,                      // nothing asserted, or something not modeled: the bus is pulled down
+        SRC_FETCH = REG_CNT,                // the fetch register
+        SRC_ALU = REG_CNT + 1,              // the ALU result (Main Bus only)
+    };
+
+
+    // -- a control word, decoded into what it does
+    typedef struct {
+        bool valid;                         // has this address been decoded yet?
+        int8_t addr1;                       // the source for each bus
+        int8_t aluA;
+        int8_t aluB;
+        int8_t main;
+        bool swap;                          // Main Bus assert is byte-swapped
+        uint8_t carrySelect;                // 0, last, inverted, 1
+        bool subtract;
+        bool instrSuppress;
+        bool fetchSuppress;
+        bool brk;
+        uint32_t load;                      // one bit per Register_t
+        uint32_t inc;
+        uint32_t dec;
+        uint8_t pgmLatch;                   // the flags to latch, as FLAG_* bits
+        uint8_t intLatch;
+        uint8_t pgmClear;                   // CLC/CLV
+        uint8_t pgmSet;                     // STC/STV
+    } Decoded_t;
+
+
+    // -- the images: the control store is kept as one 16-byte control word per address
+    uint8_t ctrlStore[CTRL_SIZE][CTRL_ROMS];
+    uint16_t pgmRom[PGM_SIZE];
+    Decoded_t decoded[CTRL_SIZE];
+
+
+    // -- the architectural state
+    uint16_t value[REG_CNT];                // the register contents
+    uint16_t q[REG_CNT];                    // what the register outputs present this cycle
+    uint16_t fetch;                         // the fetch register
+    uint16_t instr;                         // the instruction bus
+    uint16_t fetchBus;                      // the fetch bus (the program ROM output) this cycle
+    uint8_t pgmFlags;
+    uint8_t intFlags;
+    bool halted;
+    unsigned long cycles;
+
+
+public:
+    explicit HW_IsaEngine_t(QObject *parent = nullptr);
+    virtual ~HW_IsaEngine_t() {}
+
+
+public:
+    bool LoadControlRoms(const QString &folder);
+    bool LoadProgramRom(const QString &folder);
+
+    void Reset(void);
+    void Step(void);                        // one CPU clock cycle
+    unsigned long Run(unsigned long count); // until `count` cycles or a BREAK; returns the cycles run
+
+    uint16_t GetRegister(Register_t r) const { return value[r]; }
+    uint16_t GetInstruction(void) const { return instr; }
+    uint8_t GetPgmFlags(void) const { return pgmFlags; }
+    uint8_t GetIntFlags(void) const { return intFlags; }
+    bool IsHalted(void) const { return halted; }
+    unsigned long GetCycleCount(void) const { return cycles; }
+
+
+private:
+    static bool ReadImage(const QString &file, QByteArray &image, qsizetype size, uint8_t fill);
+    const Decoded_t &Decode(uint16_t addr);
+    uint16_t Read(int src) const { return src < 0 ? 0 : (src == SRC_FETCH ? fetch : q[src]); }
+};
+
+
@@ -0,0 +1,146 @@
+//===================================================================================================================
+//  hw-logic.hh -- A packed word of driven logic for 16 nets at once: LOW, HIGH, Z, and contention between drivers
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  This is for reporting contention on a bus, not for simulating unknown logic: the ICs only ever put LOW, HIGH
+//  or Z on a net (`TriState_t`), and a bus always puts a proper level out.  What the planes add is a record of
+//  the nets which more than one driver is pulling both ways at once.
+//
+//  Each net takes one bit in each of two planes: `known` is set when the net is driven to a proper level, and
+//  `value` is then that level.  A net which is not known is Z when its value bit is clear and contended when it
+//  is set:
+//
+//      known  value  state
+//      -----  -----  -----------------------------------------
+//        1      0    LOW
+//        1      1    HIGH
+//        0      0    Z (nothing driving it)
+//        0      1    contended (driven both ways; `x` in a VCD trace)
+//
+//  Resolving drivers is then a few bitwise operations for all 16 bits at once: Z gives way to anything, drivers
+//  agreeing keep their level, and drivers disagreeing (or either already contended) make the bit contended.
+//
+//  A bus with many drivers does not fold every driver's word on each change.  It keeps how many drivers put
+//  each net HIGH and how many put it LOW in an `HW_Count16_t`: a counter for each of the 16 nets, stored
+//  bit-sliced (plane n holds bit n of every count) so that adding or removing a driver is a short ripple of
+//  bitwise operations on all 16 nets at once.  Which nets have any driver at a level is then one word, and the
+//  bus resolves those two words like any other pair of drivers.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- 16 nets of driven logic
+//    -----------------------
+typedef struct HW_Logic16_t {
+    uint16_t known;                         // the nets at a proper level
+    uint16_t value;                         // that level; for the others, set when the net is contended
+
+
+    // -- the word a driver puts out: the bits in `drive` at their level in `val`, the rest Z
+    static constexpr HW_Logic16_t Driven(uint16_t val, uint16_t drive) {
+        return HW_Logic16_t { drive, (uint16_t)(val & drive) };
+    }
+
+    constexpr uint16_t HighMask(void) const { return known & value; }
+    constexpr uint16_t LowMask(void) const { return known & ~value; }
+    constexpr uint16_t ZMask(void) const { return ~known & ~value; }
+    constexpr uint16_t ContendedMask(void) const { return ~known & value; }
+
+    // -- a copy with one bit set to `state`
+    constexpr HW_Logic16_t With(int bit, TriState_t state) const {
+        uint16_t b = (1 << bit);
+        uint16_t k = (state == Z ? known & ~b : known | b);
+        uint16_t v = (state == HIGH ? value | b : value & ~b);
+
+        return HW_Logic16_t { k, v };
+    }
+
+    // -- two drivers on the same nets
+    static constexpr HW_Logic16_t Resolve(HW_Logic16_t a, HW_Logic16_t b) {
+        uint16_t c = a.ContendedMask() | b.ContendedMask() | (a.known & b.known & (a.value ^ b.value));
+        uint16_t known = (a.known | b.known) & ~c;
+
+        return HW_Logic16_t { known, (uint16_t)((a.value & a.known) | (b.value & b.known) | c) };
+    }
+
+    constexpr bool operator==(const HW_Logic16_t &o) const { return known == o.known && value == o.value; }
+    constexpr bool operator!=(const HW_Logic16_t &o) const { return !(*this == o); }
+} HW_Logic16_t;
+
+
+static_assert(sizeof(HW_Logic16_t) == 4, "16 nets of driven logic must pack into 4 bytes");
+static_assert(HW_Logic16_t::Resolve(HW_Logic16_t::Driven(0x00ff, 0x0f0f), HW_Logic16_t::Driven(0xffff, 0x00f0))
+        == HW_Logic16_t { 0x0fff, 0x00ff }, "drivers agreeing, or alone, keep their level");
+static_assert(HW_Logic16_t::Resolve(HW_Logic16_t::Driven(0x0001, 0x0001), HW_Logic16_t::Driven(0x0000, 0x0001))
+        .ContendedMask() == 0x0001, "drivers disagreeing make the bit contended");
+
+
+
+//
+// -- A count for each of 16 nets, bit-sliced: plane n holds bit n of every count
+//    ---------------------------------------------------------------------------
+typedef struct HW_Count16_t {
+    enum { PLANES = 6 };                    // counts up to 63, more than any bus has drivers
+
+    uint16_t plane[PLANES];
+
+
+    // -- add one to the count of each net in `m`: a ripple carry through the planes
+    constexpr void Inc(uint16_t m) {
+        for (int i = 0; i < PLANES; i ++) {
+            uint16_t carry = plane[i] & m;
+            plane[i] ^= m;
+            m = carry;
+        }
+    }
+
+    // -- take one from the count of each net in `m`: a ripple borrow through the planes
+    constexpr void Dec(uint16_t m) {
+        for (int i = 0; i < PLANES; i ++) {
+            uint16_t borrow = ~plane[i] & m;
+            plane[i] ^= m;
+            m = borrow;
+        }
+    }
+
+    // -- the nets counted at least once, and more than once
+    constexpr uint16_t Any(void) const {
+        uint16_t rv = 0;
+        for (int i = 0; i < PLANES; i ++) rv |= plane[i];
+        return rv;
+    }
+
+    constexpr uint16_t Many(void) const {
+        uint16_t rv = 0;
+        for (int i = 1; i < PLANES; i ++) rv |= plane[i];
+        return rv;
+    }
+
+    constexpr int Get(int bit) const {
+        int rv = 0;
+        for (int i = 0; i < PLANES; i ++) rv |= ((plane[i] >> bit) & 1) << i;
+        return rv;
+    }
+} HW_Count16_t;
+
+
+static_assert([]() {
+    HW_Count16_t c = {};
+    c.Inc(0x0003);
+    c.Inc(0x0006);
+    c.Inc(0x0004);
+    c.Dec(0x0003);
+    return c.Any() == 0x0006 && c.Many() == 0x0004 && c.Get(0) == 0 && c.Get(1) == 1 && c.Get(2) == 2;
+}(), "the bit-sliced counts must count up and down for each net on its own");
+
+
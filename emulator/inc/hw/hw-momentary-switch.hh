@@ -46,7 +46,12 @@ signals:
     void SignalState(TriState_t state);
 
 
+private:
+    // -- the switch is clicked on the GUI thread, but the state is changed on the simulation thread
+    void Apply(TriState_t s) { HW_SimThread_t::Get()->Post([this, s](void) { emit SignalState(s); }); }
+
+
 private slots:
-    void ProcessPressed(void) { emit SignalState(highWhen==HIGH_WHEN_PRESSED?HIGH:LOW); }
-    void ProcessReleased(void) { emit SignalState(highWhen==HIGH_WHEN_PRESSED?LOW:HIGH); }
+    void ProcessPressed(void) { Apply(highWhen==HIGH_WHEN_PRESSED?HIGH:LOW); }
+    void ProcessReleased(void) { Apply(highWhen==HIGH_WHEN_PRESSED?LOW:HIGH); }
 };
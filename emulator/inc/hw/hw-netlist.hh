@@ -0,0 +1,175 @@
+//===================================================================================================================
+//  hw-netlist.hh -- An event-driven netlist kernel to propagate signals between components
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  Rather than chaining direct connections from one IC to the next (which recurses as deep as the logic and
+//  evaluates an IC once for every input that changes), the nets are kept in flat arrays, each with a list of
+//  the components it fans out to.  A change to a net is applied at the start of the next delta cycle, and every
+//  component reading any changed net is evaluated exactly once in that delta.  Anything the evaluations drive
+//  lands in the following delta, so the order of evaluation is deterministic and does not depend on the order
+//  the connections were made.
+//
+//  Once wired, a purely combinational netlist can be levelized: each component is given a level one more than
+//  the highest level driving any of its inputs.  Settling then walks the levels in order, evaluating only the
+//  components whose inputs changed, so each is evaluated once per change of the inputs rather than once for
+//  every intermediate transition rippling through the logic.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- The netlist kernel
+//    ------------------
+class HW_Netlist_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    typedef int Net_t;
+
+
+    //
+    // -- Anything scheduled by the netlist: read the input nets and drive the output nets
+    //
+    //    The component keeps the net bound to each of its pins, and works on the IC's own `pins` array.  An IC
+    //    supplies `Compute()`, its truth table from the input pins to the output pins, and `Update()`, which is
+    //    the same thing plus its signals and `DriveOutputs()`.  Evaluating reads the bound input nets into the
+    //    pins and updates; evaluating the lanes runs `Compute()` once per lane unless the IC has a bit-sliced
+    //    version of its own.
+    //    -----------------------------------------------------------------------------------------------------
+    class Component_t {
+        friend class HW_Netlist_t;
+
+    public:
+        enum { MAX_PINS = PIN_CNT(28) };
+
+
+    private:
+        bool queued = false;                // waiting to be evaluated
+        int level = 0;                      // the level when the netlist is levelized
+
+        TriState_t *pins;                   // the IC's pins
+        int pinCount;
+        uint32_t inputs = 0;                // the pins bound to a net the component reads
+        uint32_t outputs = 0;               // the pins bound to a net the component drives
+
+
+    protected:
+        // -- the netlist the pins are bound into, the net on each pin (or -1) and the lanes out of each pin
+        HW_Netlist_t *netlist = nullptr;
+        Net_t nets[MAX_PINS];
+        uint64_t lanes[MAX_PINS];
+
+
+    protected:
+        Component_t(TriState_t *p, int cnt) : pins(p), pinCount(cnt) {
+            for (int i = 0; i < MAX_PINS; i ++) { nets[i] = -1; lanes[i] = 0; }
+        }
+
+        // -- set the output pins from the input pins, without emitting or driving anything
+        virtual void Compute(void) = 0;
+
+        // -- the IC's own update from its input pins, ending with `DriveOutputs()`
+        virtual void Update(void) = 0;
+
+        void DriveOutputs(void);
+        uint64_t InputLanes(int pin) const {
+            return nets[pin] >= 0 ? netlist->GetLanes(nets[pin]) : (pins[pin] == HIGH ? ~0ull : 0);
+        }
+        void SetOutputLanes(int pin, uint64_t val) {
+            lanes[pin] = val;
+            if (nets[pin] >= 0) netlist->SetLanes(nets[pin], val);
+        }
+
+
+    public:
+        virtual ~Component_t() {}
+
+        void BindInput(HW_Netlist_t *nl, int pin, Net_t net);
+        void BindOutput(HW_Netlist_t *nl, int pin, Net_t net);
+        uint64_t GetLanes(int pin) const { return lanes[pin]; }
+
+        virtual void Evaluate(void);
+        virtual void EvaluateLanes(void);
+    };
+
+
+private:
+    // -- give up on a net that will not settle (an oscillator built from gates, most likely)
+    enum { MAX_DELTAS = 1000 };
+
+    // -- the nets, indexed by Net_t
+    QList<TriState_t> state;
+    QList<TriState_t> next;
+    QList<bool> queued;
+    QList<QList<Component_t *>> fanout;
+    QList<QList<Component_t *>> drivers;
+    QList<uint64_t> lanes;
+
+    // -- the work for the current and next delta cycles
+    QList<Net_t> changes;
+    QList<Net_t> work;
+    QList<Component_t *> evals;
+
+    // -- when levelized, the components waiting to be evaluated at each level
+    bool levelized;
+    QList<QList<Component_t *>> levels;
+    QList<Component_t *> order;             // all the components, sorted by level
+    int lowest;
+
+    unsigned long delta;
+    bool settling;
+
+    // -- some statistics
+    unsigned long events;
+    unsigned long evaluations;
+
+
+public:
+    explicit HW_Netlist_t(const QString &name, QObject *parent = nullptr);
+    virtual ~HW_Netlist_t() {}
+
+
+public:
+    Net_t NewNet(TriState_t initial = Z);
+    void AddFanout(Net_t net, Component_t *comp) { fanout[net].append(comp); }
+    void AddDriver(Net_t net, Component_t *comp) { drivers[net].append(comp); }
+    bool Levelize(void);
+    bool IsLevelized(void) const { return levelized; }
+
+    TriState_t Get(Net_t net) const { return state[net]; }
+    void Schedule(Net_t net, TriState_t s);
+    void Drive(Net_t net, TriState_t s) { Schedule(net, s); Settle(); }
+    void Settle(void);
+
+    // -- bit-sliced evaluation (requires a levelized netlist)
+    uint64_t GetLanes(Net_t net) const { return lanes[net]; }
+    void SetLanes(Net_t net, uint64_t val) { lanes[net] = val; }
+    void SettleLanes(void);
+
+    int GetNetCount(void) const { return state.size(); }
+    unsigned long GetDeltaCount(void) const { return delta; }
+    unsigned long GetEventCount(void) const { return events; }
+    unsigned long GetEvaluationCount(void) const { return evaluations; }
+
+    // -- only a settled netlist is saved, so nothing is queued
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & state & next & lanes; }
+
+
+private:
+    void Queue(Component_t *comp);
+    void Commit(void);
+    void SettleDeltas(void);
+    void SettleLevels(void);
+};
+
+
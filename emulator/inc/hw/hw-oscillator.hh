@@ -14,31 +14,44 @@
 
 
 //
-// -- This is on oscillator, built on the QTimer class
-//    ------------------------------------------------
-class HW_Oscillator_t : public QTimer {
+// -- This is on oscillator, with its edges taken by the virtual-time scheduler
+//    -------------------------------------------------------------------------
+class HW_Oscillator_t : public QObject {
     Q_OBJECT
 
 
+public:
+    // -- an interval of 0 is the high-speed crystal: 10 MHz, so 50 ns between edges
+    enum { CRYSTAL_HALF_PERIOD = 50 };
+
+
 private:
     TriState_t state;
+    HW_Scheduler_t::Time_t halfPeriod;      // simulated ns between edges
+    HW_Scheduler_t::Time_t nextEdge;        // when the next edge is due
+    bool running;
 
 public:
     HW_Oscillator_t(int interval = 500);
-    virtual ~HW_Oscillator_t() { stop(); }
+    virtual ~HW_Oscillator_t();
 
 public:
     TriState_t GetState(void) const { return state; }
-    void StartTimer(void) { start(); }
+    HW_Scheduler_t::Time_t GetNextEdge(void) const { return nextEdge; }
+    bool IsRunning(void) const { return running; }
+    void StartTimer(void);
+    void stop(void) { running = false; }
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & state & halfPeriod & nextEdge & running; }
 
 public slots:
     void ProcessTimerStateChange(void) {
+        nextEdge += halfPeriod;
         state = (state==HIGH?LOW:HIGH);
         emit SignalStateChanged(state);
         emit SignalSanityCheck();
     }
-    void ProcessSetInterval(int interval) { QTimer::setInterval(interval); }
-    void ProcessRawInterval(int interval) { QTimer::setInterval((10-interval)*100); }
+    void ProcessSetInterval(int interval);
+    void ProcessRawInterval(int interval) { ProcessSetInterval((10-interval)*100); }
 
 signals:
     void SignalStateChanged(TriState_t state);
@@ -46,3 +59,4 @@ signals:
 
 };
 
+
@@ -22,6 +22,7 @@ class HW_Pot_t : public QSlider {
 
 private:
     QLabel *label;
+    int pos;                                // the setting as the simulation sees it
 
 
 public:
@@ -31,7 +32,34 @@ public:
 
 public:
     QLabel *GetLabel(void) const { return label; }
-    void TriggerFirstUpdate(void) { emit SignalValueChanged(value()); }
+    void TriggerFirstUpdate(void) { emit SignalValueChanged(pos); }
+    void ReplayInput(int v) { Apply(v); Show(v); }
+
+    // -- the setting is put back quietly; the oscillator it drives has its own state restored
+    void Snapshot(HW_Snapshot_t::Stream_t &s) {
+        s & pos;
+        if (s.IsRestoring()) Show(pos);
+    }
+
+
+private:
+    // -- the pot is moved on the GUI thread, but the input is logged and changed on the simulation thread
+    void Apply(int v) {
+        HW_SimThread_t::Get()->Post([this, v](void) {
+            pos = v;
+            HW_History_t::Get()->LogInput(this, v);
+            emit SignalValueChanged(v);
+        });
+    }
+
+    // -- move the pot on the GUI thread to where the simulation put it
+    void Show(int v) {
+        HW_SimThread_t::Get()->PostGui(this, [this, v](void) {
+            QSignalBlocker block(this);
+            setValue(v);
+            label->setText(QString::number(v));
+        });
+    }
 
 
 signals:
@@ -39,5 +67,8 @@ signals:
 
 
 private slots:
-    void ProcessUpdateValue(int v) { label->setText(QString::number(v)); emit SignalValueChanged(v); }
+    void ProcessUpdateValue(int v) {
+        label->setText(QString::number(v));
+        Apply(v);
+    }
 };
@@ -0,0 +1,116 @@
+//===================================================================================================================
+//  hw-profile.hh -- Count where the simulation spends its time: IC input changes, signal emits and no-op updates
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  Three things are counted while profiling:
+//
+//  * for each IC, how many times one of its inputs changed, and how many times an input was updated to the value
+//    it already had (a no-op update)
+//  * for each input slot, how many times it was called and how many of those were no-op updates
+//  * for each signal, how many times it was emitted and how many of those changed what it carried
+//
+//  The first two are counted by `PROFILE_INPUT()` at the top of each IC input slot, which costs one predictable
+//  branch when not profiling.  The signals are counted with Qt's signal spy hook (the one `qtestlib -vs` uses),
+//  so no emitter needs to change; nothing is hooked until profiling starts.  That hook is not part of Qt's
+//  public API, so it is only built in with `CONFIG_PROFILE_SIGNAL_SPY=y` in tup.config, and only for the Qt
+//  versions its shape is known for; otherwise no signals are counted.
+//
+//  When profiling stops, the busiest of each are reported as a table and everything is written out as JSON.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- Count a call to an IC input slot; `cur` is where the slot keeps the input
+//    -------------------------------------------------------------------------
+#define PROFILE_INPUT(cur, state) do { \
+            if (unlikely(HW_Profile_t::enabled)) HW_Profile_t::Get()->CountInput(this, __func__, (state) != (cur)); \
+        } while (0)
+
+
+
+//
+// -- The activity profiler
+//    ---------------------
+class HW_Profile_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    enum { REPORT_ROWS = 25 };              // rows in each table reported at the end
+
+    static bool enabled;
+
+
+private:
+    typedef struct Ic_t {
+        quint64 changes;
+        quint64 noops;
+    } Ic_t;
+
+    typedef struct Slot_t {
+        quint64 calls;
+        quint64 noops;
+    } Slot_t;
+
+    typedef struct Signal_t {
+        QByteArray name;                    // resolved on the first emit, while the sender is sure to be alive
+        QList<int> sizes;                   // the size of each argument
+        QByteArray last;                    // the arguments of the last emit
+        quint64 emits;
+        quint64 changes;
+    } Signal_t;
+
+    typedef QPair<QObject *, const char *> SlotKey_t;
+    typedef QPair<QObject *, int> SignalKey_t;
+
+
+    // -- singleton instance
+    static HW_Profile_t *singleton;
+
+
+private:
+    QHash<QObject *, Ic_t> ics;
+    QHash<SlotKey_t, Slot_t> inputs;
+    QHash<SignalKey_t, Signal_t> emits;
+    QString jsonFile;
+
+
+private:
+    explicit HW_Profile_t(void) {}
+    virtual ~HW_Profile_t() {}
+
+    HW_Profile_t(const HW_Profile_t &) = delete;
+    HW_Profile_t &operator=(const HW_Profile_t &) = delete;
+
+
+public:
+    static HW_Profile_t *Get(void);
+
+    // -- start counting; the counts are written to `json` when profiling stops
+    void Start(const QString &json);
+
+    void CountInput(QObject *ic, const char *slot, bool changed);
+    void CountEmit(QObject *sender, int method, void **argv);
+
+
+public slots:
+    void Stop(void);
+
+
+private:
+    QHash<QObject *, QString> Names(void);
+    void Report(const QHash<QObject *, QString> &names);
+    bool Dump(const QHash<QObject *, QString> &names);
+};
+
+
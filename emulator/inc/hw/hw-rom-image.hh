@@ -0,0 +1,85 @@
+//===================================================================================================================
+//  hw-rom-image.hh -- A ROM image file, mapped into memory once and shared by every IC that loads it
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  The 32K ROM images (`lsb.bin`/`msb.bin` for the program ROM and `ctrlN.bin` for the control ROMs) are mapped
+//  with `mmap` rather than read into each IC.  Every IC loading the same file gets the same image, so a process
+//  with many machines holds one copy of each file.  A missing file reads as all zeros, like it always has; the
+//  rest of a file shorter than 32K reads as the fill byte the IC asks for (0xff for the program ROM, which is
+//  what an erased EEPROM reads, and 0x00 for the control ROMs).
+//
+//  The files are watched (`QFileSystemWatcher`, which is inotify on Linux).  When one changes the image is marked
+//  stale and remapped at the next reset, so a rebuilt image is picked up without restarting the emulator.  The
+//  build tools rewrite the images in place, and a page still backed by a truncated file would raise SIGBUS when
+//  read; so each page is copied once when mapped, leaving the image intact no matter what happens to the file.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- A shared, memory-mapped ROM image
+//    ---------------------------------
+class HW_RomImage_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    enum { SIZE = 32 * 1024 };
+
+
+private:
+    // -- every image loaded, by canonical path
+    static QMap<QString, HW_RomImage_t *> images;
+    static QFileSystemWatcher *watcher;
+    static const uint8_t blank[SIZE];
+
+
+private:
+    QString path;
+    uint8_t fill;                           // what the image reads as past the end of a short file
+    int refs;
+    std::atomic<bool> stale;                // set from the GUI thread when the file changes, cleared at a reset
+    uint8_t *map;                           // nullptr when the file could not be mapped
+    const uint8_t *data;                    // `map` or `blank`
+    unsigned generation;                    // bumped every time `data` changes
+    quint16 checksum;                       // of `data`, taken as it was mapped
+
+
+private:
+    explicit HW_RomImage_t(const QString &file, uint8_t fill);
+    static QString Key(const QString &path, uint8_t fill) { return path + "#" + QString::number(fill, 16); }
+    virtual ~HW_RomImage_t();
+
+    HW_RomImage_t(const HW_RomImage_t &) = delete;
+    HW_RomImage_t &operator=(const HW_RomImage_t &) = delete;
+
+    void Map(void);
+    void Unmap(void);
+
+
+public:
+    static HW_RomImage_t *Get(const QString &file, uint8_t fill = 0x00);
+    static void Release(HW_RomImage_t *image);
+    static void ReloadChanged(void);        // remap every image whose file changed; called at reset
+
+    const uint8_t *Data(void) const { return data; }
+    unsigned GetGeneration(void) const { return generation; }
+    quint16 GetChecksum(void) const { return checksum; }
+    const QString &GetPath(void) const { return path; }
+    bool IsStale(void) const { return stale.load(std::memory_order_relaxed); }
+
+
+private:
+    static void ProcessFileChanged(const QString &file);
+};
+
+
@@ -0,0 +1,154 @@
+//===================================================================================================================
+//  hw-scheduler.hh -- The virtual-time scheduler which owns simulated time and drives the oscillators
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  Simulated time is kept here in nanoseconds and only ever moves forward when the next oscillator edge is
+//  taken.  Edges are taken strictly in time order (and in the order the oscillators were registered when two
+//  land on the same nanosecond), so a run is the same every time no matter how busy the host is.
+//
+//  The Qt event loop only gives the scheduler a chance to run: each slice takes edges for at most `SLICE_MS`
+//  of wall time before returning to the loop, so the inputs posted by the GUI are picked up between slices (in
+//  the GUI the loop is the simulation thread's own; see `HW_SimThread_t`).  When a target frequency is set, a
+//  slice also stops once simulated time catches up with wall time at that rate, and the scheduler sleeps (on
+//  a precise timer) until the next edge is due rather than coming straight back to look.  A slice which falls
+//  behind (the host was busy) makes the time up over the next slices, but never more than `MAX_CATCHUP_MS` of
+//  it, so a long stall does not turn into a long sprint.  When no frequency is set, the slice just runs as
+//  fast as it can.
+//
+//  The frequency can be given for the CPU clock rather than the crystal.  How much simulated time a CPU cycle
+//  takes depends on which clock is selected and on the divider, so the governor measures it: every
+//  `GOVERN_MS` it counts the CPU cycles taken and the simulated time they took, and sets the rate that makes
+//  the next window run at the target.  The CPU clock achieved over the last window is kept for the GUI.
+//
+//  Components that need a delay (the RC timing of a monostable, for one) schedule a delayed event rather than
+//  a wall-clock timer.  Pending events sit in a hashed timing wheel of `WHEEL_SLOTS` slots, each `TICK_NS`
+//  wide; anything further out than the wheel reaches waits in an overflow list until the wheel turns close
+//  enough.  An event fires before any oscillator edge due at the same nanosecond, and events due together
+//  fire in the order they were scheduled.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- The virtual-time scheduler
+//    --------------------------
+class HW_Scheduler_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    typedef uint64_t Time_t;                // simulated nanoseconds
+    typedef uint64_t EventId_t;             // a scheduled delayed event; 0 is never a valid event
+
+    enum : Time_t { NEVER = (Time_t)-1 };
+
+
+private:
+    enum {
+        SLICE_MS = 10,                      // the longest a slice keeps the event loop waiting
+        CHECK_EDGES = 1024,                 // how often (in edges) the wall clock is checked
+        WHEEL_SLOTS = 256,                  // the slots in the timing wheel (a power of 2)
+        TICK_NS = 1024,                     // the simulated ns covered by each slot
+        MAX_CATCHUP_MS = 100,               // the most wall time a slice that fell behind tries to make up
+        GOVERN_MS = 250,                    // how often the CPU clock is measured (and the rate adjusted)
+    };
+
+
+    //
+    // -- A delayed event waiting on the timing wheel
+    //    -------------------------------------------
+    typedef struct Event_t {
+        Time_t due;
+        EventId_t id;                       // also the order the event was scheduled
+        QPointer<QObject> context;          // the event is dropped if this is deleted before it is due
+        std::function<void(void)> fn;
+    } Event_t;
+
+
+    // -- singleton instance
+    static HW_Scheduler_t *singleton;
+
+
+private:
+    Time_t now;
+    QList<HW_Oscillator_t *> oscillators;
+    QTimer *slice;
+    bool running;
+
+    // -- the timing wheel; `tick` is the wheel position, covering [tick, tick + WHEEL_SLOTS) * TICK_NS
+    QList<Event_t> wheel[WHEEL_SLOTS];
+    QList<Event_t> overflow;
+    Time_t tick;
+    Time_t nextDue;                         // cached earliest due time, NEVER when nothing is pending
+    EventId_t lastId;
+    int pending;
+
+    // -- pacing: simulated time is held to `rate` simulated ns per wall ns from `paceBase`; 0 is unpaced
+    double rate;
+    Time_t paceBase;
+    QElapsedTimer wall;
+
+    // -- the governor: `rate` is set from what the last window achieved to hold the CPU clock to `cpuHz`
+    double crystalRate;                     // the rate for the crystal frequency, used when `cpuHz` is 0
+    double cpuHz;
+    double achievedHz;                      // the CPU clock over the last window
+    QElapsedTimer window;
+    unsigned long windowCycles;             // the CPU clock count at the start of the window
+    Time_t windowTime;
+
+
+private:
+    explicit HW_Scheduler_t(void);
+    virtual ~HW_Scheduler_t() {}
+
+    HW_Scheduler_t(const HW_Scheduler_t &) = delete;
+    HW_Scheduler_t &operator=(const HW_Scheduler_t &) = delete;
+
+
+public:
+    static HW_Scheduler_t *Get(void);
+
+    Time_t GetTime(void) const { return now; }
+
+    void Register(HW_Oscillator_t *osc);
+    void Unregister(HW_Oscillator_t *osc);
+
+    void Start(void);
+    void Stop(void);                        // also ends the slice in progress after the current edge
+    bool Step(void);                        // take the next edge or event now, unpaced; false if there is none
+    void SetTargetFrequency(double hz);     // the high-speed crystal frequency to pace to; 0 is unpaced
+    void SetTargetCpuFrequency(double hz);  // the CPU clock frequency to pace to; 0 paces the crystal instead
+    double GetTargetCpuFrequency(void) const { return cpuHz; }
+    double GetAchievedFrequency(void) const { return achievedHz; }
+
+    EventId_t Schedule(Time_t delay, QObject *context, std::function<void(void)> fn);
+    void Cancel(EventId_t id);
+    bool IsPending(void) const { return pending != 0; }
+
+    void Restore(Time_t to);                // drop every pending event and move time to `to` (a snapshot)
+
+
+private:
+    HW_Oscillator_t *Next(void) const;      // the oscillator with the earliest next edge
+    Time_t NextDue(void);                   // the earliest delayed event, NEVER if there is none
+    void FireNext(void);                    // fire the earliest delayed event, moving time to it
+    void Insert(const Event_t &ev);         // place an event on the wheel or in overflow
+    void Turn(Time_t to);                   // turn the wheel to `to`, pulling in overflow that now fits
+    void SetRate(double r);                 // change the pace without gaining or losing time
+    void Govern(void);                      // measure the CPU clock and adjust the rate to it
+
+
+private slots:
+    void ProcessSlice(void);
+};
+
+
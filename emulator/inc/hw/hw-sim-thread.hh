@@ -0,0 +1,115 @@
+//===================================================================================================================
+//  hw-sim-thread.hh -- Runs the simulation on a thread of its own, away from the GUI
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  The scheduler (and with it every IC, bus and module it drives) runs on the simulation thread, so a window
+//  being dragged or a modal dialog does not stall the CPU, and a busy CPU does not stall the GUI.  Every
+//  connection between simulated components is a direct one (`CNN_TYPE`), so a signal is still a plain function
+//  call on whichever thread emits it; only these three places cross between the threads:
+//
+//  * Inputs from the GUI (the switches, the speed pot, the menu actions) are posted as commands to a ring with
+//    one producer (the GUI) and one consumer (the simulation), so it needs no lock: the GUI only ever moves
+//    `head` and the simulation only ever moves `tail`.  The simulation thread drains the ring between slices.
+//    A command which must finish before the GUI carries on (a snapshot, a jump back in time) is `Call()`ed.
+//  * The buses shown on the GUI are published under a sequence lock: the simulation bumps `seq` to odd, writes
+//    the values, and bumps it to even again; the GUI copies the values and tries again if `seq` moved while it
+//    did.  The simulation never waits on the GUI.
+//  * The LEDs keep their latest state in an atomic, which the GUI reads at the next frame.
+//
+//  Without the thread (emu-cli and emu-bench, or before `Start()`), every command simply runs where it is posted.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- The simulation thread
+//    ---------------------
+class HW_SimThread_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    enum {
+        RING_SIZE = 1 << 10,                // commands in flight to the simulation (a power of 2)
+        BUS_CNT = 16,                       // the most buses which can be published
+        PUBLISH_MS = 5,                     // how often the state is published, a little faster than a frame
+    };
+
+
+    //
+    // -- The machine state as last published
+    //    -----------------------------------
+    typedef struct State_t {
+        unsigned long cycles;
+        HW_Scheduler_t::Time_t time;
+        double achievedHz;                  // the CPU clock, as measured by the scheduler
+        double targetHz;                    // the CPU clock being paced to; 0 when pacing the crystal
+        uint16_t value[BUS_CNT];
+        uint16_t zMask[BUS_CNT];            // the bits which are not driven
+    } State_t;
+
+
+private:
+    // -- singleton instance
+    static HW_SimThread_t *singleton;
+
+
+private:
+    QThread *thread;
+    QTimer *publish;
+
+    std::function<void(void)> *ring;
+    std::atomic<uint64_t> head;             // moved only by the GUI
+    std::atomic<uint64_t> tail;             // moved only by the simulation
+    std::atomic<bool> wake;                 // the simulation has been asked to drain the ring
+
+    QList<HW_Bus_16_t *> buses;
+    std::atomic<uint32_t> seq;              // odd while `state` is being written
+    State_t state;
+
+
+private:
+    explicit HW_SimThread_t(void);
+    virtual ~HW_SimThread_t() { Stop(); delete [] ring; }
+
+    HW_SimThread_t(const HW_SimThread_t &) = delete;
+    HW_SimThread_t &operator=(const HW_SimThread_t &) = delete;
+
+
+public:
+    static HW_SimThread_t *Get(void);
+
+    void Start(void);
+    bool IsRunning(void) const { return thread != nullptr; }
+
+    // -- run `fn` on the simulation thread: `Post()` returns right away, `Call()` once `fn` has run
+    void Post(std::function<void(void)> fn);
+    void Call(std::function<void(void)> fn);
+
+    // -- run `fn` on the GUI thread, for a widget put back by the simulation (a replayed input, a snapshot)
+    void PostGui(QObject *widget, std::function<void(void)> fn);
+
+    // -- publish `bus` from here on; the index finds it in the published state
+    int Watch(HW_Bus_16_t *bus);
+    State_t Read(void) const;
+
+
+public slots:
+    void Stop(void);
+
+
+private slots:
+    void ProcessCommands(void);
+    void ProcessPublish(void);
+};
+
+
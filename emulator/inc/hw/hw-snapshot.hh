@@ -0,0 +1,153 @@
+//===================================================================================================================
+//  hw-snapshot.hh -- Save and restore the state of the whole machine
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  Every component with state (the ICs, the buses, the oscillators, the netlists and the few modules with state
+//  of their own) registers itself here when it is constructed.  A snapshot is then just the state of each, in
+//  the order they registered, behind a small header:
+//
+//      offset  size  contents
+//      ------  ----  -----------------------------------------------------------------------------------------
+//           0     4  "16BS"
+//           4     2  the format version (`VERSION`)
+//           6     2  reserved (0)
+//           8     4  the number of components
+//          12     8  simulated time in ns
+//          20   ...  for each component: the class name (2-byte length and Latin-1), the state length (4 bytes)
+//                    and the state itself
+//
+//  Values are in host byte order; a snapshot is meant to be restored by the same build on the same machine.
+//  Since the components register as the computer is built, the order only depends on how it is built: a
+//  snapshot taken with one fidelity will not restore into a machine built with another, and that is caught by
+//  the class names not lining up.
+//
+//  Each component has one `Snapshot()` function which names its state to a `Stream_t`; the same function saves
+//  and restores, so the two can never disagree on the layout.  Pointers are never saved: the wiring is rebuilt
+//  by constructing the computer, only the values on it are restored.
+//
+//  Pending delayed events cannot be saved (they are closures); they are dropped on restore and the components
+//  which own them schedule them again from their own state.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- The machine snapshot
+//    --------------------
+class HW_Snapshot_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    enum { VERSION = 5 };
+
+
+    //
+    // -- The state of one component as it is saved or restored; the same calls do either
+    //    --------------------------------------------------------------------------------
+    class Stream_t {
+        friend class HW_Snapshot_t;
+
+    private:
+        QByteArray *buf;
+        qsizetype pos;
+        qsizetype end;
+        bool restoring;
+        bool checking;                      // restoring, but only to see that it fits; nothing is written
+        bool ok;
+
+        Stream_t(QByteArray *b, bool r, bool c = false)
+                : buf(b), pos(0), end(b->size()), restoring(r), checking(c), ok(true) {}
+
+        void Copy(void *data, qsizetype len);
+
+    public:
+        // -- only a real restore; a check must not have side effects
+        bool IsRestoring(void) const { return restoring && !checking; }
+        void Fail(void) { ok = false; }
+        void Raw(void *data, qsizetype len);
+
+        // -- a value read even when only checking, so that a component can check it against this machine
+        template <typename T> Stream_t &Checked(T &v) {
+            static_assert(std::is_trivially_copyable<T>::value, "only plain values can be in a snapshot");
+            Copy(&v, sizeof(T));
+            return *this;
+        }
+
+        template <typename T> Stream_t &operator&(T &v) {
+            static_assert(std::is_trivially_copyable<T>::value, "only plain values can be in a snapshot");
+            Raw(&v, sizeof(T));
+            return *this;
+        }
+
+        // -- a list must already be the right size when restoring; only its contents are restored
+        template <typename T> Stream_t &operator&(QList<T> &l) {
+            qsizetype n = l.size();
+            *this & n;
+            if (n != l.size()) ok = false;
+            else if (n) Raw(l.data(), n * sizeof(T));
+            return *this;
+        }
+    };
+
+
+private:
+    typedef struct Entry_t {
+        QObject *obj;
+        std::function<void(Stream_t &)> fn;
+    } Entry_t;
+
+
+    // -- singleton instance
+    static HW_Snapshot_t *singleton;
+
+
+private:
+    QList<Entry_t> entries;
+
+
+private:
+    explicit HW_Snapshot_t(void) {}
+    virtual ~HW_Snapshot_t() {}
+
+    HW_Snapshot_t(const HW_Snapshot_t &) = delete;
+    HW_Snapshot_t &operator=(const HW_Snapshot_t &) = delete;
+
+
+public:
+    static HW_Snapshot_t *Get(void);
+
+    // -- register a component whose state is named by `obj->Snapshot(Stream_t &)`
+    template <typename T> void Register(T *obj) { Add(obj, [obj](Stream_t &s) { obj->Snapshot(s); }); }
+
+    int GetComponentCount(void) const { return entries.size(); }
+    QList<QObject *> GetComponents(void) const;
+    QObject *GetComponent(int i) const { return (i >= 0 && i < entries.size() ? entries[i].obj : nullptr); }
+    int IndexOf(const QObject *obj) const;
+
+    QByteArray Capture(void);
+    bool Apply(const QByteArray &snap);
+
+    bool Save(const QString &file);
+    bool Restore(const QString &file);
+
+
+signals:
+    void SignalRestored(void);
+
+
+private:
+    void Add(QObject *obj, std::function<void(Stream_t &)> fn);
+    bool Load(const QByteArray &snap, bool check);
+};
+
+
@@ -36,11 +36,25 @@ public:
     virtual ~HW_SpdtSwitch_t() {}
 
 
+public:
+    void ReplayInput(int v) { if (v) ProcessPressed(); else ProcessReleased(); }
+
+
 signals:
     void SignalState(TriState_t state);
 
 
+private:
+    // -- the switch is clicked on the GUI thread, but the input is logged and changed on the simulation thread
+    void Apply(int v, TriState_t s) {
+        HW_SimThread_t::Get()->Post([this, v, s](void) {
+            HW_History_t::Get()->LogInput(this, v);
+            emit SignalState(s);
+        });
+    }
+
+
 private slots:
-    void ProcessPressed(void) { emit SignalState(highWhen==HIGH_WHEN_PRESSED?HIGH:LOW); }
-    void ProcessReleased(void) { emit SignalState(highWhen==HIGH_WHEN_PRESSED?LOW:HIGH); }
+    void ProcessPressed(void) { Apply(1, highWhen==HIGH_WHEN_PRESSED?HIGH:LOW); }
+    void ProcessReleased(void) { Apply(0, highWhen==HIGH_WHEN_PRESSED?LOW:HIGH); }
 };
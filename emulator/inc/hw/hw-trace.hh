@@ -0,0 +1,125 @@
+//===================================================================================================================
+//  hw-trace.hh -- Record the buses and control signals to a VCD waveform file
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  While tracing, every change to a traced net is put in a ring buffer with the simulated time it happened.  A
+//  writer thread drains the ring and formats it as a VCD file, which GTKWave (among others) can open; for a long
+//  run `vcd2fst` from GTKWave will turn it into a much smaller FST file.
+//
+//  The ring has one producer (the simulation) and one consumer (the writer), so it needs no lock: the
+//  simulation only ever moves `head` and the writer only ever moves `tail`.  Recording a change is a few stores
+//  and a release; only when the writer has fallen a whole ring behind does the simulation wait for it.
+//
+//  The nets traced are the 16-bit buses (with any undriven bits shown as `z` and any driven both ways as `x`),
+//  the control word as the outputs of each of the 16 control ROMs, and the clock phases.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- The waveform tracer
+//    -------------------
+class HW_Trace_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    enum { RING_SIZE = 1 << 16 };           // changes in flight to the writer (a power of 2)
+
+
+private:
+    typedef struct Change_t {
+        HW_Scheduler_t::Time_t time;
+        uint64_t value;
+        uint64_t zMask;                     // the bits which are not driven; contended when the value bit is also set
+        int var;
+    } Change_t;
+
+    typedef struct Var_t {
+        QString scope;
+        QString name;
+        int width;
+        QByteArray code;                    // the VCD identifier
+        uint64_t value;                     // for vars recorded a bit at a time
+        uint64_t zMask;
+    } Var_t;
+
+
+    // -- singleton instance
+    static HW_Trace_t *singleton;
+
+
+private:
+    QList<Var_t> vars;
+    QList<Var_t> layout;                    // the writer's own copy of `vars`
+    QList<QMetaObject::Connection> probes;
+    QList<HW_Bus_16_t *> buses;
+
+    Change_t *ring;
+    std::atomic<uint64_t> head;             // moved only by the simulation
+    std::atomic<uint64_t> tail;             // moved only by the writer
+    std::atomic<bool> stopping;
+
+    QFile *file;
+    QThread *writer;
+    bool tracing;
+    unsigned long stalls;                   // times the simulation waited for the writer
+
+
+private:
+    explicit HW_Trace_t(void);
+    virtual ~HW_Trace_t() { Stop(); delete [] ring; }
+
+    HW_Trace_t(const HW_Trace_t &) = delete;
+    HW_Trace_t &operator=(const HW_Trace_t &) = delete;
+
+
+public:
+    static HW_Trace_t *Get(void);
+
+    bool Start(const QString &fileName);
+    bool IsTracing(void) const { return tracing; }
+
+    // -- record a whole value for `var`
+    void Record(int var, uint64_t value, uint64_t zMask = 0) {
+        uint64_t h = head.load(std::memory_order_relaxed);
+
+        while (unlikely(h - tail.load(std::memory_order_acquire) >= RING_SIZE)) {
+            stalls ++;
+            QThread::yieldCurrentThread();
+        }
+
+        Change_t &ch = ring[h & (RING_SIZE - 1)];
+        ch.time = HW_Scheduler_t::Get()->GetTime();
+        ch.value = value;
+        ch.zMask = zMask;
+        ch.var = var;
+
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    // -- record one bit of `var`, which is kept up to date here
+    void RecordBit(int var, int bit, TriState_t state);
+
+
+public slots:
+    void Stop(void);
+
+
+private:
+    int AddVar(const QString &scope, const QString &name, int width);
+    void TraceBus(const QString &name, HW_Bus_16_t *bus);
+    void Drain(void);                       // the writer thread
+    void Format(const Change_t &ch, QByteArray &out);
+};
+
+
@@ -25,11 +25,8 @@
 // -- This is the class which will emulate the SPI EEPROM
 //    ---------------------------------------------------
 class IC_25lc256_t : public QObject {
-    friend void IC_as6c62256_t::ProcessSanityCheck(QString name);
-
-#if !defined(PEDANTIC_COPY) || (PEDANTIC_COPY == 0)
-    friend void IC_as6c62256_t::CopyEeprom(void);
-#endif
+    friend void IC_as6c62256_t::ProcessSanityCheck(QString name, bool full);
+    friend bool IC_as6c62256_t::CopyEeprom(void);
 
     Q_OBJECT
 
@@ -78,28 +75,29 @@ private:
     uint32_t addr;              // this is the internal address register
     uint8_t byte;               // this is the internal byte register (will be shifted out)
     int bits;                   // this is a bit counter; the value here will always be `(bits % 8)`
-    uint8_t contents[32*1024];  // this is the rom image
+    HW_RomImage_t *image;       // this is the rom image, shared with any other IC loading the same file
     int mode;                   // this is what is going on
 
 
 
 public:
     IC_25lc256_t(const QString &file);
-    virtual ~IC_25lc256_t() {};
+    virtual ~IC_25lc256_t() { HW_RomImage_t::Release(image); }
 
 
 
 public:
     void TriggerFirstUpdate(void) { emit SignalSoUpdated(pins[SO]); }
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & pins & addr & byte & bits & mode; }
 
 
 
 public slots:
     void ProcessUpdateCs(TriState_t state);
-    void ProcessUpdateWp(TriState_t state) { /* !!!UNIMPLEMENTED!!! */ pins[WPb] = state; }
-    void ProcessUpdateSi(TriState_t state) { pins[SI] = state; }
+    void ProcessUpdateWp(TriState_t state) { PROFILE_INPUT(pins[WPb], state); /* !!!UNIMPLEMENTED!!! */ pins[WPb] = state; }
+    void ProcessUpdateSi(TriState_t state) { PROFILE_INPUT(pins[SI], state); pins[SI] = state; }
     void ProcessUpdateSck(TriState_t state);
-    void ProcessUpdateHold(TriState_t state) { /* !!!UNIMPLEMENTED!!! */ pins[HOLDb] = state; }
+    void ProcessUpdateHold(TriState_t state) { PROFILE_INPUT(pins[HOLDb], state); /* !!!UNIMPLEMENTED!!! */ pins[HOLDb] = state; }
 
 
 signals:
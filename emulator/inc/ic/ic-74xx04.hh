@@ -46,41 +46,42 @@ public:
 
 public:
     void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & pins; }
 
 
 public slots:
     // -- Gate #1 slots
-    void ProcessUpdateA1(TriState_t state) { if (state != pins[A1]) { pins[A1] = state; ProcessUpdateGate1(); } }
+    void ProcessUpdateA1(TriState_t state) { PROFILE_INPUT(pins[A1], state); if (state != pins[A1]) { pins[A1] = state; ProcessUpdateGate1(); } }
     void ProcessA1Low(void)  { ProcessUpdateA1(LOW); }
     void ProcessA1High(void) { ProcessUpdateA1(HIGH); }
     void ProcessUpdateGate1(void);
 
     // -- Gate #2 slots
-    void ProcessUpdateA2(TriState_t state) { if (state != pins[A2]) { pins[A2] = state; ProcessUpdateGate2(); } }
+    void ProcessUpdateA2(TriState_t state) { PROFILE_INPUT(pins[A2], state); if (state != pins[A2]) { pins[A2] = state; ProcessUpdateGate2(); } }
     void ProcessA2Low(void)  { ProcessUpdateA2(LOW); }
     void ProcessA2High(void) { ProcessUpdateA2(HIGH); }
     void ProcessUpdateGate2(void);
 
     // -- Gate #3 slots
-    void ProcessUpdateA3(TriState_t state) { if (state != pins[A3]) { pins[A3] = state; ProcessUpdateGate3(); } }
+    void ProcessUpdateA3(TriState_t state) { PROFILE_INPUT(pins[A3], state); if (state != pins[A3]) { pins[A3] = state; ProcessUpdateGate3(); } }
     void ProcessA3Low(void)  { ProcessUpdateA3(LOW); }
     void ProcessA3High(void) { ProcessUpdateA3(HIGH); }
     void ProcessUpdateGate3(void);
 
     // -- Gate #4 slots
-    void ProcessUpdateA4(TriState_t state) { if (state != pins[A4]) { pins[A4] = state; ProcessUpdateGate4(); } }
+    void ProcessUpdateA4(TriState_t state) { PROFILE_INPUT(pins[A4], state); if (state != pins[A4]) { pins[A4] = state; ProcessUpdateGate4(); } }
     void ProcessA4Low(void)  { ProcessUpdateA4(LOW); }
     void ProcessA4High(void) { ProcessUpdateA4(HIGH); }
     void ProcessUpdateGate4(void);
 
     // -- Gate #5 slots
-    void ProcessUpdateA5(TriState_t state) { if (state != pins[A5]) { pins[A5] = state; ProcessUpdateGate5(); } }
+    void ProcessUpdateA5(TriState_t state) { PROFILE_INPUT(pins[A5], state); if (state != pins[A5]) { pins[A5] = state; ProcessUpdateGate5(); } }
     void ProcessA5Low(void)  { ProcessUpdateA5(LOW); }
     void ProcessA5High(void) { ProcessUpdateA5(HIGH); }
     void ProcessUpdateGate5(void);
 
     // -- Gate #6 slots
-    void ProcessUpdateA6(TriState_t state) { if (state != pins[A6]) { pins[A6] = state; ProcessUpdateGate6(); } }
+    void ProcessUpdateA6(TriState_t state) { PROFILE_INPUT(pins[A6], state); if (state != pins[A6]) { pins[A6] = state; ProcessUpdateGate6(); } }
     void ProcessA6Low(void)  { ProcessUpdateA6(LOW); }
     void ProcessA6High(void) { ProcessUpdateA6(HIGH); }
     void ProcessUpdateGate6(void);
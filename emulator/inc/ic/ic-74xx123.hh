@@ -7,6 +7,7 @@
 //      Date     Tracker  Version  Description
 //  -----------  -------  -------  ---------------------------------------------------------------------------------
 //  2023-Nov-03  Initial  v0.0.1   Initial Version
+//  2026-Oct-17  Initial  v0.0.2   Time the output pulse in simulated time from the RC values
 //===================================================================================================================
 
 
@@ -37,6 +38,13 @@ public:
     };
 
 
+    // -- the RC values on the reset board: 10K and 0u1 on each half
+    enum {
+        DEFAULT_REXT = 10000,           // ohms
+        DEFAULT_CEXT = 100000,          // pF
+    };
+
+
 private:
     TriState_t pins[PIN_CNT(16)];
 
@@ -49,15 +57,22 @@ private:
 
     bool cycling1;
     bool cycling2;
+    HW_Scheduler_t::Time_t end1;            // when the pulse in progress ends, while cycling
+    HW_Scheduler_t::Time_t end2;
+
+    // -- the output pulse width in simulated ns, tw = 0.45 * Rext * Cext
+    HW_Scheduler_t::Time_t width;
 
 
 public:
-    IC_74xx123_t(void);
+    IC_74xx123_t(int rext = DEFAULT_REXT, int cext = DEFAULT_CEXT);
     virtual ~IC_74xx123_t() {};
 
 
 
 public:
+    HW_Scheduler_t::Time_t GetPulseWidth(void) const { return width; }
+
     void TriggerFirstUpdate(void) {
         emit SignalQ1bUpdated(pins[Q1b]);
         emit SignalQ1Updated(pins[Q1]);
@@ -65,16 +80,18 @@ public:
         emit SignalQ2Updated(pins[Q2]);
     }
 
+    void Snapshot(HW_Snapshot_t::Stream_t &s);
+
 
 
 public slots:
-    void ProcessUpdateA1b(TriState_t state) { pins[A1b] = state; ProcessUpdates1Complete(); }
-    void ProcessUpdateB1(TriState_t state) { pins[B1] = state; ProcessUpdates1Complete(); }
-    void ProcessUpdateRD1b(TriState_t state) { pins[RD1b] = state; ProcessUpdates1Complete(); }
+    void ProcessUpdateA1b(TriState_t state) { PROFILE_INPUT(pins[A1b], state); pins[A1b] = state; ProcessUpdates1Complete(); }
+    void ProcessUpdateB1(TriState_t state) { PROFILE_INPUT(pins[B1], state); pins[B1] = state; ProcessUpdates1Complete(); }
+    void ProcessUpdateRD1b(TriState_t state) { PROFILE_INPUT(pins[RD1b], state); pins[RD1b] = state; ProcessUpdates1Complete(); }
     void ProcessUpdateRCEXT1(void);
-    void ProcessUpdateA2b(TriState_t state) { pins[A2b] = state; ProcessUpdates2Complete(); }
-    void ProcessUpdateB2(TriState_t state) { pins[B2] = state; ProcessUpdates2Complete(); }
-    void ProcessUpdateRD2b(TriState_t state) { pins[RD2b] = state; ProcessUpdates2Complete(); }
+    void ProcessUpdateA2b(TriState_t state) { PROFILE_INPUT(pins[A2b], state); pins[A2b] = state; ProcessUpdates2Complete(); }
+    void ProcessUpdateB2(TriState_t state) { PROFILE_INPUT(pins[B2], state); pins[B2] = state; ProcessUpdates2Complete(); }
+    void ProcessUpdateRD2b(TriState_t state) { PROFILE_INPUT(pins[RD2b], state); pins[RD2b] = state; ProcessUpdates2Complete(); }
     void ProcessUpdateRCEXT2(void);
     void ProcessUpdates1Complete(void);
     void ProcessUpdates2Complete(void);
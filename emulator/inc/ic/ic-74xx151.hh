@@ -48,21 +48,22 @@ public:
 
 public:
     void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & pins; }
 
 
 public slots:
-    void ProcessUpdateA(TriState_t state) { pins[A] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateB(TriState_t state) { pins[B] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateC(TriState_t state) { pins[C] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateD0(TriState_t state) { pins[D0] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateD1(TriState_t state) { pins[D1] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateD2(TriState_t state) { pins[D2] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateD3(TriState_t state) { pins[D3] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateD4(TriState_t state) { pins[D4] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateD5(TriState_t state) { pins[D5] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateD6(TriState_t state) { pins[D6] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateD7(TriState_t state) { pins[D7] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateST(TriState_t state) { pins[STb] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateA(TriState_t state) { PROFILE_INPUT(pins[A], state); pins[A] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateB(TriState_t state) { PROFILE_INPUT(pins[B], state); pins[B] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateC(TriState_t state) { PROFILE_INPUT(pins[C], state); pins[C] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateD0(TriState_t state) { PROFILE_INPUT(pins[D0], state); pins[D0] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateD1(TriState_t state) { PROFILE_INPUT(pins[D1], state); pins[D1] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateD2(TriState_t state) { PROFILE_INPUT(pins[D2], state); pins[D2] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateD3(TriState_t state) { PROFILE_INPUT(pins[D3], state); pins[D3] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateD4(TriState_t state) { PROFILE_INPUT(pins[D4], state); pins[D4] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateD5(TriState_t state) { PROFILE_INPUT(pins[D5], state); pins[D5] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateD6(TriState_t state) { PROFILE_INPUT(pins[D6], state); pins[D6] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateD7(TriState_t state) { PROFILE_INPUT(pins[D7], state); pins[D7] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateST(TriState_t state) { PROFILE_INPUT(pins[STb], state); pins[STb] = state; ProcessUpdatesComplete(); }
 
     void ProcessUpdatesComplete(void);
 
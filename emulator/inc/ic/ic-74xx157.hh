@@ -55,6 +55,7 @@ public:
 
 public:
     void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & pins; }
 
 
 private:
@@ -63,16 +64,16 @@ private:
 
 
 public slots:
-    void ProcessUpdateA1(TriState_t state) { pins[A1] = state; ProcessUpdate(); }
-    void ProcessUpdateB1(TriState_t state) { pins[B1] = state; ProcessUpdate(); }
-    void ProcessUpdateA2(TriState_t state) { pins[A2] = state; ProcessUpdate(); }
-    void ProcessUpdateB2(TriState_t state) { pins[B2] = state; ProcessUpdate(); }
-    void ProcessUpdateA3(TriState_t state) { pins[A3] = state; ProcessUpdate(); }
-    void ProcessUpdateB3(TriState_t state) { pins[B3] = state; ProcessUpdate(); }
-    void ProcessUpdateA4(TriState_t state) { pins[A4] = state; ProcessUpdate(); }
-    void ProcessUpdateB4(TriState_t state) { pins[B4] = state; ProcessUpdate(); }
-    void ProcessUpdateAB(TriState_t state) { pins[A_B] = state; ProcessUpdate(); }
-    void ProcessUpdateGb(TriState_t state) { pins[Gb] = state; ProcessUpdate(); }
+    void ProcessUpdateA1(TriState_t state) { PROFILE_INPUT(pins[A1], state); pins[A1] = state; ProcessUpdate(); }
+    void ProcessUpdateB1(TriState_t state) { PROFILE_INPUT(pins[B1], state); pins[B1] = state; ProcessUpdate(); }
+    void ProcessUpdateA2(TriState_t state) { PROFILE_INPUT(pins[A2], state); pins[A2] = state; ProcessUpdate(); }
+    void ProcessUpdateB2(TriState_t state) { PROFILE_INPUT(pins[B2], state); pins[B2] = state; ProcessUpdate(); }
+    void ProcessUpdateA3(TriState_t state) { PROFILE_INPUT(pins[A3], state); pins[A3] = state; ProcessUpdate(); }
+    void ProcessUpdateB3(TriState_t state) { PROFILE_INPUT(pins[B3], state); pins[B3] = state; ProcessUpdate(); }
+    void ProcessUpdateA4(TriState_t state) { PROFILE_INPUT(pins[A4], state); pins[A4] = state; ProcessUpdate(); }
+    void ProcessUpdateB4(TriState_t state) { PROFILE_INPUT(pins[B4], state); pins[B4] = state; ProcessUpdate(); }
+    void ProcessUpdateAB(TriState_t state) { PROFILE_INPUT(pins[A_B], state); pins[A_B] = state; ProcessUpdate(); }
+    void ProcessUpdateGb(TriState_t state) { PROFILE_INPUT(pins[Gb], state); pins[Gb] = state; ProcessUpdate(); }
 
 
 
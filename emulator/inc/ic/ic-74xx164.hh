@@ -53,12 +53,13 @@ public:
 
 public:
     void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & pins; }
 
 
 
 public slots:
-    void ProcessUpdateA(TriState_t state) { pins[A] = state; }
-    void ProcessUpdateB(TriState_t state) { pins[B] = state; }
+    void ProcessUpdateA(TriState_t state) { PROFILE_INPUT(pins[A], state); pins[A] = state; }
+    void ProcessUpdateB(TriState_t state) { PROFILE_INPUT(pins[B], state); pins[B] = state; }
     void ProcessUpdateClr(TriState_t state);
     void ProcessUpdateClk(TriState_t state);
 
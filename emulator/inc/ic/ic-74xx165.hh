@@ -63,6 +63,7 @@ public:
 
 public:
     void TriggerFirstUpdate(void) { emit SignalQHUpdated(pins[QH]); emit SignalQHbUpdated(pins[QHb]); }
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & pins & val & clockState; }
 
 
 
@@ -73,18 +74,18 @@ private:
 
 
 public slots:
-    void ProcessUpdateA(TriState_t state) { pins[A] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
-    void ProcessUpdateB(TriState_t state) { pins[B] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
-    void ProcessUpdateC(TriState_t state) { pins[C] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
-    void ProcessUpdateD(TriState_t state) { pins[D] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
-    void ProcessUpdateE(TriState_t state) { pins[E] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
-    void ProcessUpdateF(TriState_t state) { pins[F] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
-    void ProcessUpdateG(TriState_t state) { pins[G] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
-    void ProcessUpdateH(TriState_t state) { pins[H] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
-    void ProcessUpdateSer(TriState_t state) { pins[SER] = state; }
-    void ProcessUpdateClk(TriState_t state) { pins[CLK] = state; ProcessClock(); }
-    void ProcessUpdateClkInh(TriState_t state) { pins[CLK_INH] = state; ProcessClock(); }
-    void ProcessUpdateShLd(TriState_t state) { pins[SH_LD] = state; ProcessNewPin(); };
+    void ProcessUpdateA(TriState_t state) { PROFILE_INPUT(pins[A], state); pins[A] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
+    void ProcessUpdateB(TriState_t state) { PROFILE_INPUT(pins[B], state); pins[B] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
+    void ProcessUpdateC(TriState_t state) { PROFILE_INPUT(pins[C], state); pins[C] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
+    void ProcessUpdateD(TriState_t state) { PROFILE_INPUT(pins[D], state); pins[D] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
+    void ProcessUpdateE(TriState_t state) { PROFILE_INPUT(pins[E], state); pins[E] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
+    void ProcessUpdateF(TriState_t state) { PROFILE_INPUT(pins[F], state); pins[F] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
+    void ProcessUpdateG(TriState_t state) { PROFILE_INPUT(pins[G], state); pins[G] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
+    void ProcessUpdateH(TriState_t state) { PROFILE_INPUT(pins[H], state); pins[H] = state; if (pins[SH_LD] == LOW) ProcessNewPin(); }
+    void ProcessUpdateSer(TriState_t state) { PROFILE_INPUT(pins[SER], state); pins[SER] = state; }
+    void ProcessUpdateClk(TriState_t state) { PROFILE_INPUT(pins[CLK], state); pins[CLK] = state; ProcessClock(); }
+    void ProcessUpdateClkInh(TriState_t state) { PROFILE_INPUT(pins[CLK_INH], state); pins[CLK_INH] = state; ProcessClock(); }
+    void ProcessUpdateShLd(TriState_t state) { PROFILE_INPUT(pins[SH_LD], state); pins[SH_LD] = state; ProcessNewPin(); };
 
 
 
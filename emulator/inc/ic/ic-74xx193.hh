@@ -49,17 +49,23 @@ public:
 
 public:
     void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & cnt & pins & lastUp & lastDown; }
+    void PresetCount(int count);            // jump straight to a count without clocking or loading
+
+
+private:
+    void UpdateOutputs(void);
 
 
 public slots:
-    void ProcessUpdateB(TriState_t state) { pins[B] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateDown(TriState_t state) { lastDown = pins[DOWN]; pins[DOWN] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateUp(TriState_t state) { lastUp = pins[UP]; pins[UP] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateD(TriState_t state) { pins[D] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateC(TriState_t state) { pins[C] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateLoad(TriState_t state) { pins[LOADb] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateClr(TriState_t state) { pins[CLR] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateA(TriState_t state) { pins[A] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateB(TriState_t state) { PROFILE_INPUT(pins[B], state); pins[B] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateDown(TriState_t state) { PROFILE_INPUT(pins[DOWN], state); lastDown = pins[DOWN]; pins[DOWN] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateUp(TriState_t state) { PROFILE_INPUT(pins[UP], state); lastUp = pins[UP]; pins[UP] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateD(TriState_t state) { PROFILE_INPUT(pins[D], state); pins[D] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateC(TriState_t state) { PROFILE_INPUT(pins[C], state); pins[C] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateLoad(TriState_t state) { PROFILE_INPUT(pins[LOADb], state); pins[LOADb] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateClr(TriState_t state) { PROFILE_INPUT(pins[CLR], state); pins[CLR] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateA(TriState_t state) { PROFILE_INPUT(pins[A], state); pins[A] = state; ProcessUpdatesComplete(); }
     void ProcessUpdatesComplete(void);
 
 signals:
@@ -16,7 +16,7 @@
 //
 // -- This class implements a 74xx238 Demultiplexer
 //    ---------------------------------------------
-class IC_74xx238_t : public QObject {
+class IC_74xx238_t : public QObject, public HW_Netlist_t::Component_t {
     Q_OBJECT
 
 public:
@@ -48,15 +48,22 @@ public:
 
 public:
     void TriggerFirstUpdate(void) { ProcessUpdatesComplete(); }
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & pins; }
+    virtual void EvaluateLanes(void) override;
+
+
+protected:
+    virtual void Compute(void) override;
+    virtual void Update(void) override { ProcessUpdatesComplete(); }
 
 
 public slots:
-    void ProcessUpdateA(TriState_t state) { pins[A] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateB(TriState_t state) { pins[B] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateC(TriState_t state) { pins[C] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateG1(TriState_t state) { pins[G1] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateG2A(TriState_t state) { pins[G2Ab] = state; ProcessUpdatesComplete(); }
-    void ProcessUpdateG2B(TriState_t state) { pins[G2Bb] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateA(TriState_t state) { PROFILE_INPUT(pins[A], state); pins[A] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateB(TriState_t state) { PROFILE_INPUT(pins[B], state); pins[B] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateC(TriState_t state) { PROFILE_INPUT(pins[C], state); pins[C] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateG1(TriState_t state) { PROFILE_INPUT(pins[G1], state); pins[G1] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateG2A(TriState_t state) { PROFILE_INPUT(pins[G2Ab], state); pins[G2Ab] = state; ProcessUpdatesComplete(); }
+    void ProcessUpdateG2B(TriState_t state) { PROFILE_INPUT(pins[G2Bb], state); pins[G2Bb] = state; ProcessUpdatesComplete(); }
     void ProcessUpdatesComplete(void);
 
 
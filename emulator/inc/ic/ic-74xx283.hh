@@ -16,7 +16,7 @@
 //
 // -- This class implements a 74xx283 Full Adder
 //    ------------------------------------------
-class IC_74xx283_t : public QObject {
+class IC_74xx283_t : public QObject, public HW_Netlist_t::Component_t {
     Q_OBJECT
 
 public:
@@ -50,6 +50,13 @@ public:
 
 public:
     void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & a & b & sum & pins & output; }
+    virtual void EvaluateLanes(void) override;
+
+
+protected:
+    virtual void Compute(void) override;
+    virtual void Update(void) override { UpdateSum(); }
 
 
 private:
@@ -57,15 +64,19 @@ private:
 
 
 public slots:
-    void ProcessCInUpdate(TriState_t state) { pins[CIN] = state; UpdateSum(); }
-    void ProcessA0Update(TriState_t state) { pins[A0] = state; UpdateSum(); }
-    void ProcessB0Update(TriState_t state) { pins[B0] = state; UpdateSum(); }
-    void ProcessA1Update(TriState_t state) { output = true; pins[A1] = state; UpdateSum(); output = false; }
-    void ProcessB1Update(TriState_t state) { pins[B1] = state; UpdateSum(); }
-    void ProcessA2Update(TriState_t state) { pins[A2] = state; UpdateSum(); }
-    void ProcessB2Update(TriState_t state) { pins[B2] = state; UpdateSum(); }
-    void ProcessA3Update(TriState_t state) { pins[A3] = state; UpdateSum(); }
-    void ProcessB3Update(TriState_t state) { pins[B3] = state; UpdateSum(); }
+    void ProcessCInUpdate(TriState_t state) { PROFILE_INPUT(pins[CIN], state); pins[CIN] = state; UpdateSum(); }
+    void ProcessA0Update(TriState_t state) { PROFILE_INPUT(pins[A0], state); pins[A0] = state; UpdateSum(); }
+    void ProcessB0Update(TriState_t state) { PROFILE_INPUT(pins[B0], state); pins[B0] = state; UpdateSum(); }
+    void ProcessA1Update(TriState_t state) { PROFILE_INPUT(pins[A1], state); output = true; pins[A1] = state; UpdateSum(); output = false; }
+    void ProcessB1Update(TriState_t state) { PROFILE_INPUT(pins[B1], state); pins[B1] = state; UpdateSum(); }
+    void ProcessA2Update(TriState_t state) { PROFILE_INPUT(pins[A2], state); pins[A2] = state; UpdateSum(); }
+    void ProcessB2Update(TriState_t state) { PROFILE_INPUT(pins[B2], state); pins[B2] = state; UpdateSum(); }
+    void ProcessA3Update(TriState_t state) { PROFILE_INPUT(pins[A3], state); pins[A3] = state; UpdateSum(); }
+    void ProcessB3Update(TriState_t state) { PROFILE_INPUT(pins[B3], state); pins[B3] = state; UpdateSum(); }
+
+    // -- update all 4 bits of one input at once (the upper nibble is ignored)
+    void ProcessAUpdate(uint8_t val);
+    void ProcessBUpdate(uint8_t val);
 
 
 signals:
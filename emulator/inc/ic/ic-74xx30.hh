@@ -42,18 +42,19 @@ public:
 
 public:
     void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & pins; }
 
 
 public slots:
     // -- Gate #1 slots
-    void ProcessUpdateA(TriState_t state) { if (state != pins[A]) { pins[A] = state; ProcessUpdateGate(); } }
-    void ProcessUpdateB(TriState_t state) { if (state != pins[B]) { pins[B] = state; ProcessUpdateGate(); } }
-    void ProcessUpdateC(TriState_t state) { if (state != pins[C]) { pins[C] = state; ProcessUpdateGate(); } }
-    void ProcessUpdateD(TriState_t state) { if (state != pins[D]) { pins[D] = state; ProcessUpdateGate(); } }
-    void ProcessUpdateE(TriState_t state) { if (state != pins[E]) { pins[E] = state; ProcessUpdateGate(); } }
-    void ProcessUpdateF(TriState_t state) { if (state != pins[F]) { pins[F] = state; ProcessUpdateGate(); } }
-    void ProcessUpdateG(TriState_t state) { if (state != pins[G]) { pins[G] = state; ProcessUpdateGate(); } }
-    void ProcessUpdateH(TriState_t state) { if (state != pins[H]) { pins[H] = state; ProcessUpdateGate(); } }
+    void ProcessUpdateA(TriState_t state) { PROFILE_INPUT(pins[A], state); if (state != pins[A]) { pins[A] = state; ProcessUpdateGate(); } }
+    void ProcessUpdateB(TriState_t state) { PROFILE_INPUT(pins[B], state); if (state != pins[B]) { pins[B] = state; ProcessUpdateGate(); } }
+    void ProcessUpdateC(TriState_t state) { PROFILE_INPUT(pins[C], state); if (state != pins[C]) { pins[C] = state; ProcessUpdateGate(); } }
+    void ProcessUpdateD(TriState_t state) { PROFILE_INPUT(pins[D], state); if (state != pins[D]) { pins[D] = state; ProcessUpdateGate(); } }
+    void ProcessUpdateE(TriState_t state) { PROFILE_INPUT(pins[E], state); if (state != pins[E]) { pins[E] = state; ProcessUpdateGate(); } }
+    void ProcessUpdateF(TriState_t state) { PROFILE_INPUT(pins[F], state); if (state != pins[F]) { pins[F] = state; ProcessUpdateGate(); } }
+    void ProcessUpdateG(TriState_t state) { PROFILE_INPUT(pins[G], state); if (state != pins[G]) { pins[G] = state; ProcessUpdateGate(); } }
+    void ProcessUpdateH(TriState_t state) { PROFILE_INPUT(pins[H], state); if (state != pins[H]) { pins[H] = state; ProcessUpdateGate(); } }
     void ProcessALow(void)  { ProcessUpdateA(LOW); }
     void ProcessAHigh(void) { ProcessUpdateA(HIGH); }
     void ProcessBLow(void)  { ProcessUpdateB(LOW); }
@@ -51,20 +51,21 @@ public:
 
 public:
     void TriggerFirstUpdate(void) { UpdateOutputs(); }
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & pins; }
     void UpdateOutputs(void);
 
 
 public slots:
-    void ProcessUpdateOE1(TriState_t state) { pins[OE1b] = state; UpdateOutputs(); }
-    void ProcessUpdateOE2(TriState_t state) { pins[OE2b] = state; UpdateOutputs(); }
-    void ProcessUpdateD0(TriState_t state) { pins[D0] = state; UpdateOutputs(); }
-    void ProcessUpdateD1(TriState_t state) { pins[D1] = state; UpdateOutputs(); }
-    void ProcessUpdateD2(TriState_t state) { pins[D2] = state; UpdateOutputs(); }
-    void ProcessUpdateD3(TriState_t state) { pins[D3] = state; UpdateOutputs(); }
-    void ProcessUpdateD4(TriState_t state) { pins[D4] = state; UpdateOutputs(); }
-    void ProcessUpdateD5(TriState_t state) { pins[D5] = state; UpdateOutputs(); }
-    void ProcessUpdateD6(TriState_t state) { pins[D6] = state; UpdateOutputs(); }
-    void ProcessUpdateD7(TriState_t state) { pins[D7] = state; UpdateOutputs(); }
+    void ProcessUpdateOE1(TriState_t state) { PROFILE_INPUT(pins[OE1b], state); pins[OE1b] = state; UpdateOutputs(); }
+    void ProcessUpdateOE2(TriState_t state) { PROFILE_INPUT(pins[OE2b], state); pins[OE2b] = state; UpdateOutputs(); }
+    void ProcessUpdateD0(TriState_t state) { PROFILE_INPUT(pins[D0], state); pins[D0] = state; UpdateOutputs(); }
+    void ProcessUpdateD1(TriState_t state) { PROFILE_INPUT(pins[D1], state); pins[D1] = state; UpdateOutputs(); }
+    void ProcessUpdateD2(TriState_t state) { PROFILE_INPUT(pins[D2], state); pins[D2] = state; UpdateOutputs(); }
+    void ProcessUpdateD3(TriState_t state) { PROFILE_INPUT(pins[D3], state); pins[D3] = state; UpdateOutputs(); }
+    void ProcessUpdateD4(TriState_t state) { PROFILE_INPUT(pins[D4], state); pins[D4] = state; UpdateOutputs(); }
+    void ProcessUpdateD5(TriState_t state) { PROFILE_INPUT(pins[D5], state); pins[D5] = state; UpdateOutputs(); }
+    void ProcessUpdateD6(TriState_t state) { PROFILE_INPUT(pins[D6], state); pins[D6] = state; UpdateOutputs(); }
+    void ProcessUpdateD7(TriState_t state) { PROFILE_INPUT(pins[D7], state); pins[D7] = state; UpdateOutputs(); }
 
 
 signals:
@@ -61,18 +61,26 @@ public:
 
 public:
     void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & pins & d1 & d2 & d3 & d4 & d5 & d6 & d7 & d8; }
+
+
+private:
+    // -- the D/Q lines as a byte; D8/Q8 is bit 0 and D1/Q1 is bit 7, which is how the latches are wired to the buses
+    uint8_t QWord(void) const;
+    uint8_t DriveMask(void) const { return (pins[OEb] == HIGH) ? 0x00 : 0xff; }
 
 
 public slots:
     void ProcessUpdateOE(TriState_t state);
-    void ProcessUpdateD1(TriState_t state) { pins[D1] = state; }
-    void ProcessUpdateD2(TriState_t state) { pins[D2] = state; }
-    void ProcessUpdateD3(TriState_t state) { pins[D3] = state; }
-    void ProcessUpdateD4(TriState_t state) { pins[D4] = state; }
-    void ProcessUpdateD5(TriState_t state) { pins[D5] = state; }
-    void ProcessUpdateD6(TriState_t state) { pins[D6] = state; }
-    void ProcessUpdateD7(TriState_t state) { pins[D7] = state; }
-    void ProcessUpdateD8(TriState_t state) { pins[D8] = state; }
+    void ProcessUpdateD1(TriState_t state) { PROFILE_INPUT(pins[D1], state); pins[D1] = state; }
+    void ProcessUpdateD2(TriState_t state) { PROFILE_INPUT(pins[D2], state); pins[D2] = state; }
+    void ProcessUpdateD3(TriState_t state) { PROFILE_INPUT(pins[D3], state); pins[D3] = state; }
+    void ProcessUpdateD4(TriState_t state) { PROFILE_INPUT(pins[D4], state); pins[D4] = state; }
+    void ProcessUpdateD5(TriState_t state) { PROFILE_INPUT(pins[D5], state); pins[D5] = state; }
+    void ProcessUpdateD6(TriState_t state) { PROFILE_INPUT(pins[D6], state); pins[D6] = state; }
+    void ProcessUpdateD7(TriState_t state) { PROFILE_INPUT(pins[D7], state); pins[D7] = state; }
+    void ProcessUpdateD8(TriState_t state) { PROFILE_INPUT(pins[D8], state); pins[D8] = state; }
+    void ProcessUpdateDWord(uint8_t d);
     void ProcessUpdateClockLatch(TriState_t state);
     void ProcessUpdateClockOutput(TriState_t state);
 
@@ -86,6 +94,8 @@ signals:
     void SignalQ6Updated(TriState_t state);
     void SignalQ7Updated(TriState_t state);
     void SignalQ8Updated(TriState_t state);
+
+    void SignalQWordUpdated(uint8_t q, uint8_t drive);
 };
 
 
@@ -52,16 +52,17 @@ public:
 
 public:
     void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & pins & d1 & d2 & lastClk1 & lastClk2; }
 
 
 public slots:
     void ProcessUpdateClr1(TriState_t state);
-    void ProcessUpdateD1(TriState_t state) { pins[D1] = state; }
+    void ProcessUpdateD1(TriState_t state) { PROFILE_INPUT(pins[D1], state); pins[D1] = state; }
     void ProcessUpdateClockLatch1(TriState_t state);
     void ProcessUpdateClockOutput1(TriState_t state);
     void ProcessUpdatePre1(TriState_t state);
     void ProcessUpdateClr2(TriState_t state);
-    void ProcessUpdateD2(TriState_t state) { pins[D2] = state; }
+    void ProcessUpdateD2(TriState_t state) { PROFILE_INPUT(pins[D2], state); pins[D2] = state; }
     void ProcessUpdateClockLatch2(TriState_t state);
     void ProcessUpdateClockOutput2(TriState_t state);
     void ProcessUpdatePre2(TriState_t state);
@@ -53,6 +53,12 @@ public:
         WEb = 27,
     };
 
+    enum {
+        SIZE = 32 * 1024,
+        PAGE_SIZE = 256,                    // the sanity check compares only the pages written since the last one
+        PAGE_CNT = SIZE / PAGE_SIZE,
+    };
+
 
 private:
     enum {
@@ -74,7 +80,16 @@ private:
 
 private:
     TriState_t pins[PIN_CNT(28)];
-    uint8_t contents[32*1024];  // this is the RAM contents
+    uint8_t contents[SIZE];     // this is the RAM contents
+
+
+    // -- What the sanity check needs to look at.  The hash covers the whole RAM and is kept up to date with every
+    //    write; when it agrees with the reference ROM's hash, only the dirty pages need a byte compare.
+    uint64_t dirty[PAGE_CNT / 64];
+    uint64_t hash;
+    uint64_t refHash;
+    unsigned refGeneration;     // the generation of the reference image `refHash` was taken from
+    bool fullCheck;             // the next check compares everything
 
 
     // -- These hold the incoming value in case an update is needed later
@@ -103,6 +118,11 @@ public:
 
 public:
     void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) {
+        s & outputting & outputValue & pins & contents;
+        s & hold0 & hold1 & hold2 & hold3 & hold4 & hold5 & hold6 & hold7 & lastCE & lastWE & lastOE & updating;
+        if (s.IsRestoring()) Rehash();
+    }
 
 
 
@@ -114,41 +134,53 @@ private:
 
     bool StatusChange(void) { return (pins[CEb] != lastCE) || (pins[WEb] != lastWE) || (pins[OEb] != lastOE); }
 
+    // -- each byte's contribution to the hash depends on its address, so the hash can be updated one byte at a time
+    static uint64_t Mix(int addr, uint8_t byte) {
+        uint64_t x = (((uint64_t)addr << 8) | byte) * 0x9e3779b97f4a7c15ull;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    }
+
+    static uint64_t Hash(const uint8_t *data);
+    void Rehash(void);
+    int FirstDifference(const uint8_t *rom, bool all);
+
 
 
 public slots:
-    void ProcessUpdateA0(TriState_t state)  { pins[ A0] = state; UpdateAll(); }
-    void ProcessUpdateA1(TriState_t state)  { pins[ A1] = state; UpdateAll(); }
-    void ProcessUpdateA2(TriState_t state)  { pins[ A2] = state; UpdateAll(); }
-    void ProcessUpdateA3(TriState_t state)  { pins[ A3] = state; UpdateAll(); }
-    void ProcessUpdateA4(TriState_t state)  { pins[ A4] = state; UpdateAll(); }
-    void ProcessUpdateA5(TriState_t state)  { pins[ A5] = state; UpdateAll(); }
-    void ProcessUpdateA6(TriState_t state)  { pins[ A6] = state; UpdateAll(); }
-    void ProcessUpdateA7(TriState_t state)  { pins[ A7] = state; UpdateAll(); }
-    void ProcessUpdateA8(TriState_t state)  { pins[ A8] = state; UpdateAll(); }
-    void ProcessUpdateA9(TriState_t state)  { pins[ A9] = state; UpdateAll(); }
-    void ProcessUpdateA10(TriState_t state) { pins[A10] = state; UpdateAll(); }
-    void ProcessUpdateA11(TriState_t state) { pins[A11] = state; UpdateAll(); }
-    void ProcessUpdateA12(TriState_t state) { pins[A12] = state; UpdateAll(); }
-    void ProcessUpdateA13(TriState_t state) { pins[A13] = state; UpdateAll(); }
-    void ProcessUpdateA14(TriState_t state) { pins[A14] = state; UpdateAll(); }
-
-    void ProcessUpdateCE(TriState_t state) { pins[CEb] = state; UpdateAll(); }
-    void ProcessUpdateOE(TriState_t state) { pins[OEb] = state; UpdateAll(); }
-    void ProcessUpdateWE(TriState_t state) { pins[WEb] = state; UpdateAll(); }
-
-    void ProcessUpdateDq0(TriState_t state)  { hold0 = state; UpdateAll(); }
-    void ProcessUpdateDq1(TriState_t state)  { hold1 = state; UpdateAll(); }
-    void ProcessUpdateDq2(TriState_t state)  { hold2 = state; UpdateAll(); }
-    void ProcessUpdateDq3(TriState_t state)  { hold3 = state; UpdateAll(); }
-    void ProcessUpdateDq4(TriState_t state)  { hold4 = state; UpdateAll(); }
-    void ProcessUpdateDq5(TriState_t state)  { hold5 = state; UpdateAll(); }
-    void ProcessUpdateDq6(TriState_t state)  { hold6 = state; UpdateAll(); }
-    void ProcessUpdateDq7(TriState_t state)  { hold7 = state; UpdateAll(); }
-
-
-    void ProcessSanityCheck(QString name);
-    void CopyEeprom(void);
+    void ProcessUpdateA0(TriState_t state)  { PROFILE_INPUT(pins[ A0], state); pins[ A0] = state; UpdateAll(); }
+    void ProcessUpdateA1(TriState_t state)  { PROFILE_INPUT(pins[ A1], state); pins[ A1] = state; UpdateAll(); }
+    void ProcessUpdateA2(TriState_t state)  { PROFILE_INPUT(pins[ A2], state); pins[ A2] = state; UpdateAll(); }
+    void ProcessUpdateA3(TriState_t state)  { PROFILE_INPUT(pins[ A3], state); pins[ A3] = state; UpdateAll(); }
+    void ProcessUpdateA4(TriState_t state)  { PROFILE_INPUT(pins[ A4], state); pins[ A4] = state; UpdateAll(); }
+    void ProcessUpdateA5(TriState_t state)  { PROFILE_INPUT(pins[ A5], state); pins[ A5] = state; UpdateAll(); }
+    void ProcessUpdateA6(TriState_t state)  { PROFILE_INPUT(pins[ A6], state); pins[ A6] = state; UpdateAll(); }
+    void ProcessUpdateA7(TriState_t state)  { PROFILE_INPUT(pins[ A7], state); pins[ A7] = state; UpdateAll(); }
+    void ProcessUpdateA8(TriState_t state)  { PROFILE_INPUT(pins[ A8], state); pins[ A8] = state; UpdateAll(); }
+    void ProcessUpdateA9(TriState_t state)  { PROFILE_INPUT(pins[ A9], state); pins[ A9] = state; UpdateAll(); }
+    void ProcessUpdateA10(TriState_t state) { PROFILE_INPUT(pins[A10], state); pins[A10] = state; UpdateAll(); }
+    void ProcessUpdateA11(TriState_t state) { PROFILE_INPUT(pins[A11], state); pins[A11] = state; UpdateAll(); }
+    void ProcessUpdateA12(TriState_t state) { PROFILE_INPUT(pins[A12], state); pins[A12] = state; UpdateAll(); }
+    void ProcessUpdateA13(TriState_t state) { PROFILE_INPUT(pins[A13], state); pins[A13] = state; UpdateAll(); }
+    void ProcessUpdateA14(TriState_t state) { PROFILE_INPUT(pins[A14], state); pins[A14] = state; UpdateAll(); }
+
+    void ProcessUpdateCE(TriState_t state) { PROFILE_INPUT(pins[CEb], state); pins[CEb] = state; UpdateAll(); }
+    void ProcessUpdateOE(TriState_t state) { PROFILE_INPUT(pins[OEb], state); pins[OEb] = state; UpdateAll(); }
+    void ProcessUpdateWE(TriState_t state) { PROFILE_INPUT(pins[WEb], state); pins[WEb] = state; UpdateAll(); }
+
+    void ProcessUpdateDq0(TriState_t state)  { PROFILE_INPUT(hold0, state); hold0 = state; UpdateAll(); }
+    void ProcessUpdateDq1(TriState_t state)  { PROFILE_INPUT(hold1, state); hold1 = state; UpdateAll(); }
+    void ProcessUpdateDq2(TriState_t state)  { PROFILE_INPUT(hold2, state); hold2 = state; UpdateAll(); }
+    void ProcessUpdateDq3(TriState_t state)  { PROFILE_INPUT(hold3, state); hold3 = state; UpdateAll(); }
+    void ProcessUpdateDq4(TriState_t state)  { PROFILE_INPUT(hold4, state); hold4 = state; UpdateAll(); }
+    void ProcessUpdateDq5(TriState_t state)  { PROFILE_INPUT(hold5, state); hold5 = state; UpdateAll(); }
+    void ProcessUpdateDq6(TriState_t state)  { PROFILE_INPUT(hold6, state); hold6 = state; UpdateAll(); }
+    void ProcessUpdateDq7(TriState_t state)  { PROFILE_INPUT(hold7, state); hold7 = state; UpdateAll(); }
+
+
+    void ProcessSanityCheck(QString name, bool full = false);
+    bool CopyEeprom(void);
 
 
 signals:
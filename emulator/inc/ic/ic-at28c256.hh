@@ -60,7 +60,7 @@ private:
 
 private:
     TriState_t pins[PIN_CNT(28)];
-    uint8_t contents[32*1024];  // this is the RAM contents
+    HW_RomImage_t *image;       // this is the rom image, shared with any other IC loading the same file
 
 
     TriState_t lastCE;
@@ -68,13 +68,14 @@ private:
 
 
 public:
-    IC_at28c256_t(const QString &file                                            );
-    virtual ~IC_at28c256_t() {}
+    IC_at28c256_t(const QString &file);
+    virtual ~IC_at28c256_t() { HW_RomImage_t::Release(image); }
 
 
 
 public:
     void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & outputValue & pins & lastCE & lastOE; }
 
 
 
@@ -88,24 +89,25 @@ private:
 
 
 public slots:
-    void ProcessUpdateA0(TriState_t state)  { pins[ A0] = state; UpdateAll(); }
-    void ProcessUpdateA1(TriState_t state)  { pins[ A1] = state; UpdateAll(); }
-    void ProcessUpdateA2(TriState_t state)  { pins[ A2] = state; UpdateAll(); }
-    void ProcessUpdateA3(TriState_t state)  { pins[ A3] = state; UpdateAll(); }
-    void ProcessUpdateA4(TriState_t state)  { pins[ A4] = state; UpdateAll(); }
-    void ProcessUpdateA5(TriState_t state)  { pins[ A5] = state; UpdateAll(); }
-    void ProcessUpdateA6(TriState_t state)  { pins[ A6] = state; UpdateAll(); }
-    void ProcessUpdateA7(TriState_t state)  { pins[ A7] = state; UpdateAll(); }
-    void ProcessUpdateA8(TriState_t state)  { pins[ A8] = state; UpdateAll(); }
-    void ProcessUpdateA9(TriState_t state)  { pins[ A9] = state; UpdateAll(); }
-    void ProcessUpdateA10(TriState_t state) { pins[A10] = state; UpdateAll(); }
-    void ProcessUpdateA11(TriState_t state) { pins[A11] = state; UpdateAll(); }
-    void ProcessUpdateA12(TriState_t state) { pins[A12] = state; UpdateAll(); }
-    void ProcessUpdateA13(TriState_t state) { pins[A13] = state; UpdateAll(); }
-    void ProcessUpdateA14(TriState_t state) { pins[A14] = state; UpdateAll(); }
-
-    void ProcessUpdateCE(TriState_t state) { pins[CEb] = state; UpdateAll(); }
-    void ProcessUpdateOE(TriState_t state) { pins[OEb] = state; UpdateAll(); }
+    void ProcessUpdateA0(TriState_t state)  { PROFILE_INPUT(pins[ A0], state); pins[ A0] = state; UpdateAll(); }
+    void ProcessUpdateA1(TriState_t state)  { PROFILE_INPUT(pins[ A1], state); pins[ A1] = state; UpdateAll(); }
+    void ProcessUpdateA2(TriState_t state)  { PROFILE_INPUT(pins[ A2], state); pins[ A2] = state; UpdateAll(); }
+    void ProcessUpdateA3(TriState_t state)  { PROFILE_INPUT(pins[ A3], state); pins[ A3] = state; UpdateAll(); }
+    void ProcessUpdateA4(TriState_t state)  { PROFILE_INPUT(pins[ A4], state); pins[ A4] = state; UpdateAll(); }
+    void ProcessUpdateA5(TriState_t state)  { PROFILE_INPUT(pins[ A5], state); pins[ A5] = state; UpdateAll(); }
+    void ProcessUpdateA6(TriState_t state)  { PROFILE_INPUT(pins[ A6], state); pins[ A6] = state; UpdateAll(); }
+    void ProcessUpdateA7(TriState_t state)  { PROFILE_INPUT(pins[ A7], state); pins[ A7] = state; UpdateAll(); }
+    void ProcessUpdateA8(TriState_t state)  { PROFILE_INPUT(pins[ A8], state); pins[ A8] = state; UpdateAll(); }
+    void ProcessUpdateA9(TriState_t state)  { PROFILE_INPUT(pins[ A9], state); pins[ A9] = state; UpdateAll(); }
+    void ProcessUpdateA10(TriState_t state) { PROFILE_INPUT(pins[A10], state); pins[A10] = state; UpdateAll(); }
+    void ProcessUpdateA11(TriState_t state) { PROFILE_INPUT(pins[A11], state); pins[A11] = state; UpdateAll(); }
+    void ProcessUpdateA12(TriState_t state) { PROFILE_INPUT(pins[A12], state); pins[A12] = state; UpdateAll(); }
+    void ProcessUpdateA13(TriState_t state) { PROFILE_INPUT(pins[A13], state); pins[A13] = state; UpdateAll(); }
+    void ProcessUpdateA14(TriState_t state) { PROFILE_INPUT(pins[A14], state); pins[A14] = state; UpdateAll(); }
+    void ProcessUpdateAddr(uint16_t addr);
+
+    void ProcessUpdateCE(TriState_t state) { PROFILE_INPUT(pins[CEb], state); pins[CEb] = state; UpdateAll(); }
+    void ProcessUpdateOE(TriState_t state) { PROFILE_INPUT(pins[OEb], state); pins[OEb] = state; UpdateAll(); }
 
 
 signals:
@@ -117,5 +119,7 @@ signals:
     void SignalDq5Updated(TriState_t state);
     void SignalDq6Updated(TriState_t state);
     void SignalDq7Updated(TriState_t state);
+
+    void SignalDqWordUpdated(uint8_t dq, uint8_t drive);
 };
 
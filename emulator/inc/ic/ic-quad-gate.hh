@@ -0,0 +1,199 @@
+//===================================================================================================================
+// ic-quad-gate.hh -- The quad two-input gate ICs (74xx00, 02, 03, 08, 32, 86), all built from one template
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  The inputs of all four gates are packed into two bytes: `high` has a bit set for each input which is HIGH and
+//  `low` for each which is LOW (an input in neither is Z).  Input A of gate n is bit n and input B is bit n + 4,
+//  so each truth function evaluates all four gates at once in a couple of bitwise operations, with A of every
+//  gate in the low nibble and B of every gate in the high nibble.
+//
+//  A truth function returns the outputs packed the same way: bit n is set when gate n drives HIGH and bit n + 4
+//  when it drives LOW; an output in neither is Z (which is how the open drain 74xx03 lets go).
+//
+//  The slots and signals live in `IC_QuadGateBase_t`, since Qt cannot put them in a template.  The template
+//  `IC_QuadGate_t<Op>` supplies the evaluation, so the truth function is inlined into each IC.  The ICs
+//  themselves only add their pin-out and their state at power on.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#pragma once
+
+
+
+//
+// -- The truth functions: the packed inputs in, the packed outputs out
+//    -----------------------------------------------------------------
+struct IC_QuadNand_t {
+    static constexpr uint8_t Eval(uint8_t high, uint8_t) {
+        uint8_t y = high & (high >> 4) & 0x0f;
+        return (~y & 0x0f) | (y << 4);
+    }
+};
+
+struct IC_QuadNor_t {
+    static constexpr uint8_t Eval(uint8_t high, uint8_t) {
+        uint8_t y = (high | (high >> 4)) & 0x0f;
+        return (~y & 0x0f) | (y << 4);
+    }
+};
+
+struct IC_QuadAnd_t {
+    static constexpr uint8_t Eval(uint8_t high, uint8_t) {
+        uint8_t y = high & (high >> 4) & 0x0f;
+        return y | ((~y & 0x0f) << 4);
+    }
+};
+
+struct IC_QuadOr_t {
+    static constexpr uint8_t Eval(uint8_t high, uint8_t) {
+        uint8_t y = (high | (high >> 4)) & 0x0f;
+        return y | ((~y & 0x0f) << 4);
+    }
+};
+
+// -- an input which is Z is neither HIGH nor LOW, so it can never make the inputs differ
+struct IC_QuadXor_t {
+    static constexpr uint8_t Eval(uint8_t high, uint8_t low) {
+        uint8_t y = ((high & (low >> 4)) | (low & (high >> 4))) & 0x0f;
+        return y | ((~y & 0x0f) << 4);
+    }
+};
+
+// -- open drain: it only ever pulls LOW, and lets go otherwise
+struct IC_QuadNandOd_t {
+    static constexpr uint8_t Eval(uint8_t high, uint8_t) {
+        uint8_t y = high & (high >> 4) & 0x0f;
+        return y << 4;
+    }
+};
+
+static_assert(IC_QuadNand_t::Eval(0xff, 0x00) == 0xf0, "NAND of all HIGH inputs must drive all LOW");
+static_assert(IC_QuadXor_t::Eval(0x01, 0x10) == 0xe1, "XOR of HIGH and LOW must drive HIGH");
+static_assert(IC_QuadXor_t::Eval(0x01, 0x00) == 0xf0, "XOR with a Z input must drive LOW");
+static_assert(IC_QuadNandOd_t::Eval(0x00, 0xff) == 0x00, "an open drain NAND must let go when it is not LOW");
+
+
+
+//
+// -- The slots, signals and state every quad gate IC has
+//    ---------------------------------------------------
+class IC_QuadGateBase_t : public QObject {
+    Q_OBJECT
+
+protected:
+    uint8_t high;                           // the inputs which are HIGH: A of gate n in bit n, B in bit n + 4
+    uint8_t low;                            // the inputs which are LOW, the same way; an input in neither is Z
+    uint8_t out;                            // the outputs driven HIGH in bits 0-3 and LOW in bits 4-7
+
+
+protected:
+    IC_QuadGateBase_t(TriState_t in, TriState_t y);
+    virtual ~IC_QuadGateBase_t() {};
+
+    virtual void Evaluate(void) = 0;
+    void EmitGate(int gate);
+
+
+protected:
+    TriState_t Input(int bit) const { return (high >> bit) & 1 ? HIGH : ((low >> bit) & 1 ? LOW : Z); }
+    TriState_t Output(int gate) const { return (out >> gate) & 1 ? HIGH : ((out >> (gate + 4)) & 1 ? LOW : Z); }
+
+    void SetInput(int bit, TriState_t state) {
+        uint8_t mask = 1 << bit;
+        uint8_t h = (state == HIGH ? high | mask : high & ~mask);
+        uint8_t l = (state == LOW ? low | mask : low & ~mask);
+
+        if (h == high && l == low) return;
+
+        high = h;
+        low = l;
+        Evaluate();
+    }
+
+
+public:
+    void TriggerFirstUpdate(void);
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & high & low & out; }
+
+
+public slots:
+    // -- Gate #1 slots
+    void ProcessUpdateA1(TriState_t state) { PROFILE_INPUT(Input(0), state); SetInput(0, state); }
+    void ProcessUpdateB1(TriState_t state) { PROFILE_INPUT(Input(4), state); SetInput(4, state); }
+    void ProcessA1Low(void)  { ProcessUpdateA1(LOW); }
+    void ProcessA1High(void) { ProcessUpdateA1(HIGH); }
+    void ProcessB1Low(void)  { ProcessUpdateB1(LOW); }
+    void ProcessB1High(void) { ProcessUpdateB1(HIGH); }
+
+    // -- Gate #2 slots
+    void ProcessUpdateA2(TriState_t state) { PROFILE_INPUT(Input(1), state); SetInput(1, state); }
+    void ProcessUpdateB2(TriState_t state) { PROFILE_INPUT(Input(5), state); SetInput(5, state); }
+    void ProcessA2Low(void)  { ProcessUpdateA2(LOW); }
+    void ProcessA2High(void) { ProcessUpdateA2(HIGH); }
+    void ProcessB2Low(void)  { ProcessUpdateB2(LOW); }
+    void ProcessB2High(void) { ProcessUpdateB2(HIGH); }
+
+    // -- Gate #3 slots
+    void ProcessUpdateA3(TriState_t state) { PROFILE_INPUT(Input(2), state); SetInput(2, state); }
+    void ProcessUpdateB3(TriState_t state) { PROFILE_INPUT(Input(6), state); SetInput(6, state); }
+    void ProcessA3Low(void)  { ProcessUpdateA3(LOW); }
+    void ProcessA3High(void) { ProcessUpdateA3(HIGH); }
+    void ProcessB3Low(void)  { ProcessUpdateB3(LOW); }
+    void ProcessB3High(void) { ProcessUpdateB3(HIGH); }
+
+    // -- Gate #4 slots
+    void ProcessUpdateA4(TriState_t state) { PROFILE_INPUT(Input(3), state); SetInput(3, state); }
+    void ProcessUpdateB4(TriState_t state) { PROFILE_INPUT(Input(7), state); SetInput(7, state); }
+    void ProcessA4Low(void)  { ProcessUpdateA4(LOW); }
+    void ProcessA4High(void) { ProcessUpdateA4(HIGH); }
+    void ProcessB4Low(void)  { ProcessUpdateB4(LOW); }
+    void ProcessB4High(void) { ProcessUpdateB4(HIGH); }
+
+
+    // -- Lots of things changed, update everything
+    void UpdatesComplete(void) { Evaluate(); }
+
+
+signals:
+    void SignalY1Updated(TriState_t state);
+    void SignalY2Updated(TriState_t state);
+    void SignalY3Updated(TriState_t state);
+    void SignalY4Updated(TriState_t state);
+};
+
+
+
+//
+// -- A quad gate IC evaluated by the truth function `Op`
+//    ---------------------------------------------------
+template <typename Op>
+class IC_QuadGate_t : public IC_QuadGateBase_t {
+protected:
+    IC_QuadGate_t(TriState_t in, TriState_t y) : IC_QuadGateBase_t(in, y) {}
+    virtual ~IC_QuadGate_t() {};
+
+
+protected:
+    //
+    // -- Evaluate all four gates and emit the ones which changed, in gate order.  The outputs are evaluated
+    //    again after each emit, since the emit may have fed back into this IC's own inputs.
+    //    ---------------------------------------------------------------------------------------------------
+    virtual void Evaluate(void) override final {
+        uint8_t changed;
+
+        while ((changed = Op::Eval(high, low) ^ out) != 0) {
+            int gate = __builtin_ctz((changed | (changed >> 4)) & 0x0f);
+
+            out ^= changed & (0x11 << gate);
+            EmitGate(gate);
+        }
+    }
+};
+
+
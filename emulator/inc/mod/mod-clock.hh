@@ -113,11 +113,13 @@ public:
 
 public:
     void StartClock(void);
+    void SelectHighSpeedClock(void);
 
 
 
 public:
     unsigned long GetClockCount(void) const { return clockCount; }
+    void Snapshot(HW_Snapshot_t::Stream_t &s) { s & clockCount; }
 
 
 
@@ -147,7 +147,7 @@ signals:
     void SignalSramCeUpdated(TriState_t state);             // Qs + #Qc
 
 //    void SignalRHld(TriState_t state);                      // #RHLD
-    void CopyEeprom(void);
+    void CopyEeprom(void);                                  // fast boot: bulk-load every control ROM now
 
 
 
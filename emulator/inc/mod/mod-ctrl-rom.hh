@@ -33,14 +33,7 @@ private:
 
     HW_Bus_8_t *ctrl;
 
-    GUI_Led_t *led0;
-    GUI_Led_t *led1;
-    GUI_Led_t *led2;
-    GUI_Led_t *led3;
-    GUI_Led_t *led4;
-    GUI_Led_t *led5;
-    GUI_Led_t *led6;
-    GUI_Led_t *led7;
+    GUI_LedBank_t *leds;
 
 
 
@@ -60,7 +53,7 @@ public slots:
     void ProcessUpdateLatchOe(TriState_t state) { latch->ProcessUpdateOE(state); }
     void ProcessUpdateDriverOe(TriState_t state) { driver->ProcessUpdateOE2(state); }
     void ProcessSanityCheck(TriState_t state) { if (state != LOW) sram->ProcessSanityCheck(objectName()); }
-    void ProcessCopyEeprom(void) { sram->CopyEeprom(); }
+    bool ProcessCopyEeprom(void) { return sram->CopyEeprom(); }
 
 
 
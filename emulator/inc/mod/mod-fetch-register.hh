@@ -47,22 +47,7 @@ private:
 
     IC_74xx04_t *inv1;
 
-    GUI_Led_t *bit0;
-    GUI_Led_t *bit1;
-    GUI_Led_t *bit2;
-    GUI_Led_t *bit3;
-    GUI_Led_t *bit4;
-    GUI_Led_t *bit5;
-    GUI_Led_t *bit6;
-    GUI_Led_t *bit7;
-    GUI_Led_t *bit8;
-    GUI_Led_t *bit9;
-    GUI_Led_t *bitA;
-    GUI_Led_t *bitB;
-    GUI_Led_t *bitC;
-    GUI_Led_t *bitD;
-    GUI_Led_t *bitE;
-    GUI_Led_t *bitF;
+    GUI_LedBank_t *bits;
 
     GUI_Led_t *assertMain;
     GUI_Led_t *assertAluB;
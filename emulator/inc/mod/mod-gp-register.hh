@@ -9,6 +9,12 @@
 //  be the inputs from and outputs to the computer backplane.  All other connections in real hardware are
 //  represented here.
 //
+//  The module can also be built behaviorally (see `HW_Computer_t::GetFidelity()`).  In that case none of the ICs
+//  are allocated; the register is a `uint16_t` with the same load/inc/dec/reset edge behavior as the 74xx193
+//  counters, plus the latched copy the 74xx574s hold.  The external slots are the same; the outputs are emitted
+//  as words straight to the buses.  Swap puts its word on the main bus through an object of its own, since a bus
+//  tells its drivers apart by sender: Main and Swap asserted together are then contention, as at gate level.
+//
 //      Date     Tracker  Version  Description
 //  -----------  -------  -------  ---------------------------------------------------------------------------------
 //  2023-Nov-26  Initial  v0.0.1   Initial version
@@ -18,6 +24,29 @@
 #pragma once
 
 
+//
+// -- The Swap output of a behavioral register, a separate driver on the main bus from the module itself
+//    --------------------------------------------------------------------------------------------------
+class GpRegisterSwap_t : public QObject {
+    Q_OBJECT
+
+
+public:
+    explicit GpRegisterSwap_t(QObject *parent) : QObject(parent) { HW_Snapshot_t::Get()->Register(this); }
+    virtual ~GpRegisterSwap_t() {}
+
+
+public:
+    // -- no state of its own; it is registered so that a bus can name it as one of its drivers
+    void Snapshot(HW_Snapshot_t::Stream_t &) {}
+
+
+signals:
+    void SignalUpdated(uint16_t val, uint16_t drive);
+};
+
+
+
 //
 // -- The General Purpose Register Module class.  It will be subclassed from QGroupBox
 //    --------------------------------------------------------------------------------
@@ -26,6 +55,29 @@ class GpRegisterModule_t : public QGroupBox {
 
 
 private:
+    // -- when true, the components below are not allocated and the behavioral state is used instead
+    bool behavioral;
+
+    // -- the behavioral state
+    uint16_t value;                         // the counter contents
+    uint16_t latched;                       // what the 574s captured on the latch clock
+    uint16_t q;                             // what the 574s are presenting on their outputs
+    uint16_t mainIn;                        // the last word seen on the main bus
+    bool clk;
+    bool incIn;
+    bool decIn;
+    bool loadIn;
+    bool resetIn;                           // active low
+    bool up;                                // NAND(clk, inc) -- counts on the rising edge
+    bool down;                              // NAND(clk, dec) -- counts on the rising edge
+    bool swapOut;
+    bool mainOut;
+    bool aluAOut;
+    bool aluBOut;
+    bool addr1Out;
+    bool addr2Out;
+
+
     // -- this module contains the following components
     IC_74xx193_t *counter0;
     IC_74xx193_t *counter1;
@@ -56,22 +108,9 @@ private:
     IC_74xx00_t *nand1;
     IC_74xx04_t *inv1;
 
-    GUI_Led_t *bit0;
-    GUI_Led_t *bit1;
-    GUI_Led_t *bit2;
-    GUI_Led_t *bit3;
-    GUI_Led_t *bit4;
-    GUI_Led_t *bit5;
-    GUI_Led_t *bit6;
-    GUI_Led_t *bit7;
-    GUI_Led_t *bit8;
-    GUI_Led_t *bit9;
-    GUI_Led_t *bitA;
-    GUI_Led_t *bitB;
-    GUI_Led_t *bitC;
-    GUI_Led_t *bitD;
-    GUI_Led_t *bitE;
-    GUI_Led_t *bitF;
+    GpRegisterSwap_t *swapDriver;           // behavioral only
+
+    GUI_LedBank_t *bits;
 
     GUI_Led_t *load;
     GUI_Led_t *inc;
@@ -100,22 +139,32 @@ public slots:
     void ProcessAssertAddr1(TriState_t state);
     void ProcessAssertAddr2(TriState_t state);
 
-    void ProcessUpdateMainBit0(TriState_t state) { counter0->ProcessUpdateA(state); }
-    void ProcessUpdateMainBit1(TriState_t state) { counter0->ProcessUpdateB(state); }
-    void ProcessUpdateMainBit2(TriState_t state) { counter0->ProcessUpdateC(state); }
-    void ProcessUpdateMainBit3(TriState_t state) { counter0->ProcessUpdateD(state); }
-    void ProcessUpdateMainBit4(TriState_t state) { counter1->ProcessUpdateA(state); }
-    void ProcessUpdateMainBit5(TriState_t state) { counter1->ProcessUpdateB(state); }
-    void ProcessUpdateMainBit6(TriState_t state) { counter1->ProcessUpdateC(state); }
-    void ProcessUpdateMainBit7(TriState_t state) { counter1->ProcessUpdateD(state); }
-    void ProcessUpdateMainBit8(TriState_t state) { counter2->ProcessUpdateA(state); }
-    void ProcessUpdateMainBit9(TriState_t state) { counter2->ProcessUpdateB(state); }
-    void ProcessUpdateMainBitA(TriState_t state) { counter2->ProcessUpdateC(state); }
-    void ProcessUpdateMainBitB(TriState_t state) { counter2->ProcessUpdateD(state); }
-    void ProcessUpdateMainBitC(TriState_t state) { counter3->ProcessUpdateA(state); }
-    void ProcessUpdateMainBitD(TriState_t state) { counter3->ProcessUpdateB(state); }
-    void ProcessUpdateMainBitE(TriState_t state) { counter3->ProcessUpdateC(state); }
-    void ProcessUpdateMainBitF(TriState_t state) { counter3->ProcessUpdateD(state); }
+    void ProcessUpdateMainBit0(TriState_t state) { UpdateMainBit(0x0, state); }
+    void ProcessUpdateMainBit1(TriState_t state) { UpdateMainBit(0x1, state); }
+    void ProcessUpdateMainBit2(TriState_t state) { UpdateMainBit(0x2, state); }
+    void ProcessUpdateMainBit3(TriState_t state) { UpdateMainBit(0x3, state); }
+    void ProcessUpdateMainBit4(TriState_t state) { UpdateMainBit(0x4, state); }
+    void ProcessUpdateMainBit5(TriState_t state) { UpdateMainBit(0x5, state); }
+    void ProcessUpdateMainBit6(TriState_t state) { UpdateMainBit(0x6, state); }
+    void ProcessUpdateMainBit7(TriState_t state) { UpdateMainBit(0x7, state); }
+    void ProcessUpdateMainBit8(TriState_t state) { UpdateMainBit(0x8, state); }
+    void ProcessUpdateMainBit9(TriState_t state) { UpdateMainBit(0x9, state); }
+    void ProcessUpdateMainBitA(TriState_t state) { UpdateMainBit(0xa, state); }
+    void ProcessUpdateMainBitB(TriState_t state) { UpdateMainBit(0xb, state); }
+    void ProcessUpdateMainBitC(TriState_t state) { UpdateMainBit(0xc, state); }
+    void ProcessUpdateMainBitD(TriState_t state) { UpdateMainBit(0xd, state); }
+    void ProcessUpdateMainBitE(TriState_t state) { UpdateMainBit(0xe, state); }
+    void ProcessUpdateMainBitF(TriState_t state) { UpdateMainBit(0xf, state); }
+    void ProcessUpdateMainWord(uint16_t val);
+
+
+signals:
+    // -- only emitted by the behavioral model; the 574s drive the buses at gate level
+    void SignalMainUpdated(uint16_t val, uint16_t drive);
+    void SignalAluAUpdated(uint16_t val, uint16_t drive);
+    void SignalAluBUpdated(uint16_t val, uint16_t drive);
+    void SignalAddr1Updated(uint16_t val, uint16_t drive);
+    void SignalAddr2Updated(uint16_t val, uint16_t drive);
 
 
 public:
@@ -127,6 +176,7 @@ public:
 
 public:
     void TriggerFirstUpdate(void);         // trigger all the proper initial updates
+    void Snapshot(HW_Snapshot_t::Stream_t &s);
 
 
 
@@ -135,6 +185,10 @@ private:
     void AllocateComponents(void);          // Get the component memory from heap
     void BuildGui(void);                    // place the components on the GUI
     void WireUp(void);                      // make all the necessary connections
+    void WireUpBehavioral(void);            // connect the behavioral model to the buses
+    void UpdateMainBit(int bit, TriState_t state);
+    void UpdateCounter(void);               // behavioral: settle the counter after an input changes
+    void UpdateOutputs(void);               // behavioral: drive the buses and LEDs from `q`
 };
 
 
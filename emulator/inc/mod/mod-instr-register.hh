@@ -30,22 +30,7 @@ private:
     IC_74xx574_t *led0;
     IC_74xx574_t *led1;
 
-    GUI_Led_t *bit0;
-    GUI_Led_t *bit1;
-    GUI_Led_t *bit2;
-    GUI_Led_t *bit3;
-    GUI_Led_t *bit4;
-    GUI_Led_t *bit5;
-    GUI_Led_t *bit6;
-    GUI_Led_t *bit7;
-    GUI_Led_t *bit8;
-    GUI_Led_t *bit9;
-    GUI_Led_t *bitA;
-    GUI_Led_t *bitB;
-    GUI_Led_t *bitC;
-    GUI_Led_t *bitD;
-    GUI_Led_t *bitE;
-    GUI_Led_t *bitF;
+    GUI_LedBank_t *bits;
 
 
 public slots:
@@ -24,6 +24,10 @@
 class ControlLogic_MidPlane_t : public QGroupBox {
     Q_OBJECT
 
+public:
+    enum { CTRL_ROM_CNT = 16 };             // ctrl0 through ctrlf
+
+
 private:
     // -- the Control ROMS
     static CtrlRomCtrlModule_t *ctrlCtrl;
@@ -87,6 +91,7 @@ public slots:
     void ProcessCpuClockOutput(TriState_t state);   // Cpu Clock
     void ProcessRawSystemClock(TriState_t state);   // Main high-speed system clock
     void ProcessSanityCheck(TriState_t state);      // Check the consistenc of the RAM in the Control Modules
+    void ProcessFastBoot(void);                     // Bulk-load all the Control Module SRAMs in one step
 
 
 signals:
@@ -393,6 +398,7 @@ public:
 public:
     // -- access functions
     static HW_Bus_16_t *GetCtrlBus(void) { return ctrlBus; }
+    static CtrlRomModule_t *GetCtrlRom(int i);
 
 
 public:
@@ -26,12 +26,19 @@ private:
     IC_74xx238_t *demuxLo;
     IC_74xx238_t *demuxHi;
 
+    // -- the select lines are nets scheduled by the netlist
+    HW_Netlist_t *netlist;
+    HW_Netlist_t::Net_t netA;
+    HW_Netlist_t::Net_t netB;
+    HW_Netlist_t::Net_t netC;
+    HW_Netlist_t::Net_t netD;
+
 
 public slots:
-    void ProcessUpdateA(TriState_t state) { demuxLo->ProcessUpdateA(state); demuxHi->ProcessUpdateA(state); }
-    void ProcessUpdateB(TriState_t state) { demuxLo->ProcessUpdateB(state); demuxHi->ProcessUpdateB(state); }
-    void ProcessUpdateC(TriState_t state) { demuxLo->ProcessUpdateC(state); demuxHi->ProcessUpdateC(state); }
-    void ProcessUpdateD(TriState_t state) { demuxLo->ProcessUpdateG2A(state); demuxHi->ProcessUpdateG1(state); }
+    void ProcessUpdateA(TriState_t state) { netlist->Drive(netA, state); }
+    void ProcessUpdateB(TriState_t state) { netlist->Drive(netB, state); }
+    void ProcessUpdateC(TriState_t state) { netlist->Drive(netC, state); }
+    void ProcessUpdateD(TriState_t state) { netlist->Drive(netD, state); }
 
 
 signals:
@@ -42,15 +42,26 @@ private:
     IC_74xx238_t *demux16;
     IC_74xx238_t *demux17;
 
+    // -- the select lines and the enables between the two levels are nets scheduled by the netlist
+    HW_Netlist_t *netlist;
+    HW_Netlist_t::Net_t netA;
+    HW_Netlist_t::Net_t netB;
+    HW_Netlist_t::Net_t netC;
+    HW_Netlist_t::Net_t netD;
+    HW_Netlist_t::Net_t netE;
+    HW_Netlist_t::Net_t netF;
+    HW_Netlist_t::Net_t netG;
+    IC_74xx238_t *second[16];
+
 
 public slots:
-    void ProcessUpdateA(TriState_t state);
-    void ProcessUpdateB(TriState_t state);
-    void ProcessUpdateC(TriState_t state);
-    void ProcessUpdateD(TriState_t state) { demuxLo->ProcessUpdateA(state); demuxHi->ProcessUpdateA(state); }
-    void ProcessUpdateE(TriState_t state) { demuxLo->ProcessUpdateB(state); demuxHi->ProcessUpdateB(state); }
-    void ProcessUpdateF(TriState_t state) { demuxLo->ProcessUpdateC(state); demuxHi->ProcessUpdateC(state); }
-    void ProcessUpdateG(TriState_t state) { demuxLo->ProcessUpdateG2A(state); demuxHi->ProcessUpdateG1(state); }
+    void ProcessUpdateA(TriState_t state) { netlist->Drive(netA, state); }
+    void ProcessUpdateB(TriState_t state) { netlist->Drive(netB, state); }
+    void ProcessUpdateC(TriState_t state) { netlist->Drive(netC, state); }
+    void ProcessUpdateD(TriState_t state) { netlist->Drive(netD, state); }
+    void ProcessUpdateE(TriState_t state) { netlist->Drive(netE, state); }
+    void ProcessUpdateF(TriState_t state) { netlist->Drive(netF, state); }
+    void ProcessUpdateG(TriState_t state) { netlist->Drive(netG, state); }
 
 
 // -- the numbers in the following signals are in octal form
@@ -224,6 +235,9 @@ public:
 public:
     void TriggerFirstUpdate(void);
 
+    // -- bit-sliced batch decode: `sel` holds the lanes for A-G and `out` receives the lanes for Y000-Y177
+    void DecodeLanes(const uint64_t sel[7], uint64_t out[128]);
+
 
 private:
     // -- intenral functions
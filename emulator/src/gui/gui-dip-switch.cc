@@ -23,8 +23,12 @@ GUI_DipSwitch_t::GUI_DipSwitch_t(QWidget *parent) : QSlider(Qt::Vertical, parent
     setMinimum(0);
     setMaximum(1);
     setFixedHeight(25);
+    pos = 0;
 
     connect(this, &GUI_DipSwitch_t::sliderPressed, this, &GUI_DipSwitch_t::ProcessClick);
     connect(this, &GUI_DipSwitch_t::valueChanged, this, &GUI_DipSwitch_t::ProcessStateChange);
+
+    HW_Snapshot_t::Get()->Register(this);
+    HW_History_t::Get()->RegisterInput(this);
 }
 
@@ -0,0 +1,58 @@
+//===================================================================================================================
+//  gui-frame.cc -- Paces the repainting of the GUI, independent of how fast the simulation runs
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/gui-frame.moc.cc"
+
+
+
+//
+// -- Static class members
+//    --------------------
+GUI_Frame_t *GUI_Frame_t::singleton = nullptr;
+
+
+
+//
+// -- Construct the pacer, not yet running
+//    ------------------------------------
+GUI_Frame_t::GUI_Frame_t(void)
+{
+    timer = new QTimer(this);
+    timer->setTimerType(Qt::PreciseTimer);
+    connect(timer, &QTimer::timeout, this, &GUI_Frame_t::SignalFrame);
+}
+
+
+
+//
+// -- Get the singleton instance, creating it as needed
+//    -------------------------------------------------
+GUI_Frame_t *GUI_Frame_t::Get(void)
+{
+    if (unlikely(singleton == nullptr)) singleton = new GUI_Frame_t;
+    return singleton;
+}
+
+
+
+//
+// -- Start signalling frames; a rate out of range falls back to the default
+//    ----------------------------------------------------------------------
+void GUI_Frame_t::Start(int rate)
+{
+    if (rate < MIN_RATE || rate > MAX_RATE) rate = DEFAULT_RATE;
+
+    timer->start(1000 / rate);
+}
+
+
@@ -0,0 +1,130 @@
+//===================================================================================================================
+//  gui-led-bank.cc -- A row of LEDs showing the bits of one value, painted as a single widget
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/gui-led-bank.moc.cc"
+
+
+
+//
+// -- Construct a bank of LEDs, all of them off
+//    -----------------------------------------
+GUI_LedBank_t::GUI_LedBank_t(int bits, Qt::GlobalColor on, int group, bool numbered, QWidget *parent)
+        : QWidget(parent), bits(qBound(1, bits, 16)), group(group), numbered(numbered), onColor(on),
+          latest(0), shownValue(0), shownZMask(0)
+{
+    setSizePolicy(QSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed));
+
+    connect(GUI_Frame_t::Get(), &GUI_Frame_t::SignalFrame, this, &GUI_LedBank_t::ProcessFrame);
+}
+
+
+
+//
+// -- The width of each LED's cell: wide enough for the bit number when the LEDs are numbered
+//    ---------------------------------------------------------------------------------------
+int GUI_LedBank_t::CellWidth(void) const
+{
+    if (!numbered) return LED_WIDTH + LED_SPACING;
+
+    return qMax((int)LED_WIDTH, fontMetrics().horizontalAdvance('0')) + 3 * LED_SPACING;
+}
+
+
+
+//
+// -- The size of the whole bank
+//    --------------------------
+QSize GUI_LedBank_t::sizeHint(void) const
+{
+    int gaps = (group > 0) ? (bits - 1) / group : 0;
+    int height = LED_HEIGHT + (numbered ? fontMetrics().height() : 0);
+
+    return QSize(bits * CellWidth() + gaps * GROUP_GAP, height);
+}
+
+
+
+//
+// -- Set one bit from a signal
+//    -------------------------
+void GUI_LedBank_t::SetBit(int bit, TriState_t state)
+{
+    uint32_t b = (1 << bit);
+    uint32_t v = latest.load(std::memory_order_relaxed) & ~(b | (b << 16));
+
+    if (state == Z) v |= (b << 16);
+    else if (state == HIGH) v |= b;
+
+    latest.store(v, std::memory_order_relaxed);
+}
+
+
+
+//
+// -- Set a byte from a signal, where `drive` has the bits being driven
+//    -----------------------------------------------------------------
+void GUI_LedBank_t::SetByte(int shift, uint8_t val, uint8_t drive)
+{
+    uint32_t mask = 0xff << shift;
+    uint32_t v = latest.load(std::memory_order_relaxed) & ~(mask | (mask << 16));
+
+    v |= (uint32_t)val << shift;
+    v |= ((uint32_t)(uint8_t)~drive << shift) << 16;
+
+    latest.store(v, std::memory_order_relaxed);
+}
+
+
+
+//
+// -- Repaint, but only when the value is different from the last frame
+//    -----------------------------------------------------------------
+void GUI_LedBank_t::ProcessFrame(void)
+{
+    uint32_t v = latest.load(std::memory_order_relaxed);
+    if ((v & 0xffff) == shownValue && (v >> 16) == shownZMask) return;
+
+    shownValue = v & 0xffff;
+    shownZMask = v >> 16;
+    update();
+}
+
+
+
+//
+// -- Paint the LEDs, the highest bit on the left; an undriven bit is off
+//    -------------------------------------------------------------------
+void GUI_LedBank_t::paintEvent(QPaintEvent *)
+{
+    QPainter painter(this);
+    int cell = CellWidth();
+    int x = (width() - sizeHint().width()) / 2;
+
+    for (int i = bits - 1; i >= 0; i --) {
+        uint16_t b = (1 << i);
+        bool on = (shownValue & b) && !(shownZMask & b);
+        int led = x + (cell - LED_WIDTH) / 2;
+
+        painter.fillRect(led, 0, LED_WIDTH, LED_HEIGHT, on ? onColor : QColor(Qt::gray));
+
+        if (numbered) {
+            painter.drawText(QRect(x, LED_HEIGHT, cell, height() - LED_HEIGHT), Qt::AlignHCenter | Qt::AlignTop,
+                    QString::number(i));
+        }
+
+        x += cell;
+        if (group > 0 && i > 0 && i % group == 0) x += GROUP_GAP;
+    }
+}
+
+
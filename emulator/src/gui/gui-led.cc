@@ -23,7 +23,8 @@ QPalette GUI_Led_t::offColor(QPalette::Window, Qt::gray);
 //
 // -- Construct a new LED
 //    -------------------
-GUI_Led_t::GUI_Led_t(LedWiring_t wire, Qt::GlobalColor on, QWidget *parent) : QLabel(parent), onWhen(wire)
+GUI_Led_t::GUI_Led_t(LedWiring_t wire, Qt::GlobalColor on, QWidget *parent)
+        : QLabel(parent), onWhen(wire), state(LOW), lit(false)
 {
     onColor = QPalette(QPalette::Window, on);
     setAutoFillBackground(true);
@@ -31,17 +32,35 @@ GUI_Led_t::GUI_Led_t(LedWiring_t wire, Qt::GlobalColor on, QWidget *parent) : QL
     setPalette(offColor);
     setSizePolicy(QSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed));
     setMaximumHeight(14);
+
+    connect(GUI_Frame_t::Get(), &GUI_Frame_t::SignalFrame, this, &GUI_Led_t::ProcessFrame);
 }
 
 
 //
 // -- Construct a new LED
 //    -------------------
-GUI_Led_t::GUI_Led_t(QWidget *parent, LedWiring_t wire, Qt::GlobalColor on) : QLabel(parent), onWhen(wire)
+GUI_Led_t::GUI_Led_t(QWidget *parent, LedWiring_t wire, Qt::GlobalColor on)
+        : QLabel(parent), onWhen(wire), state(LOW), lit(false)
 {
     onColor = QPalette(QPalette::Window, on);
     setAutoFillBackground(true);
     setBackgroundRole(QPalette::Window);
     setPalette(offColor);
+
+    connect(GUI_Frame_t::Get(), &GUI_Frame_t::SignalFrame, this, &GUI_Led_t::ProcessFrame);
+}
+
+
+//
+// -- Repaint the LED, but only when it differs from the last frame
+//    -------------------------------------------------------------
+void GUI_Led_t::ProcessFrame(void)
+{
+    bool on = !(state.load(std::memory_order_relaxed) ^ onWhen);
+    if (on == lit) return;
+
+    lit = on;
+    setPalette(on ? onColor : offColor);
 }
 
@@ -29,5 +29,8 @@ GUI_MomentarySwitch_t::GUI_MomentarySwitch_t(const QString &name, TriState_t p,
 
     connect(this, &GUI_MomentarySwitch_t::pressed, this, &GUI_MomentarySwitch_t::ProcessClick);
     connect(this, &GUI_MomentarySwitch_t::released, this, &GUI_MomentarySwitch_t::ProcessRelease);
+
+    HW_Snapshot_t::Get()->Register(this);
+    HW_History_t::Get()->RegisterInput(this);
 }
 
@@ -25,7 +25,15 @@ GUI_SettingsDialog_t::~GUI_SettingsDialog_t()
         QSettings *settings = HW_Computer_t::GetSettings();
 
         settings->setValue(key, dir->text());
+        settings->setValue(fastBootKey, fastBoot->isChecked());
+
+        double hz = qMax(0.0, targetMhz->text().toDouble() * 1000000.0);
+        settings->setValue(cpuTargetKey, hz);
         settings->sync();
+
+        bool fast = fastBoot->isChecked();
+        HW_SimThread_t::Get()->Post([fast](void) { HW_Computer_t::SetFastBoot(fast); });
+        HW_SimThread_t::Get()->Post([hz](void) { HW_Scheduler_t::Get()->SetTargetCpuFrequency(hz); });
     }
 }
 
@@ -54,16 +62,29 @@ void GUI_SettingsDialog_t::Init(void)
     connect(folder, &QPushButton::pressed, this, &GUI_SettingsDialog_t::ProcessSelectDir);
 
 
+    fastBoot = new QCheckBox("Fast boot (bulk-load the Control ROMs at reset)");
+    fastBoot->setChecked(HW_Computer_t::IsFastBoot());
+    layout->addWidget(fastBoot, 2, 0, 1, 4);
+
+
+    layout->addWidget(new QLabel("Target CPU clock in MHz (0 runs the crystal in real time):"), 3, 0, 1, 3);
+
+    targetMhz = new QLineEdit(QString::number(settings->value(cpuTargetKey, 0).toDouble() / 1000000.0));
+    targetMhz->setValidator(new QDoubleValidator(0, 100, 6, targetMhz));
+    targetMhz->setFixedWidth(80);
+    layout->addWidget(targetMhz, 3, 3, 1, 1);
+
+
     QPushButton *ok = new QPushButton("OK");
     ok->setDefault(true);
     ok->setFixedWidth(50);
-    layout->addWidget(ok, 4, 2, 1, 1);
+    layout->addWidget(ok, 5, 2, 1, 1);
     connect(ok, &QPushButton::clicked, this, &QDialog::accept);
 
 
     QPushButton *cancel = new QPushButton("Cancel");
     cancel->setFixedWidth(50);
-    layout->addWidget(cancel, 4, 3, 1, 1);
+    layout->addWidget(cancel, 5, 3, 1, 1);
     connect(cancel, &QPushButton::clicked, this, &QDialog::reject);
 
     setLayout(layout);
@@ -37,74 +37,68 @@ HW_AluAdder_t::HW_AluAdder_t(IC_74xx541_t *aluALsb, IC_74xx541_t *aluAMsb,
 
 
     // -- connect the ALU A inputs
-    connect(aluALsb, &IC_74xx541_t::SignalY0Updated, bits0, &IC_74xx283_t::ProcessA0Update);
-    connect(aluALsb, &IC_74xx541_t::SignalY1Updated, bits0, &IC_74xx283_t::ProcessA1Update);
-    connect(aluALsb, &IC_74xx541_t::SignalY2Updated, bits0, &IC_74xx283_t::ProcessA2Update);
-    connect(aluALsb, &IC_74xx541_t::SignalY3Updated, bits0, &IC_74xx283_t::ProcessA3Update);
-    connect(aluALsb, &IC_74xx541_t::SignalY4Updated, bits4, &IC_74xx283_t::ProcessA0Update);
-    connect(aluALsb, &IC_74xx541_t::SignalY5Updated, bits4, &IC_74xx283_t::ProcessA1Update);
-    connect(aluALsb, &IC_74xx541_t::SignalY6Updated, bits4, &IC_74xx283_t::ProcessA2Update);
-    connect(aluALsb, &IC_74xx541_t::SignalY7Updated, bits4, &IC_74xx283_t::ProcessA3Update);
-    connect(aluAMsb, &IC_74xx541_t::SignalY0Updated, bits8, &IC_74xx283_t::ProcessA0Update);
-    connect(aluAMsb, &IC_74xx541_t::SignalY1Updated, bits8, &IC_74xx283_t::ProcessA1Update);
-    connect(aluAMsb, &IC_74xx541_t::SignalY2Updated, bits8, &IC_74xx283_t::ProcessA2Update);
-    connect(aluAMsb, &IC_74xx541_t::SignalY3Updated, bits8, &IC_74xx283_t::ProcessA3Update);
-    connect(aluAMsb, &IC_74xx541_t::SignalY4Updated, bitsc, &IC_74xx283_t::ProcessA0Update);
-    connect(aluAMsb, &IC_74xx541_t::SignalY5Updated, bitsc, &IC_74xx283_t::ProcessA1Update);
-    connect(aluAMsb, &IC_74xx541_t::SignalY6Updated, bitsc, &IC_74xx283_t::ProcessA2Update);
-    connect(aluAMsb, &IC_74xx541_t::SignalY7Updated, bitsc, &IC_74xx283_t::ProcessA3Update);
+    connect(aluALsb, &IC_74xx541_t::SignalYWordUpdated, this, &HW_AluAdder_t::ProcessAluALsbUpdate, CNN_TYPE);
+    connect(aluAMsb, &IC_74xx541_t::SignalYWordUpdated, this, &HW_AluAdder_t::ProcessAluAMsbUpdate, CNN_TYPE);
 
 
     // -- connect the ALU B inputs
-    connect(aluBLsb, &IC_74xx541_t::SignalY0Updated, bits0, &IC_74xx283_t::ProcessB0Update);
-    connect(aluBLsb, &IC_74xx541_t::SignalY1Updated, bits0, &IC_74xx283_t::ProcessB1Update);
-    connect(aluBLsb, &IC_74xx541_t::SignalY2Updated, bits0, &IC_74xx283_t::ProcessB2Update);
-    connect(aluBLsb, &IC_74xx541_t::SignalY3Updated, bits0, &IC_74xx283_t::ProcessB3Update);
-    connect(aluBLsb, &IC_74xx541_t::SignalY4Updated, bits4, &IC_74xx283_t::ProcessB0Update);
-    connect(aluBLsb, &IC_74xx541_t::SignalY5Updated, bits4, &IC_74xx283_t::ProcessB1Update);
-    connect(aluBLsb, &IC_74xx541_t::SignalY6Updated, bits4, &IC_74xx283_t::ProcessB2Update);
-    connect(aluBLsb, &IC_74xx541_t::SignalY7Updated, bits4, &IC_74xx283_t::ProcessB3Update);
-    connect(aluBMsb, &IC_74xx541_t::SignalY0Updated, bits8, &IC_74xx283_t::ProcessB0Update);
-    connect(aluBMsb, &IC_74xx541_t::SignalY1Updated, bits8, &IC_74xx283_t::ProcessB1Update);
-    connect(aluBMsb, &IC_74xx541_t::SignalY2Updated, bits8, &IC_74xx283_t::ProcessB2Update);
-    connect(aluBMsb, &IC_74xx541_t::SignalY3Updated, bits8, &IC_74xx283_t::ProcessB3Update);
-    connect(aluBMsb, &IC_74xx541_t::SignalY4Updated, bitsc, &IC_74xx283_t::ProcessB0Update);
-    connect(aluBMsb, &IC_74xx541_t::SignalY5Updated, bitsc, &IC_74xx283_t::ProcessB1Update);
-    connect(aluBMsb, &IC_74xx541_t::SignalY6Updated, bitsc, &IC_74xx283_t::ProcessB2Update);
-    connect(aluBMsb, &IC_74xx541_t::SignalY7Updated, bitsc, &IC_74xx283_t::ProcessB3Update);
-
-
-    // -- interconnects between the ICs
-    connect(bits0, &IC_74xx283_t::SignalCOutUpdated, bits4, &IC_74xx283_t::ProcessCInUpdate);
-    connect(bits4, &IC_74xx283_t::SignalCOutUpdated, bits8, &IC_74xx283_t::ProcessCInUpdate);
-    connect(bits8, &IC_74xx283_t::SignalCOutUpdated, bitsc, &IC_74xx283_t::ProcessCInUpdate);
+    connect(aluBLsb, &IC_74xx541_t::SignalYWordUpdated, this, &HW_AluAdder_t::ProcessAluBLsbUpdate, CNN_TYPE);
+    connect(aluBMsb, &IC_74xx541_t::SignalYWordUpdated, this, &HW_AluAdder_t::ProcessAluBMsbUpdate, CNN_TYPE);
+
+
+    // -- the A/B inputs and the carry interconnects between the ICs are nets
+    netlist = new HW_Netlist_t("AluAdder", this);
+
+    IC_74xx283_t *nibble[4] = { bits0, bits4, bits8, bitsc };
+    const int aPin[4] = { IC_74xx283_t::A0, IC_74xx283_t::A1, IC_74xx283_t::A2, IC_74xx283_t::A3, };
+    const int bPin[4] = { IC_74xx283_t::B0, IC_74xx283_t::B1, IC_74xx283_t::B2, IC_74xx283_t::B3, };
+    HW_Netlist_t::Net_t carry = carryIn = netlist->NewNet(LOW);
+
+    for (int i = 0; i < 4; i ++) {
+        for (int j = 0; j < 4; j ++) {
+            aNets[i * 4 + j] = netlist->NewNet(LOW);
+            bNets[i * 4 + j] = netlist->NewNet(LOW);
+
+            nibble[i]->BindInput(netlist, aPin[j], aNets[i * 4 + j]);
+            nibble[i]->BindInput(netlist, bPin[j], bNets[i * 4 + j]);
+        }
+
+        nibble[i]->BindInput(netlist, IC_74xx283_t::CIN, carry);
+
+        if (i < 3) {
+            carry = netlist->NewNet(LOW);
+            nibble[i]->BindOutput(netlist, IC_74xx283_t::COUT, carry);
+        }
+    }
+
+    netlist->Levelize();
 
 
     // -- connect the adder outputs to the Bus Driver
-    connect(bits0, &IC_74xx283_t::SignalS0Updated, driver, &HW_BusDriver_t::ProcessUpdateBit0);
-    connect(bits0, &IC_74xx283_t::SignalS1Updated, driver, &HW_BusDriver_t::ProcessUpdateBit1);
-    connect(bits0, &IC_74xx283_t::SignalS2Updated, driver, &HW_BusDriver_t::ProcessUpdateBit2);
-    connect(bits0, &IC_74xx283_t::SignalS3Updated, driver, &HW_BusDriver_t::ProcessUpdateBit3);
-    connect(bits4, &IC_74xx283_t::SignalS0Updated, driver, &HW_BusDriver_t::ProcessUpdateBit4);
-    connect(bits4, &IC_74xx283_t::SignalS1Updated, driver, &HW_BusDriver_t::ProcessUpdateBit5);
-    connect(bits4, &IC_74xx283_t::SignalS2Updated, driver, &HW_BusDriver_t::ProcessUpdateBit6);
-    connect(bits4, &IC_74xx283_t::SignalS3Updated, driver, &HW_BusDriver_t::ProcessUpdateBit7);
-    connect(bits8, &IC_74xx283_t::SignalS0Updated, driver, &HW_BusDriver_t::ProcessUpdateBit8);
-    connect(bits8, &IC_74xx283_t::SignalS1Updated, driver, &HW_BusDriver_t::ProcessUpdateBit9);
-    connect(bits8, &IC_74xx283_t::SignalS2Updated, driver, &HW_BusDriver_t::ProcessUpdateBitA);
-    connect(bits8, &IC_74xx283_t::SignalS3Updated, driver, &HW_BusDriver_t::ProcessUpdateBitB);
-    connect(bitsc, &IC_74xx283_t::SignalS0Updated, driver, &HW_BusDriver_t::ProcessUpdateBitC);
-    connect(bitsc, &IC_74xx283_t::SignalS1Updated, driver, &HW_BusDriver_t::ProcessUpdateBitD);
-    connect(bitsc, &IC_74xx283_t::SignalS2Updated, driver, &HW_BusDriver_t::ProcessUpdateBitE);
-    connect(bitsc, &IC_74xx283_t::SignalS3Updated, driver, &HW_BusDriver_t::ProcessUpdateBitF);
+    connect(bits0, &IC_74xx283_t::SignalS0Updated, driver, &HW_BusDriver_t::ProcessUpdateBit0, CNN_TYPE);
+    connect(bits0, &IC_74xx283_t::SignalS1Updated, driver, &HW_BusDriver_t::ProcessUpdateBit1, CNN_TYPE);
+    connect(bits0, &IC_74xx283_t::SignalS2Updated, driver, &HW_BusDriver_t::ProcessUpdateBit2, CNN_TYPE);
+    connect(bits0, &IC_74xx283_t::SignalS3Updated, driver, &HW_BusDriver_t::ProcessUpdateBit3, CNN_TYPE);
+    connect(bits4, &IC_74xx283_t::SignalS0Updated, driver, &HW_BusDriver_t::ProcessUpdateBit4, CNN_TYPE);
+    connect(bits4, &IC_74xx283_t::SignalS1Updated, driver, &HW_BusDriver_t::ProcessUpdateBit5, CNN_TYPE);
+    connect(bits4, &IC_74xx283_t::SignalS2Updated, driver, &HW_BusDriver_t::ProcessUpdateBit6, CNN_TYPE);
+    connect(bits4, &IC_74xx283_t::SignalS3Updated, driver, &HW_BusDriver_t::ProcessUpdateBit7, CNN_TYPE);
+    connect(bits8, &IC_74xx283_t::SignalS0Updated, driver, &HW_BusDriver_t::ProcessUpdateBit8, CNN_TYPE);
+    connect(bits8, &IC_74xx283_t::SignalS1Updated, driver, &HW_BusDriver_t::ProcessUpdateBit9, CNN_TYPE);
+    connect(bits8, &IC_74xx283_t::SignalS2Updated, driver, &HW_BusDriver_t::ProcessUpdateBitA, CNN_TYPE);
+    connect(bits8, &IC_74xx283_t::SignalS3Updated, driver, &HW_BusDriver_t::ProcessUpdateBitB, CNN_TYPE);
+    connect(bitsc, &IC_74xx283_t::SignalS0Updated, driver, &HW_BusDriver_t::ProcessUpdateBitC, CNN_TYPE);
+    connect(bitsc, &IC_74xx283_t::SignalS1Updated, driver, &HW_BusDriver_t::ProcessUpdateBitD, CNN_TYPE);
+    connect(bitsc, &IC_74xx283_t::SignalS2Updated, driver, &HW_BusDriver_t::ProcessUpdateBitE, CNN_TYPE);
+    connect(bitsc, &IC_74xx283_t::SignalS3Updated, driver, &HW_BusDriver_t::ProcessUpdateBitF, CNN_TYPE);
 
 
     // -- handle the carry output
-    connect(bitsc, &IC_74xx283_t::SignalCOutUpdated, this, &HW_AluAdder_t::SignalCarryOutUpdated);
+    connect(bitsc, &IC_74xx283_t::SignalCOutUpdated, this, &HW_AluAdder_t::SignalCarryOutUpdated, CNN_TYPE);
 
 
     // -- here are some temporary connections, which will be replaced later
-    bits0->ProcessCInUpdate(LOW);
+    ProcessCarryInUpdate(LOW);
     driver->ProcessUpdateOE1(HIGH);     // turn off the automatic assert to Main
     driver->ProcessUpdateOE2(LOW);
 
@@ -126,3 +120,14 @@ void HW_AluAdder_t::TriggerFirstUpdate(void)
 }
 
 
+
+//
+// -- Update 8 of the adder inputs at once and then settle the adders
+//    ---------------------------------------------------------------
+void HW_AluAdder_t::UpdateByte(const HW_Netlist_t::Net_t *nets, uint8_t val)
+{
+    for (int i = 0; i < 8; i ++) netlist->Schedule(nets[i], (val & (1 << i)) ? HIGH : LOW);
+    netlist->Settle();
+}
+
+
@@ -0,0 +1,430 @@
+//===================================================================================================================
+//  hw-bench.cc -- Benchmarks for the simulation hot paths and for the whole machine
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/hw-bench.moc.cc"
+
+
+
+//
+// -- alternate an input every operation
+//    ----------------------------------
+static inline TriState_t Toggle(unsigned long i) { return (i & 1) ? HIGH : LOW; }
+
+
+
+//
+// -- Record a result
+//    ---------------
+void HW_Bench_t::Add(const QString &name, const QString &unit, double value, unsigned long ops)
+{
+    results.append({name, unit, value, ops});
+}
+
+
+
+//
+// -- Time `ops` calls of `op`, keeping the fastest of several runs, in ns per operation
+//    ----------------------------------------------------------------------------------
+void HW_Bench_t::Time(const QString &name, std::function<void(unsigned long)> op, unsigned long ops)
+{
+    if (!Wanted(name)) return;
+
+    // -- warm the caches and the branch predictors first
+    for (unsigned long i = 0; i < ops / 10; i ++) op(i);
+
+    qint64 best = -1;
+
+    for (int r = 0; r < MICRO_RUNS; r ++) {
+        QElapsedTimer timer;
+        timer.start();
+
+        for (unsigned long i = 0; i < ops; i ++) op(i);
+
+        qint64 ns = timer.nsecsElapsed();
+        if (best < 0 || ns < best) best = ns;
+    }
+
+    Add(name, "ns/op", (double)best / ops, ops);
+}
+
+
+
+//
+// -- The micro benchmarks; every part is built on its own, away from the computer
+//    ----------------------------------------------------------------------------
+void HW_Bench_t::RunMicro(void)
+{
+    ClockModule_t *clock = HW_Computer_t::GetClock();
+
+
+    //
+    // -- the 16-bit bus, driven through a real connection so the driver table is exercised
+    //    ---------------------------------------------------------------------------------
+    {
+        HW_Bus_16_t bus("Bench", clock);
+        connect(this, &HW_Bench_t::SignalBit, &bus, &HW_Bus_16_t::ProcessUpdateBit0);
+        connect(this, &HW_Bench_t::SignalWord, &bus, &HW_Bus_16_t::ProcessUpdateWord);
+
+        Time("bus16/maintain-bit", [this](unsigned long i) { emit SignalBit(Toggle(i)); });
+        Time("bus16/maintain-word", [this](unsigned long i) { emit SignalWord(i, 0xffff); });
+    }
+
+
+    //
+    // -- the gates: one input toggles with the others set so the output follows it
+    //    -------------------------------------------------------------------------
+    {
+        IC_74xx00_t ic;
+        ic.ProcessUpdateB1(HIGH);
+        Time("ic/74xx00/nand", [&ic](unsigned long i) { ic.ProcessUpdateA1(Toggle(i)); });
+    }
+
+    {
+        IC_74xx02_t ic;
+        ic.ProcessUpdateB1(LOW);
+        Time("ic/74xx02/nor", [&ic](unsigned long i) { ic.ProcessUpdateA1(Toggle(i)); });
+    }
+
+    {
+        IC_74xx03_t ic;
+        ic.ProcessUpdateB1(HIGH);
+        Time("ic/74xx03/nand-oc", [&ic](unsigned long i) { ic.ProcessUpdateA1(Toggle(i)); });
+    }
+
+    {
+        IC_74xx04_t ic;
+        Time("ic/74xx04/not", [&ic](unsigned long i) { ic.ProcessUpdateA1(Toggle(i)); });
+    }
+
+    {
+        IC_74xx08_t ic;
+        ic.ProcessUpdateB1(HIGH);
+        Time("ic/74xx08/and", [&ic](unsigned long i) { ic.ProcessUpdateA1(Toggle(i)); });
+    }
+
+    {
+        IC_74xx30_t ic;
+        ic.ProcessUpdateB(HIGH);
+        ic.ProcessUpdateC(HIGH);
+        ic.ProcessUpdateD(HIGH);
+        ic.ProcessUpdateE(HIGH);
+        ic.ProcessUpdateF(HIGH);
+        ic.ProcessUpdateG(HIGH);
+        ic.ProcessUpdateH(HIGH);
+        Time("ic/74xx30/nand8", [&ic](unsigned long i) { ic.ProcessUpdateA(Toggle(i)); });
+    }
+
+    {
+        IC_74xx32_t ic;
+        ic.ProcessUpdateB1(LOW);
+        Time("ic/74xx32/or", [&ic](unsigned long i) { ic.ProcessUpdateA1(Toggle(i)); });
+    }
+
+    {
+        IC_74xx86_t ic;
+        ic.ProcessUpdateB1(LOW);
+        Time("ic/74xx86/xor", [&ic](unsigned long i) { ic.ProcessUpdateA1(Toggle(i)); });
+    }
+
+
+    //
+    // -- the decoders and multiplexers: the lowest select input toggles
+    //    --------------------------------------------------------------
+    {
+        IC_74xx138_t ic;
+        ic.ProcessUpdateG1(HIGH);
+        ic.ProcessUpdateG2A(LOW);
+        ic.ProcessUpdateG2B(LOW);
+        Time("ic/74xx138/decode", [&ic](unsigned long i) { ic.ProcessUpdateA(Toggle(i)); });
+    }
+
+    {
+        IC_74xx238_t ic;
+        ic.ProcessUpdateG1(HIGH);
+        ic.ProcessUpdateG2A(LOW);
+        ic.ProcessUpdateG2B(LOW);
+        Time("ic/74xx238/decode", [&ic](unsigned long i) { ic.ProcessUpdateA(Toggle(i)); });
+    }
+
+    {
+        IC_74xx151_t ic;
+        ic.ProcessUpdateST(LOW);
+        ic.ProcessUpdateD0(LOW);
+        ic.ProcessUpdateD1(HIGH);
+        Time("ic/74xx151/select", [&ic](unsigned long i) { ic.ProcessUpdateA(Toggle(i)); });
+    }
+
+    {
+        IC_74xx157_t ic;
+        ic.ProcessUpdateGb(LOW);
+        ic.ProcessUpdateA1(LOW);
+        ic.ProcessUpdateB1(HIGH);
+        Time("ic/74xx157/select", [&ic](unsigned long i) { ic.ProcessUpdateAB(Toggle(i)); });
+    }
+
+
+    //
+    // -- the line drivers: one data input toggles with the outputs enabled
+    //    -----------------------------------------------------------------
+    {
+        IC_74xx540_t ic;
+        ic.ProcessUpdateOE1(LOW);
+        ic.ProcessUpdateOE2(LOW);
+        Time("ic/74xx540/drive-bit", [&ic](unsigned long i) { ic.ProcessUpdateD0(Toggle(i)); });
+    }
+
+    {
+        IC_74xx541_t ic;
+        ic.ProcessUpdateOE1(LOW);
+        ic.ProcessUpdateOE2(LOW);
+        Time("ic/74xx541/drive-bit", [&ic](unsigned long i) { ic.ProcessUpdateD0(Toggle(i)); });
+        Time("ic/74xx541/drive-word", [&ic](unsigned long i) { ic.ProcessUpdateDWord(i & 0xff); });
+    }
+
+
+    //
+    // -- the adder, a nibble at a time
+    //    -----------------------------
+    {
+        IC_74xx283_t ic;
+        ic.ProcessBUpdate(0x5);
+        ic.ProcessCInUpdate(LOW);
+        Time("ic/74xx283/add", [&ic](unsigned long i) { ic.ProcessAUpdate(i & 0xf); });
+    }
+
+
+    //
+    // -- the sequential parts: a full clock cycle for every operation
+    //    ------------------------------------------------------------
+    {
+        IC_74xx74_t ic;
+        ic.ProcessUpdateClr1(HIGH);
+        ic.ProcessUpdatePre1(HIGH);
+        Time("ic/74xx74/clock", [&ic](unsigned long i) {
+            ic.ProcessUpdateD1(Toggle(i));
+            ic.ProcessUpdateClockLatch1(HIGH);
+            ic.ProcessUpdateClockOutput1(HIGH);
+            ic.ProcessUpdateClockLatch1(LOW);
+            ic.ProcessUpdateClockOutput1(LOW);
+        });
+    }
+
+    {
+        IC_74xx574_t ic;
+        ic.ProcessUpdateOE(LOW);
+        Time("ic/74xx574/clock", [&ic](unsigned long i) {
+            ic.ProcessUpdateDWord(i & 0xff);
+            ic.ProcessUpdateClockLatch(HIGH);
+            ic.ProcessUpdateClockOutput(HIGH);
+            ic.ProcessUpdateClockLatch(LOW);
+            ic.ProcessUpdateClockOutput(LOW);
+        });
+    }
+
+    {
+        IC_74xx164_t ic;
+        ic.ProcessUpdateClr(HIGH);
+        ic.ProcessUpdateB(HIGH);
+        Time("ic/74xx164/shift", [&ic](unsigned long i) {
+            ic.ProcessUpdateA(Toggle(i >> 1));
+            ic.ProcessUpdateClk(Toggle(i));
+        });
+    }
+
+    {
+        IC_74xx165_t ic;
+        ic.ProcessUpdateShLd(HIGH);
+        ic.ProcessUpdateClkInh(LOW);
+        Time("ic/74xx165/shift", [&ic](unsigned long i) {
+            ic.ProcessUpdateSer(Toggle(i >> 1));
+            ic.ProcessUpdateClk(Toggle(i));
+        });
+    }
+
+    {
+        IC_74xx193_t ic;
+        ic.ProcessUpdateClr(LOW);
+        ic.ProcessUpdateLoad(HIGH);
+        ic.ProcessUpdateDown(HIGH);
+        Time("ic/74xx193/count", [&ic](unsigned long i) { ic.ProcessUpdateUp(Toggle(i)); });
+    }
+
+    {
+        // -- the first trigger starts a pulse; it is not retriggerable, so the rest only update the pins
+        IC_74xx123_t ic;
+        ic.ProcessUpdateB1(HIGH);
+        ic.ProcessUpdateRD1b(HIGH);
+        Time("ic/74xx123/trigger", [&ic](unsigned long i) { ic.ProcessUpdateA1b(Toggle(i)); });
+    }
+
+
+    //
+    // -- the SRAM: reads as the address changes, writes on the #WE edge
+    //    --------------------------------------------------------------
+    {
+        IC_as6c62256_t ram;
+        ram.ProcessUpdateCE(LOW);
+        ram.ProcessUpdateWE(HIGH);
+        ram.ProcessUpdateOE(LOW);
+        Time("ic/as6c62256/read", [&ram](unsigned long i) { ram.ProcessUpdateA0(Toggle(i)); });
+
+        ram.ProcessUpdateOE(HIGH);
+        Time("ic/as6c62256/write", [&ram](unsigned long i) {
+            ram.ProcessUpdateDq0(Toggle(i >> 1));
+            ram.ProcessUpdateWE(Toggle(i));
+        });
+    }
+
+
+    //
+    // -- the ALU adder: a new 16-bit A operand against a fixed B
+    //    -------------------------------------------------------
+    {
+        IC_74xx541_t aLsb, aMsb, bLsb, bMsb;
+        HW_Bus_16_t bus("Bench", clock);
+        HW_AluAdder_t adder(&aLsb, &aMsb, &bLsb, &bMsb, &bus);
+
+        adder.ProcessAluBLsbUpdate(0x34, 0xff);
+        adder.ProcessAluBMsbUpdate(0x12, 0xff);
+
+        Time("alu/adder/full-add", [&adder](unsigned long i) {
+            adder.ProcessAluALsbUpdate(i & 0xff, 0xff);
+            adder.ProcessAluAMsbUpdate((i >> 8) & 0xff, 0xff);
+        });
+    }
+}
+
+
+
+//
+// -- Reset the computer and step it until the first CPU clock edge, which fetches the first instruction
+//    --------------------------------------------------------------------------------------------------
+bool HW_Bench_t::FirstFetch(const QString &name, bool fast)
+{
+    HW_Scheduler_t *sched = HW_Scheduler_t::Get();
+    ClockModule_t *clock = HW_Computer_t::GetClock();
+    bool fetched = false;
+
+    QMetaObject::Connection c = connect(clock, &ClockModule_t::SignalCpuClockOutput, this,
+            [&fetched](TriState_t state) { if (state == HIGH) fetched = true; });
+
+    HW_Computer_t::SetFastBoot(fast);
+
+    HW_Scheduler_t::Time_t start = sched->GetTime();
+    QElapsedTimer timer;
+    timer.start();
+
+    HW_Computer_t::Get()->PerformReset();
+    clock->SelectHighSpeedClock();
+
+    while (!fetched && sched->Step()) {}
+
+    qint64 ns = timer.nsecsElapsed();
+    disconnect(c);
+
+    if (!fetched) {
+        qDebug().noquote() << name << "never reached the first fetch";
+        return false;
+    }
+
+    Add(name, "ms", ns / 1000000.0, 1);
+    Add(name + "-simulated", "us", (sched->GetTime() - start) / 1000.0, 1);
+    return true;
+}
+
+
+
+//
+// -- The macro benchmarks, on the whole computer
+//    -------------------------------------------
+bool HW_Bench_t::RunMacro(unsigned long cycles, bool pedantic)
+{
+    HW_Scheduler_t *sched = HW_Scheduler_t::Get();
+
+    // -- the scheduler is stepped directly, unpaced
+    sched->Stop();
+    sched->SetTargetFrequency(0);
+
+    if (pedantic && Wanted("boot/first-fetch-pedantic")) {
+        if (!FirstFetch("boot/first-fetch-pedantic", false)) return false;
+    }
+
+    // -- the run needs a booted machine even when the boot is not wanted in the results
+    if (!FirstFetch("boot/first-fetch", true)) return false;
+
+    if (!Wanted("boot/first-fetch")) {
+        results.removeIf([](const Result_t &r) { return r.name.startsWith("boot/first-fetch") && !r.name.contains("pedantic"); });
+    }
+
+    if (!Wanted("run/cycles-per-second")) return true;
+
+    unsigned long target = Count() + cycles;
+    HW_Scheduler_t::Time_t start = sched->GetTime();
+    QElapsedTimer timer;
+    timer.start();
+
+    while (Count() < target && sched->Step()) {}
+
+    qint64 ns = timer.nsecsElapsed();
+    unsigned long ran = cycles - (target - Count());
+
+    Add("run/cycles-per-second", "cycles/s", ns ? ran * 1000000000.0 / ns : 0.0, ran);
+    Add("run/simulated-vs-wall", "ratio", ns ? (double)(sched->GetTime() - start) / ns : 0.0, ran);
+
+    return ran == cycles;
+}
+
+
+
+//
+// -- Print the results as a table
+//    ----------------------------
+void HW_Bench_t::Report(void) const
+{
+    qDebug().noquote() << QString("%1 %2 %3").arg("Benchmark", -36).arg("result", 16).arg("unit", -10);
+
+    for (const Result_t &r : results) {
+        qDebug().noquote() << QString("%1 %2 %3").arg(r.name, -36).arg(r.value, 16, 'f', 3).arg(r.unit, -10);
+    }
+}
+
+
+
+//
+// -- The results as JSON, for tracking from one release to the next
+//    --------------------------------------------------------------
+QByteArray HW_Bench_t::ToJson(void) const
+{
+    QJsonArray list;
+
+    for (const Result_t &r : results) {
+        list.append(QJsonObject {
+            { "name", r.name },
+            { "unit", r.unit },
+            { "value", r.value },
+            { "ops", (qint64)r.ops },
+        });
+    }
+
+    QJsonObject root {
+        { "format", FORMAT_VERSION },
+        { "date", QDateTime::currentDateTimeUtc().toString(Qt::ISODate) },
+        { "qt", QString(qVersion()) },
+        { "fidelity", HW_Computer_t::GetDefaultFidelity() == HW_Computer_t::BEHAVIORAL ? "behavioral" : "gate" },
+        { "results", list },
+    };
+
+    return QJsonDocument(root).toJson();
+}
+
+
@@ -19,61 +19,54 @@
 // -- Construct a new 1-bit bus
 //    -------------------------
 HW_Bus_1_t::HW_Bus_1_t(const QString &name, ClockModule_t *clk, QObject *parent)
-        : QObject(parent), assertedBits(new Map_t)
+        : QObject(parent), assertHigh(0), assertLow(0)
 {
     setObjectName(name);
 
-    (*assertedBits)[0] = new Asserts_t;
-
-    connect(clk, &ClockModule_t::SignalSanityCheck, this, &HW_Bus_1_t::ProcessSanityCheck);
+    connect(clk, &ClockModule_t::SignalSanityCheck, this, &HW_Bus_1_t::ProcessSanityCheck, CNN_TYPE);
+    HW_Snapshot_t::Get()->Register(this);
     MaintainBit(Z);
 }
 
 
 
 //
-// -- Maintain the bits on the 8-bit bus
-//    ----------------------------------
+// -- Save or restore the driver table first, so that the state kept by slot lines up with the same drivers
+//    -----------------------------------------------------------------------------------------------------
+void HW_Bus_1_t::Snapshot(HW_Snapshot_t::Stream_t &s)
+{
+    drivers.Snapshot(s);
+    s & assertHigh & assertLow;
+}
+
+
+
+//
+// -- Maintain the bit on the 1-bit bus
+//    ---------------------------------
 void HW_Bus_1_t::MaintainBit(TriState_t state)
 {
-    static int cnt = 0;
-    const int ITER = 25;
-
-    TriState_t old;
-    QObject *obj = sender();        // do NOT de-reference this pointer!  It may not be valid
-
-    // -- Now, check the reference count and update as appropriate
-    Asserts_t *asserts = (*assertedBits)[0];
-
-    if (obj != nullptr) {
-        if (state == Z) {
-            auto it = asserts->find(obj);
-            if (it != asserts->end()) {
-                asserts->remove(obj);
-            }
-        } else {
-            auto it = asserts->find(obj);
-            if (it != asserts->end()) {
-                (*asserts)[obj] = state;
-            } else {
-                (*asserts)[obj] = state;
-            }
-        }
-    }
+    int slot = drivers.Slot(sender(), this);      // do NOT de-reference the sender!  It may not be valid
+
+    if (slot >= 0) {
+        uint32_t me = (1u << slot);
 
-    // -- if nothing is being asserted, then default to low
-    if (asserts->isEmpty()) {
-        state = HIGH;        // pull-up resistor
-    } else {
-        auto it = asserts->find(obj);
-        if (it == asserts->end()) state = asserts->first();
-        else state = it.value();
+        assertHigh &= ~me;
+        assertLow &= ~me;
+
+        if (state == HIGH) assertHigh |= me;
+        else if (state == LOW) assertLow |= me;
     }
 
+    uint32_t all = assertHigh | assertLow;
+
+    // -- if nothing is being asserted, then default to high; the driver making the change wins any contention
+    if (all == 0) state = HIGH;        // pull-up resistor
+    else if (slot >= 0 && (all & (1u << slot))) state = (assertHigh & (1u << slot)) ? HIGH : LOW;
+    else state = (assertHigh & (all & -all)) ? HIGH : LOW;
 
     // -- emit the proper notifications
     emit SignalBit0Updated(state);
-    cnt ++;
 }
 
 
@@ -83,8 +76,9 @@ void HW_Bus_1_t::MaintainBit(TriState_t state)
 //    ------------------------------------------------------------------------------------------
 void HW_Bus_1_t::ProcessSanityCheck(void)
 {
-    if ((*assertedBits)[0]->count() > 1) {
-        qDebug() << "Bus" << objectName() << "bit 0 has" << (*assertedBits)[0]->count() << "signals asserted";
+    int cnt = __builtin_popcount(assertHigh | assertLow);
+    if (cnt > 1) {
+        qDebug() << "Bus" << objectName() << "bit 0 has" << cnt << "signals asserted";
     }
 }
 
@@ -19,53 +19,103 @@
 // -- Construct a new 16-bit bus
 //    -------------------------
 HW_Bus_16_t::HW_Bus_16_t(const QString &name, ClockModule_t *clk, QObject *parent)
-        : QObject(parent), assertedBits(new Map_t)
+        : QObject(parent), value(0), driveMask(0), highCnt {}, lowCnt {}, multiMask(0), contendedMask(0), traceVar(-1)
 {
     setObjectName(name);
 
-    for (int i = BIT_0; i <= BIT_F; i ++) (*assertedBits)[i] = new Asserts_t;
+    for (int i = 0; i < HW_BusDrivers_t::MAX_DRIVERS; i ++) driven[i] = HW_Logic16_t { 0, 0 };
 
-    connect(clk, &ClockModule_t::SignalSanityCheck, this, &HW_Bus_16_t::ProcessSanityCheck);
+    connect(clk, &ClockModule_t::SignalSanityCheck, this, &HW_Bus_16_t::ProcessSanityCheck, CNN_TYPE);
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
 
 //
-// -- Maintain the bits on the 16-bit bus
-//    -----------------------------------
-void HW_Bus_16_t::MaintainBit(int bit, TriState_t state)
+// -- Save or restore the driver table first, so that the state kept by slot lines up with the same drivers
+//    -----------------------------------------------------------------------------------------------------
+void HW_Bus_16_t::Snapshot(HW_Snapshot_t::Stream_t &s)
 {
-    QObject *obj = sender();        // do NOT de-reference this pointer!  It may not be valid
+    drivers.Snapshot(s);
+    s & driven & value;
 
-    // -- Now, check the reference count and update as appropriate
-    Asserts_t *asserts = (*assertedBits)[bit];
+    // -- everything else is worked out again from what each driver is putting on the bus
+    if (s.IsRestoring()) Recount();
+}
 
-    if (obj != nullptr) {
-        if (state == Z) {
-            auto it = asserts->find(obj);
-            if (it != asserts->end()) {
-                asserts->remove(obj);
-            }
-        } else {
-            auto it = asserts->find(obj);
-            if (it != asserts->end()) {
-                (*asserts)[obj] = state;
-            } else {
-                (*asserts)[obj] = state;
-            }
-        }
-    }
 
-    // -- if nothing is being asserted, then default to low
-    if (asserts->isEmpty()) {
-        state = LOW;        // pull-down resistor
-    } else {
-        auto it = asserts->find(obj);
-        if (it == asserts->end()) state = asserts->first();
-        else state = it.value();
+
+//
+// -- Count every driver again from scratch (after a restore); a contended bit keeps the value it was saved with
+//    ----------------------------------------------------------------------------------------------------------
+void HW_Bus_16_t::Recount(void)
+{
+    highCnt = lowCnt = HW_Count16_t {};
+
+    for (int i = 0; i < drivers.GetCount(); i ++) {
+        highCnt.Inc(driven[i].HighMask());
+        lowCnt.Inc(driven[i].LowMask());
     }
 
-    // -- emit the proper notifications
+    Resolve(-1, 0);
+}
+
+
+
+//
+// -- A driver is now putting `w` on the bus; only the bits it changed are counted again
+//    ----------------------------------------------------------------------------------
+void HW_Bus_16_t::Change(int slot, HW_Logic16_t w)
+{
+    HW_Logic16_t &d = driven[slot];
+    uint16_t bits = (d.known ^ w.known) | (d.value ^ w.value);
+
+    if (bits == 0) return;
+
+    highCnt.Dec(d.HighMask() & bits);
+    lowCnt.Dec(d.LowMask() & bits);
+
+    highCnt.Inc(w.HighMask() & bits);
+    lowCnt.Inc(w.LowMask() & bits);
+
+    d = w;
+}
+
+
+
+//
+// -- Resolve the drivers into the state of the bus; `slot` has just driven the bits in `mask`
+//
+//    The bits with any driver HIGH and the bits with any driver LOW are resolved as two drivers, all 16 bits at
+//    once.  A bit driven both ways is contended, but the bus still has to put a level out: the driver making the
+//    change wins, and any other bit stays as it was.  Nothing driving a bit leaves it pulled down to LOW.
+//    ----------------------------------------------------------------------------------------------------------
+void HW_Bus_16_t::Resolve(int slot, uint16_t mask)
+{
+    uint16_t high = highCnt.Any();
+    uint16_t low = lowCnt.Any();
+
+    HW_Logic16_t all = HW_Logic16_t::Resolve(HW_Logic16_t::Driven(0xffff, high), HW_Logic16_t::Driven(0, low));
+
+    uint16_t c = all.ContendedMask();
+    uint16_t mine = (slot >= 0 ? c & mask & driven[slot].known : 0);
+    uint16_t upd = all.HighMask() | (value & c & ~mine);
+
+    if (slot >= 0) upd |= driven[slot].value & mine;
+
+    value = upd;
+    driveMask = high | low;
+    contendedMask = c;
+    multiMask = (high & low) | highCnt.Many() | lowCnt.Many();
+}
+
+
+
+//
+// -- Emit the per-bit notification
+//    -----------------------------
+void HW_Bus_16_t::EmitBit(int bit, TriState_t state)
+{
     switch(bit) {
     case BIT_0: emit SignalBit0Updated(state); break;
     case BIT_1: emit SignalBit1Updated(state); break;
@@ -88,14 +138,86 @@ void HW_Bus_16_t::MaintainBit(int bit, TriState_t state)
 
 
 
+//
+// -- Maintain the bits on the 16-bit bus
+//    -----------------------------------
+void HW_Bus_16_t::MaintainBit(int bit, TriState_t state)
+{
+    int slot = drivers.Slot(sender(), this);      // do NOT de-reference the sender!  It may not be valid
+    uint16_t old = value;
+    uint16_t oldDrive = driveMask;
+    uint16_t oldC = contendedMask;
+
+    if (slot >= 0) Change(slot, driven[slot].With(bit, state));
+
+    // -- keep the word up to date before anything else can react to the change
+    Resolve(slot, 1 << bit);
+
+    if (unlikely(traceVar >= 0) && (value != old || driveMask != oldDrive || contendedMask != oldC)) {
+        HW_Trace_t::Get()->Record(traceVar, value | contendedMask, (uint16_t)(~driveMask | contendedMask));
+    }
+
+    EmitBit(bit, (value & (1 << bit)) ? HIGH : LOW);
+    if (value != old) emit SignalWordUpdated(value);
+}
+
+
+
+//
+// -- Maintain several bits on the 16-bit bus at once (only the bits in `mask` are connected to the driver)
+//
+//    The per-bit signals are only emitted for those bits that actually changed, and the word is emitted once.
+//    -------------------------------------------------------------------------------------------------------
+void HW_Bus_16_t::MaintainWord(uint16_t val, uint16_t drive, uint16_t mask)
+{
+    int slot = drivers.Slot(sender(), this);      // do NOT de-reference the sender!  It may not be valid
+    uint16_t old = value;
+    uint16_t oldDrive = driveMask;
+    uint16_t oldC = contendedMask;
+
+    if (slot >= 0) {
+        HW_Logic16_t w = HW_Logic16_t::Driven(val, drive);
+        HW_Logic16_t d = driven[slot];
+
+        d.known = (d.known & ~mask) | (w.known & mask);
+        d.value = (d.value & ~mask) | (w.value & mask);
+        Change(slot, d);
+    }
+
+    Resolve(slot, mask);
+
+    if (unlikely(traceVar >= 0) && (value != old || driveMask != oldDrive || contendedMask != oldC)) {
+        HW_Trace_t::Get()->Record(traceVar, value | contendedMask, (uint16_t)(~driveMask | contendedMask));
+    }
+
+    uint16_t changed = old ^ value;
+    if (changed == 0) return;
+
+    for (int i = BIT_0; i <= BIT_F; i ++) {
+        if (changed & (1 << i)) EmitBit(i, (value & (1 << i)) ? HIGH : LOW);
+    }
+
+    emit SignalWordUpdated(value);
+}
+
+
+
 //
 // -- Handle the sanity check at the clock high and low levels where the status should be stable
 //    ------------------------------------------------------------------------------------------
 void HW_Bus_16_t::ProcessSanityCheck(void)
 {
+    if (likely(multiMask == 0)) return;
+
     for (int i = BIT_0; i <= BIT_F; i ++) {
-        if ((*assertedBits)[i]->count() > 1) {
-            qDebug() << "Bus" << objectName() << "bit" << i << "has" << (*assertedBits)[i]->count() << "signals asserted";
+        if (!(multiMask & (1 << i))) continue;
+
+        int cnt = highCnt.Get(i) + lowCnt.Get(i);
+
+        if (contendedMask & (1 << i)) {
+            qDebug() << "Bus" << objectName() << "bit" << i << "has" << cnt << "signals asserted, driving it both ways";
+        } else {
+            qDebug() << "Bus" << objectName() << "bit" << i << "has" << cnt << "signals asserted";
         }
     }
 }
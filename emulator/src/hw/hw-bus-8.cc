@@ -19,13 +19,25 @@
 // -- Construct a new 8-bit bus
 //    -------------------------
 HW_Bus_8_t::HW_Bus_8_t(const QString &name, ClockModule_t *clk, QObject *parent)
-        : QObject(parent), assertedBits(new Map_t)
+        : QObject(parent)
 {
     setObjectName(name);
 
-    for (int i = BIT_0; i <= BIT_7; i ++) (*assertedBits)[i] = new Asserts_t;
+    for (int i = BIT_0; i <= BIT_7; i ++) assertHigh[i] = assertLow[i] = 0;
 
-    connect(clk, &ClockModule_t::SignalSanityCheck, this, &HW_Bus_8_t::ProcessSanityCheck);
+    connect(clk, &ClockModule_t::SignalSanityCheck, this, &HW_Bus_8_t::ProcessSanityCheck, CNN_TYPE);
+    HW_Snapshot_t::Get()->Register(this);
+}
+
+
+
+//
+// -- Save or restore the driver table first, so that the state kept by slot lines up with the same drivers
+//    -----------------------------------------------------------------------------------------------------
+void HW_Bus_8_t::Snapshot(HW_Snapshot_t::Stream_t &s)
+{
+    drivers.Snapshot(s);
+    s & assertHigh & assertLow;
 }
 
 
@@ -35,36 +47,25 @@ HW_Bus_8_t::HW_Bus_8_t(const QString &name, ClockModule_t *clk, QObject *parent)
 //    ----------------------------------
 void HW_Bus_8_t::MaintainBit(int bit, TriState_t state)
 {
-    TriState_t old;
-    QObject *obj = sender();        // do NOT de-reference this pointer!  It may not be valid
-
-    // -- Now, check the reference count and update as appropriate
-    Asserts_t *asserts = (*assertedBits)[bit];
-
-    if (obj != nullptr) {
-        if (state == Z) {
-            auto it = asserts->find(obj);
-            if (it != asserts->end()) {
-                asserts->remove(obj);
-            }
-        } else {
-            auto it = asserts->find(obj);
-            if (it != asserts->end()) {
-                (*asserts)[obj] = state;
-            } else {
-                (*asserts)[obj] = state;
-            }
-        }
-    }
+    int slot = drivers.Slot(sender(), this);      // do NOT de-reference the sender!  It may not be valid
+
+    if (slot >= 0) {
+        uint32_t me = (1u << slot);
 
-    // -- if nothing is being asserted, then default to low
-    if (asserts->isEmpty()) state = LOW;        // pull-down resistor
-    else {
-        auto it = asserts->find(obj);
-        if (it == asserts->end()) state = asserts->first();
-        else state = it.value();
+        assertHigh[bit] &= ~me;
+        assertLow[bit] &= ~me;
+
+        if (state == HIGH) assertHigh[bit] |= me;
+        else if (state == LOW) assertLow[bit] |= me;
     }
 
+    uint32_t all = assertHigh[bit] | assertLow[bit];
+
+    // -- if nothing is being asserted, then default to low; the driver making the change wins any contention
+    if (all == 0) state = LOW;        // pull-down resistor
+    else if (slot >= 0 && (all & (1u << slot))) state = (assertHigh[bit] & (1u << slot)) ? HIGH : LOW;
+    else state = (assertHigh[bit] & (all & -all)) ? HIGH : LOW;
+
     // -- emit the proper notifications
     switch(bit) {
     case BIT_0: emit SignalBit0Updated(state); break;
@@ -86,8 +87,9 @@ void HW_Bus_8_t::MaintainBit(int bit, TriState_t state)
 void HW_Bus_8_t::ProcessSanityCheck(void)
 {
     for (int i = BIT_0; i <= BIT_7; i ++) {
-        if ((*assertedBits)[i]->count() > 1) {
-            qDebug() << "Bus" << objectName() << "bit" << i << "has" << (*assertedBits)[i]->count() << "signals asserted";
+        int cnt = __builtin_popcount(assertHigh[i] | assertLow[i]);
+        if (cnt > 1) {
+            qDebug() << "Bus" << objectName() << "bit" << i << "has" << cnt << "signals asserted";
         }
     }
 }
@@ -16,6 +16,7 @@
 
 
 bool debug = false;
+bool headless = false;
 
 
 //
@@ -24,6 +25,24 @@ bool debug = false;
 QString HW_Computer_t::pgmRomFolder;
 
 
+//
+// -- Control ROM Folder location; read once from the settings at startup
+//    -------------------------------------------------------------------
+QString HW_Computer_t::ctrlRomFolder;
+
+
+//
+// -- The fidelity used for any module without a `fidelity/<module>` setting
+//    ----------------------------------------------------------------------
+HW_Computer_t::Fidelity_t HW_Computer_t::defaultFidelity = HW_Computer_t::GATE_LEVEL;
+
+
+//
+// -- Bulk-load the control ROMs at reset rather than shifting them in bit by bit; read from `fastBootKey`
+//    ----------------------------------------------------------------------------------------------------
+std::atomic<bool> HW_Computer_t::fastBoot(true);
+
+
 //
 // -- The settings for the application
 //    --------------------------------
@@ -85,6 +104,7 @@ InstructionRegisterModule_t *HW_Computer_t::instr = nullptr;
 
 // -- Widgets
 QWidget *HW_Computer_t::central = nullptr;
+QLabel *HW_Computer_t::speed = nullptr;
 
 
 
@@ -100,12 +120,30 @@ HW_BusDriver_t *HW_Computer_t::aluBDriver = nullptr;
 void HW_Computer_t::Initialize(void)
 {
     if (!settings) settings = new QSettings("eryjus", "16bcfs-emulator");
+    SetFastBoot(settings->value(fastBootKey, true).toBool());
+    ctrlRomFolder = settings->value(key).toString();
+
+    // -- the profile counts from construction on, so it starts before anything is built
+    QString profile = settings->value(profileKey).toString();
+    if (!headless && !profile.isEmpty()) HW_Profile_t::Get()->Start(profile);
 
     AllocateComponents();
-    BuildGui();
+    if (!headless) {
+        GUI_Frame_t::Get()->Start(settings->value(frameRateKey, GUI_Frame_t::DEFAULT_RATE).toInt());
+        HW_Scheduler_t::Get()->SetTargetCpuFrequency(settings->value(cpuTargetKey, 0).toDouble());
+        BuildGui();
+    }
+
     WireUp();
     FinalWireUp();
     TriggerFirstUpdate();
+
+    // -- only an interactive session needs to go back in time; 0 cycles between checkpoints turns it off
+    if (!headless) {
+        unsigned long interval = settings->value(historyIntervalKey, HW_History_t::DEFAULT_INTERVAL).toULongLong();
+        int budget = settings->value(historyBudgetKey, HW_History_t::DEFAULT_BUDGET_MB).toInt();
+        HW_History_t::Get()->Start(interval, budget);
+    }
 }
 
 
@@ -124,6 +162,21 @@ HW_Computer_t *HW_Computer_t::Get(void)
 }
 
 
+
+//
+// -- Determine the fidelity of a module: the `fidelity/<module>` setting is either "gate" or "behavioral"
+//    ----------------------------------------------------------------------------------------------------
+HW_Computer_t::Fidelity_t HW_Computer_t::GetFidelity(const QString &module)
+{
+    QString val = GetSettings()->value("fidelity/" + module).toString();
+
+    if (val == "behavioral") return BEHAVIORAL;
+    if (val == "gate") return GATE_LEVEL;
+
+    return defaultFidelity;
+}
+
+
 //
 // -- Some trivial implementations
 //    ----------------------------
@@ -186,7 +239,29 @@ void HW_Computer_t::BuildGui(void)
 
     singleton->statusBar()->showMessage("Hi!", 3000);
 
+    speed = new QLabel;
+    singleton->statusBar()->addPermanentWidget(speed);
+    connect(GUI_Frame_t::Get(), &GUI_Frame_t::SignalFrame, singleton, &HW_Computer_t::ProcessFrame);
+
     QMenu *fileMenu = singleton->menuBar()->addMenu("File");
+    QAction *saveAction = new QAction("Save Snapshot...");
+    saveAction->setStatusTip("Save the state of the whole machine");
+    connect(saveAction, &QAction::triggered, singleton, &HW_Computer_t::ProcessSaveSnapshot);
+    fileMenu->addAction(saveAction);
+
+    QAction *restoreAction = new QAction("Restore Snapshot...");
+    restoreAction->setStatusTip("Restore the state of the whole machine from a snapshot");
+    connect(restoreAction, &QAction::triggered, singleton, &HW_Computer_t::ProcessRestoreSnapshot);
+    fileMenu->addAction(restoreAction);
+    fileMenu->addSeparator();
+
+    QAction *traceAction = new QAction("Trace to VCD...");
+    traceAction->setCheckable(true);
+    traceAction->setStatusTip("Record the buses, control word and clock phases to a waveform file");
+    connect(traceAction, &QAction::toggled, singleton, &HW_Computer_t::ProcessTrace);
+    fileMenu->addAction(traceAction);
+    fileMenu->addSeparator();
+
     QAction *quitAction = new QAction("Quit");
     quitAction->setShortcuts(QKeySequence::Quit);
     quitAction->setStatusTip("Quit the emulator");
@@ -199,12 +274,24 @@ void HW_Computer_t::BuildGui(void)
     connect(settings, &QAction::triggered, singleton, &HW_Computer_t::ProcessSettingsWindow);
     editMenu->addAction(settings);
 
+    QMenu *historyMenu = singleton->menuBar()->addMenu("History");
+    QAction *stepBack = new QAction("Step Back");
+    stepBack->setStatusTip("Go back one CPU clock cycle");
+    connect(stepBack, &QAction::triggered, singleton, &HW_Computer_t::ProcessStepBack);
+    historyMenu->addAction(stepBack);
+
+    QAction *jump = new QAction("Jump to Cycle...");
+    jump->setStatusTip("Go backwards or forwards to a CPU clock cycle");
+    connect(jump, &QAction::triggered, singleton, &HW_Computer_t::ProcessJumpToCycle);
+    historyMenu->addAction(jump);
+
+    QAction *resume = new QAction("Resume");
+    resume->setStatusTip("Continue running from here");
+    connect(resume, &QAction::triggered, singleton, &HW_Computer_t::ProcessResume);
+    historyMenu->addAction(resume);
+
     singleton->setWindowTitle(tr("16bcfs Emulator"));
     singleton->show();
-
-    connect(reset, &ResetModule_t::SignalReset, clock, &ClockModule_t::ProcessReset);
-    connect(rHld, &HW_Bus_1_t::SignalBit0Updated, pgmRom, &PgmRomModule_t::ProcessRHld);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalFetchSuppress, pgmRom, &PgmRomModule_t::ProcessFetchSuppress);
 }
 
 
@@ -304,17 +391,26 @@ void HW_Computer_t::AllocateComponents(void)
 //    -----------------------
 void HW_Computer_t::WireUp(void)
 {
+    // -- any ROM image rebuilt since the last reset is swapped in before anything else sees the reset
+    connect(reset, &ResetModule_t::SignalReset, singleton,
+            [](TriState_t state) { if (state == LOW) HW_RomImage_t::ReloadChanged(); }, Qt::DirectConnection);
+
+    // -- these are made first (they used to be made while building the GUI) to keep the connection order
+    connect(reset, &ResetModule_t::SignalReset, clock, &ClockModule_t::ProcessReset, CNN_TYPE);
+    connect(rHld, &HW_Bus_1_t::SignalBit0Updated, pgmRom, &PgmRomModule_t::ProcessRHld, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalFetchSuppress, pgmRom, &PgmRomModule_t::ProcessFetchSuppress, CNN_TYPE);
+
     // -- connect up the clock
-    connect(clock, &ClockModule_t::SignalCpuClockLatch, pgmFlags, &AluFlagsModule_t::ProcessClockLatch);
-    connect(clock, &ClockModule_t::SignalCpuClockOutput, pgmFlags, &AluFlagsModule_t::ProcessClockOutput);
+    connect(clock, &ClockModule_t::SignalCpuClockLatch, pgmFlags, &AluFlagsModule_t::ProcessClockLatch, CNN_TYPE);
+    connect(clock, &ClockModule_t::SignalCpuClockOutput, pgmFlags, &AluFlagsModule_t::ProcessClockOutput, CNN_TYPE);
 
-    connect(clock, &ClockModule_t::SignalCpuClockOutput, singleton, &HW_Computer_t::SignalOscillatorStateChanged);
+    connect(clock, &ClockModule_t::SignalCpuClockOutput, singleton, &HW_Computer_t::SignalOscillatorStateChanged, CNN_TYPE);
 
     HW_Bus_1_t *cpyHld = HW_Computer_t::GetCpyHldBus();
-    connect(cpyHld, &HW_Bus_1_t::SignalBit0Updated, ctrlLogic, &ControlLogic_MidPlane_t::ProcessSanityCheck);
-    connect(cpyHld, &HW_Bus_1_t::SignalBit0Updated, clock, &ClockModule_t::ProcessCpyHld);
+    connect(cpyHld, &HW_Bus_1_t::SignalBit0Updated, ctrlLogic, &ControlLogic_MidPlane_t::ProcessSanityCheck, CNN_TYPE);
+    connect(cpyHld, &HW_Bus_1_t::SignalBit0Updated, clock, &ClockModule_t::ProcessCpyHld, CNN_TYPE);
 
-    connect(clock, &ClockModule_t::SignalHighSpeedClockLatch, ctrlLogic, &ControlLogic_MidPlane_t::ProcessRawSystemClock);
+    connect(clock, &ClockModule_t::SignalHighSpeedClockLatch, ctrlLogic, &ControlLogic_MidPlane_t::ProcessRawSystemClock, CNN_TYPE);
 }
 
 
@@ -341,6 +437,162 @@ void HW_Computer_t::ProcessSettingsWindow(void)
 
 
 
+//
+// -- save a snapshot of the machine
+//    ------------------------------
+void HW_Computer_t::ProcessSaveSnapshot(void)
+{
+    QString file = QFileDialog::getSaveFileName(this, "Save Snapshot", QString(), "Snapshots (*.snap)");
+    if (file.isEmpty()) return;
+
+    bool ok;
+    HW_SimThread_t::Get()->Call([&ok, &file](void) { ok = HW_Snapshot_t::Get()->Save(file); });
+
+    if (ok) statusBar()->showMessage("Saved " + file, 3000);
+    else statusBar()->showMessage("Unable to save " + file, 3000);
+}
+
+
+
+//
+// -- restore a snapshot of the machine; the LEDs catch up as the signals they show next change
+//    -----------------------------------------------------------------------------------------
+void HW_Computer_t::ProcessRestoreSnapshot(void)
+{
+    QString file = QFileDialog::getOpenFileName(this, "Restore Snapshot", QString(), "Snapshots (*.snap)");
+    if (file.isEmpty()) return;
+
+    bool ok;
+    HW_SimThread_t::Get()->Call([&ok, &file](void) { ok = HW_Snapshot_t::Get()->Restore(file); });
+
+    if (ok) statusBar()->showMessage("Restored " + file, 3000);
+    else statusBar()->showMessage("Unable to restore " + file, 3000);
+}
+
+
+
+//
+// -- start or stop tracing to a VCD file
+//    -----------------------------------
+void HW_Computer_t::ProcessTrace(bool on)
+{
+    QAction *action = qobject_cast<QAction *>(sender());
+
+    if (!on) {
+        HW_SimThread_t::Get()->Call([](void) { HW_Trace_t::Get()->Stop(); });
+        statusBar()->showMessage("Trace stopped", 3000);
+        return;
+    }
+
+    QString file = QFileDialog::getSaveFileName(this, "Trace to VCD", QString(), "Waveforms (*.vcd)");
+    bool ok = false;
+
+    // -- the probes go on between slices, so the ring is only ever written from the simulation thread
+    if (!file.isEmpty()) HW_SimThread_t::Get()->Call([&ok, &file](void) { ok = HW_Trace_t::Get()->Start(file); });
+
+    if (!ok) {
+        QSignalBlocker block(action);
+        if (action) action->setChecked(false);
+        if (!file.isEmpty()) statusBar()->showMessage("Unable to trace to " + file, 3000);
+        return;
+    }
+
+    statusBar()->showMessage("Tracing to " + file, 3000);
+}
+
+
+
+//
+// -- go back one CPU clock cycle; the machine is left stopped there
+//    --------------------------------------------------------------
+void HW_Computer_t::ProcessStepBack(void)
+{
+    bool ok;
+    unsigned long cycle;
+    HW_SimThread_t::Get()->Call([&ok, &cycle](void) { ok = HW_History_t::Get()->StepBack(); cycle = Count(); });
+
+    if (ok) statusBar()->showMessage("Stopped at cycle " + QString::number(cycle));
+    else statusBar()->showMessage("Unable to step back", 3000);
+}
+
+
+
+//
+// -- go to any CPU clock cycle from the earliest checkpoint on; the machine is left stopped there
+//    --------------------------------------------------------------------------------------------
+void HW_Computer_t::ProcessJumpToCycle(void)
+{
+    bool ok;
+    unsigned long earliest, now;
+    HW_SimThread_t::Get()->Call([&earliest, &now](void) {
+        earliest = HW_History_t::Get()->GetEarliestCycle();
+        now = Count();
+    });
+
+    QString text = QInputDialog::getText(this, "Jump to Cycle", "Cycle (from " + QString::number(earliest) + "):",
+            QLineEdit::Normal, QString::number(now), &ok);
+    if (!ok) return;
+
+    unsigned long cycle = text.toULong(&ok);
+    if (!ok) return;
+
+    HW_SimThread_t::Get()->Call([&ok, &now, cycle](void) { ok = HW_History_t::Get()->JumpTo(cycle); now = Count(); });
+
+    if (ok) statusBar()->showMessage("Stopped at cycle " + QString::number(now));
+    else statusBar()->showMessage("Unable to reach cycle " + text, 3000);
+}
+
+
+
+//
+// -- carry on from wherever the history left the machine
+//    ---------------------------------------------------
+void HW_Computer_t::ProcessResume(void)
+{
+    HW_SimThread_t::Get()->Post([](void) { HW_Scheduler_t::Get()->Start(); });
+    statusBar()->clearMessage();
+}
+
+
+
+//
+// -- Show a message on the status bar from either thread; without a GUI there is nowhere to show it
+//    ----------------------------------------------------------------------------------------------
+void HW_Computer_t::ShowMessage(const QString &msg)
+{
+    if (headless || singleton == nullptr) return;
+
+    HW_SimThread_t::Get()->PostGui(singleton, [msg](void) { singleton->statusBar()->showMessage(msg, 3000); });
+}
+
+
+
+//
+// -- Show a frequency in the units that suit it
+//    ------------------------------------------
+QString HW_Computer_t::FormatHz(double hz)
+{
+    if (hz >= 1000000.0) return QString::number(hz / 1000000.0, 'f', 3) + " MHz";
+    if (hz >= 1000.0) return QString::number(hz / 1000.0, 'f', 3) + " kHz";
+    return QString::number(hz, 'f', 1) + " Hz";
+}
+
+
+
+//
+// -- Keep the CPU clock on the status bar up to date with what the simulation last published
+//    ---------------------------------------------------------------------------------------
+void HW_Computer_t::ProcessFrame(void)
+{
+    HW_SimThread_t::State_t state = HW_SimThread_t::Get()->Read();
+    QString text = "CPU " + FormatHz(state.achievedHz);
+
+    if (state.targetHz > 0) text += " (target " + FormatHz(state.targetHz) + ")";
+    if (speed->text() != text) speed->setText(text);
+}
+
+
+
 //
 // -- Perform the steps needed to execute a proper reset
 //    --------------------------------------------------
@@ -384,50 +636,50 @@ void HW_Computer_t::PerformReset(void)
 void HW_Computer_t::FinalWireUp(void)
 {
     // -- Wire up the PC Register
-    connect(HW_Computer_t::GetRHldBus(), &HW_Bus_1_t::SignalBit0Updated, pgmpc, &GpRegisterModule_t::ProcessReset);
-    connect(clock, &ClockModule_t::SignalCpuClockLatch, pgmpc, &GpRegisterModule_t::ProcessClockLatch);
-    connect(clock, &ClockModule_t::SignalCpuClockOutput, pgmpc, &GpRegisterModule_t::ProcessClockOutput);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalPgmPCLoad, pgmpc, &GpRegisterModule_t::ProcessLoad);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalPgmPCInc, pgmpc, &GpRegisterModule_t::ProcessInc);
+    connect(HW_Computer_t::GetRHldBus(), &HW_Bus_1_t::SignalBit0Updated, pgmpc, &GpRegisterModule_t::ProcessReset, CNN_TYPE);
+    connect(clock, &ClockModule_t::SignalCpuClockLatch, pgmpc, &GpRegisterModule_t::ProcessClockLatch, CNN_TYPE);
+    connect(clock, &ClockModule_t::SignalCpuClockOutput, pgmpc, &GpRegisterModule_t::ProcessClockOutput, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalPgmPCLoad, pgmpc, &GpRegisterModule_t::ProcessLoad, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalPgmPCInc, pgmpc, &GpRegisterModule_t::ProcessInc, CNN_TYPE);
     pgmpc->ProcessDec(LOW);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapPgmPC, pgmpc, &GpRegisterModule_t::ProcessAssertSwap);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalMainBusAssertPgmPC, pgmpc, &GpRegisterModule_t::ProcessAssertMain);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapPgmPC, pgmpc, &GpRegisterModule_t::ProcessAssertSwap, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalMainBusAssertPgmPC, pgmpc, &GpRegisterModule_t::ProcessAssertMain, CNN_TYPE);
     pgmpc->ProcessAssertAluA(LOW);
     pgmpc->ProcessAssertAluB(LOW);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalAddrBus1AssertPgmPC, pgmpc, &GpRegisterModule_t::ProcessAssertAddr1);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalAddrBus1AssertPgmPC, pgmpc, &GpRegisterModule_t::ProcessAssertAddr1, CNN_TYPE);
     pgmpc->ProcessAssertAddr2(LOW);
 
 
     // -- Wire up the R1 Register
-    connect(HW_Computer_t::GetRHldBus(), &HW_Bus_1_t::SignalBit0Updated, r1, &GpRegisterModule_t::ProcessReset);
-    connect(clock, &ClockModule_t::SignalCpuClockLatch, r1, &GpRegisterModule_t::ProcessClockLatch);
-    connect(clock, &ClockModule_t::SignalCpuClockOutput, r1, &GpRegisterModule_t::ProcessClockOutput);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalR1Load, r1, &GpRegisterModule_t::ProcessLoad);
+    connect(HW_Computer_t::GetRHldBus(), &HW_Bus_1_t::SignalBit0Updated, r1, &GpRegisterModule_t::ProcessReset, CNN_TYPE);
+    connect(clock, &ClockModule_t::SignalCpuClockLatch, r1, &GpRegisterModule_t::ProcessClockLatch, CNN_TYPE);
+    connect(clock, &ClockModule_t::SignalCpuClockOutput, r1, &GpRegisterModule_t::ProcessClockOutput, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalR1Load, r1, &GpRegisterModule_t::ProcessLoad, CNN_TYPE);
     r1->ProcessInc(LOW);
     r1->ProcessDec(LOW);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR1, r1, &GpRegisterModule_t::ProcessAssertSwap);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalMainBusAssertR1, r1, &GpRegisterModule_t::ProcessAssertMain);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalALUBusAAssertR1, r1, &GpRegisterModule_t::ProcessAssertAluA);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalALUBusBAssertR1, r1, &GpRegisterModule_t::ProcessAssertAluB);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR1, r1, &GpRegisterModule_t::ProcessAssertSwap, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalMainBusAssertR1, r1, &GpRegisterModule_t::ProcessAssertMain, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalALUBusAAssertR1, r1, &GpRegisterModule_t::ProcessAssertAluA, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalALUBusBAssertR1, r1, &GpRegisterModule_t::ProcessAssertAluB, CNN_TYPE);
     r1->ProcessAssertAddr1(LOW);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR1, r1, &GpRegisterModule_t::ProcessAssertAddr2);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR1, r1, &GpRegisterModule_t::ProcessAssertAddr2, CNN_TYPE);
 
 
     // -- Wire up the Fetch Register
-    connect(HW_Computer_t::GetRHldBus(), &HW_Bus_1_t::SignalBit0Updated, fetch, &FetchRegisterModule_t::ProcessReset);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalInstructionSuppress, fetch, &FetchRegisterModule_t::ProcessInstructionSuppress);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalMainBusAssertFetch, fetch, &FetchRegisterModule_t::ProcessAssertMain);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalALUBusBAssertFetch, fetch, &FetchRegisterModule_t::ProcessAssertAluB);
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalAddrBus2AssertFetch, fetch, &FetchRegisterModule_t::ProcessAssertAddr2);
+    connect(HW_Computer_t::GetRHldBus(), &HW_Bus_1_t::SignalBit0Updated, fetch, &FetchRegisterModule_t::ProcessReset, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalInstructionSuppress, fetch, &FetchRegisterModule_t::ProcessInstructionSuppress, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalMainBusAssertFetch, fetch, &FetchRegisterModule_t::ProcessAssertMain, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalALUBusBAssertFetch, fetch, &FetchRegisterModule_t::ProcessAssertAluB, CNN_TYPE);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalAddrBus2AssertFetch, fetch, &FetchRegisterModule_t::ProcessAssertAddr2, CNN_TYPE);
 
 
 
     // -- Control signals into the clock
-    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalBreak, clock, &ClockModule_t::ProcessSignalBreak);
+    connect(ctrlLogic, &ControlLogic_MidPlane_t::SignalBreak, clock, &ClockModule_t::ProcessSignalBreak, CNN_TYPE);
 
 
 
-    connect(reset, &ResetModule_t::SignalReset, ctrlLogic, &ControlLogic_MidPlane_t::ProcessReset);
+    connect(reset, &ResetModule_t::SignalReset, ctrlLogic, &ControlLogic_MidPlane_t::ProcessReset, CNN_TYPE);
 }
 
 
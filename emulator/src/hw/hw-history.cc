@@ -0,0 +1,290 @@
+//===================================================================================================================
+//  hw-history.cc -- Checkpoints and an input log, so the machine can be stepped backwards or jumped to any cycle
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/hw-history.moc.cc"
+
+
+
+//
+// -- Static class members
+//    --------------------
+HW_History_t *HW_History_t::singleton = nullptr;
+
+
+
+//
+// -- Construct the history; nothing is recorded until it is started
+//    --------------------------------------------------------------
+HW_History_t::HW_History_t(void)
+{
+    started = false;
+    replaying = false;
+    capturePending = false;
+    jumping = false;
+    interval = DEFAULT_INTERVAL;
+    nextCheckpoint = 0;
+    seq = 0;
+    next = 0;
+    budget = (qsizetype)DEFAULT_BUDGET_MB * 1024 * 1024;
+    used = 0;
+}
+
+
+
+//
+// -- Get the singleton instance, creating it as needed
+//    -------------------------------------------------
+HW_History_t *HW_History_t::Get(void)
+{
+    if (unlikely(singleton == nullptr)) singleton = new HW_History_t;
+    return singleton;
+}
+
+
+
+//
+// -- Add an input; it is dropped again when it is deleted
+//    ----------------------------------------------------
+void HW_History_t::AddInput(QObject *obj, std::function<void(int)> fn)
+{
+    inputs.append({obj, fn});
+
+    connect(obj, &QObject::destroyed, this, [this, obj](void) {
+        for (Input_t &in : inputs) if (in.obj == obj) in.obj = nullptr;    // keep the indices in the log valid
+    });
+}
+
+
+
+//
+// -- Start recording: the first checkpoint is taken as soon as the scheduler runs
+//    ----------------------------------------------------------------------------
+void HW_History_t::Start(unsigned long cycles, int budgetMb)
+{
+    if (started || cycles == 0) return;
+
+    started = true;
+    interval = cycles;
+    budget = (qsizetype)budgetMb * 1024 * 1024;
+    nextCheckpoint = HW_Computer_t::GetClock()->GetClockCount() + interval;
+
+    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalCpuClockOutput, this, &HW_History_t::ProcessCpuClock, CNN_TYPE);
+    connect(HW_Snapshot_t::Get(), &HW_Snapshot_t::SignalRestored, this, &HW_History_t::ProcessRestored, CNN_TYPE);
+
+    capturePending = true;
+    HW_Scheduler_t::Get()->Schedule(0, this, [this]() { capturePending = false; TakeCheckpoint(); });
+}
+
+
+
+//
+// -- Log a change to an external input
+//    ---------------------------------
+void HW_History_t::LogInput(QObject *obj, int value)
+{
+    if (!started || replaying) return;
+
+    for (int i = 0; i < inputs.size(); i ++) {
+        if (inputs[i].obj != obj) continue;
+
+        Diverge();
+        changes.append({HW_Scheduler_t::Get()->GetTime(), ++ seq, i, value});
+        next = changes.size();
+        return;
+    }
+}
+
+
+
+//
+// -- A live input after jumping back starts a new timeline; forget the future of the old one
+//    ---------------------------------------------------------------------------------------
+void HW_History_t::Diverge(void)
+{
+    for (HW_Scheduler_t::EventId_t id : replays) HW_Scheduler_t::Get()->Cancel(id);
+    replays.clear();
+
+    changes.resize(next);
+
+    unsigned long count = HW_Computer_t::GetClock()->GetClockCount();
+
+    while (checkpoints.size() > 1 && checkpoints.last().cycle > count) {
+        used -= checkpoints.last().state.size();
+        checkpoints.removeLast();
+    }
+}
+
+
+
+//
+// -- Count the CPU clock cycles to know when the next checkpoint is due
+//    ------------------------------------------------------------------
+void HW_History_t::ProcessCpuClock(TriState_t state)
+{
+    if (state != HIGH || capturePending) return;
+
+    unsigned long count = HW_Computer_t::GetClock()->GetClockCount();
+    if (count < nextCheckpoint) return;
+
+    nextCheckpoint = (count / interval + 1) * interval;
+
+    // -- the rest of the machine is still reacting to this edge; take the checkpoint once it has settled
+    capturePending = true;
+    HW_Scheduler_t::Get()->Schedule(0, this, [this]() { capturePending = false; TakeCheckpoint(); });
+}
+
+
+
+//
+// -- Take a checkpoint, unless the run is being replayed and there is already one here or later
+//    ------------------------------------------------------------------------------------------
+void HW_History_t::TakeCheckpoint(void)
+{
+    unsigned long count = HW_Computer_t::GetClock()->GetClockCount();
+
+    if (!checkpoints.isEmpty() && checkpoints.last().cycle >= count) return;
+
+    Checkpoint_t cp;
+    cp.cycle = count;
+    cp.time = HW_Scheduler_t::Get()->GetTime();
+    cp.seq = ++ seq;
+    cp.state = qCompress(HW_Snapshot_t::Get()->Capture(), 1);
+
+    used += cp.state.size();
+    checkpoints.append(cp);
+
+    if (used > budget) Thin();
+}
+
+
+
+//
+// -- Over budget: drop every other checkpoint after the first and space the new ones twice as far apart
+//    --------------------------------------------------------------------------------------------------
+void HW_History_t::Thin(void)
+{
+    while (used > budget && checkpoints.size() > 2) {
+        for (int i = checkpoints.size() - 2; i > 0; i -= 2) {
+            used -= checkpoints[i].state.size();
+            checkpoints.removeAt(i);
+        }
+
+        interval *= 2;
+    }
+
+    nextCheckpoint = checkpoints.last().cycle + interval;
+}
+
+
+
+//
+// -- A snapshot was restored, which dropped any pending checkpoint or replay; one from elsewhere starts over
+//
+//    This is only signalled once a snapshot has actually been restored.  One which was rejected changed
+//    nothing, not even the pending events, so the checkpoints and the change log stay as they were.
+//    -------------------------------------------------------------------------------------------------------
+void HW_History_t::ProcessRestored(void)
+{
+    capturePending = false;
+    replays.clear();
+
+    if (jumping) return;
+
+    checkpoints.clear();
+    changes.clear();
+    next = 0;
+    used = 0;
+
+    nextCheckpoint = HW_Computer_t::GetClock()->GetClockCount() + interval;
+    TakeCheckpoint();
+}
+
+
+
+//
+// -- Put back a logged input change
+//    ------------------------------
+void HW_History_t::Replay(int i)
+{
+    const Change_t &ch = changes[i];
+    next = i + 1;
+
+    if (!inputs[ch.input].obj) return;
+
+    replaying = true;
+    inputs[ch.input].replay(ch.value);
+    replaying = false;
+}
+
+
+
+//
+// -- Bring the machine to `cycle`, restoring the closest checkpoint before it if that is needed or faster
+//    ----------------------------------------------------------------------------------------------------
+bool HW_History_t::JumpTo(unsigned long cycle)
+{
+    HW_Scheduler_t *sched = HW_Scheduler_t::Get();
+    ClockModule_t *clock = HW_Computer_t::GetClock();
+    unsigned long count = clock->GetClockCount();
+
+    sched->Stop();
+
+    int idx = -1;
+    for (int i = 0; i < checkpoints.size() && checkpoints[i].cycle <= cycle; i ++) idx = i;
+
+    if (cycle < count || (idx >= 0 && checkpoints[idx].cycle > count)) {
+        if (idx < 0) {
+            qDebug().noquote() << "Cycle" << cycle << "is before the earliest checkpoint";
+            return false;
+        }
+
+        const Checkpoint_t &cp = checkpoints[idx];
+
+        jumping = true;
+        bool ok = HW_Snapshot_t::Get()->Apply(qUncompress(cp.state));
+        jumping = false;
+
+        if (!ok) {
+            qDebug().noquote() << "Unable to restore the checkpoint at cycle" << cp.cycle;
+            return false;
+        }
+
+        next = 0;
+        while (next < changes.size() && changes[next].seq < cp.seq) next ++;
+
+        for (int i = next; i < changes.size(); i ++) {
+            replays.append(sched->Schedule(changes[i].time + 1 - cp.time, this, [this, i]() { Replay(i); }));
+        }
+
+        nextCheckpoint = (cp.cycle / interval + 1) * interval;
+    }
+
+    while (clock->GetClockCount() < cycle && sched->Step()) {}
+
+    return clock->GetClockCount() == cycle;
+}
+
+
+
+//
+// -- Go back one CPU clock cycle
+//    ---------------------------
+bool HW_History_t::StepBack(void)
+{
+    unsigned long count = HW_Computer_t::GetClock()->GetClockCount();
+    if (count == 0) return false;
+
+    return JumpTo(count - 1);
+}
+
+
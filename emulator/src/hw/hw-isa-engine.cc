@@ -0,0 +1,288 @@
+//===================================================================================================================
+//  hw-isa-engine.cc -- An instruction-level engine executing straight from the control ROM images
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/hw-isa-engine.moc.cc"
+
+
+
+//
+// -- Construct the engine with empty images
+//    --------------------------------------
+HW_IsaEngine_t::HW_IsaEngine_t(QObject *parent) : QObject(parent)
+{
+    memset(ctrlStore, 0, sizeof(ctrlStore));
+    memset(pgmRom, 0, sizeof(pgmRom));
+    memset(decoded, 0, sizeof(decoded));
+
+    Reset();
+}
+
+
+
+//
+// -- Read a ROM image; like the gate-level ROMs, a missing file reads as 0x00 and a short one as `fill` past its end
+//    ---------------------------------------------------------------------------------------------------------------
+bool HW_IsaEngine_t::ReadImage(const QString &file, QByteArray &image, qsizetype size, uint8_t fill)
+{
+    image.fill(0, size);
+
+    FILE *fp = fopen(file.toStdString().c_str(), "rb");
+    if (!fp) {
+        qDebug() << "Unable to open file" << file;
+        return false;
+    }
+
+    size_t cnt = fread(image.data(), 1, size, fp);
+    bool ok = !ferror(fp);
+    fclose(fp);
+
+    if (!ok) {
+        qDebug() << "Unable to read file" << file;
+        image.fill(0);
+        return false;
+    }
+
+    if ((qsizetype)cnt < size) memset(image.data() + cnt, fill, size - cnt);
+    return true;
+}
+
+
+
+//
+// -- Load the 16 control ROM images (`ctrl0.bin` through `ctrlf.bin`) from a folder
+//    ------------------------------------------------------------------------------
+bool HW_IsaEngine_t::LoadControlRoms(const QString &folder)
+{
+    QByteArray image;
+    bool rv = true;
+
+    for (int rom = 0; rom < CTRL_ROMS; rom ++) {
+        QString file = folder + "/ctrl" + QString::number(rom, 16) + ".bin";
+
+        if (!ReadImage(file, image, CTRL_SIZE, 0x00)) rv = false;
+        for (int a = 0; a < CTRL_SIZE; a ++) ctrlStore[a][rom] = image[a];
+    }
+
+    memset(decoded, 0, sizeof(decoded));
+
+    return rv;
+}
+
+
+
+//
+// -- Load the program ROM image pair (`lsb.bin` and `msb.bin`) from a folder
+//    -----------------------------------------------------------------------
+bool HW_IsaEngine_t::LoadProgramRom(const QString &folder)
+{
+    QByteArray lsb;
+    QByteArray msb;
+    bool rv = true;
+
+    if (!ReadImage(folder + "/lsb.bin", lsb, PGM_SIZE, 0xff)) rv = false;
+    if (!ReadImage(folder + "/msb.bin", msb, PGM_SIZE, 0xff)) rv = false;
+
+    for (int a = 0; a < PGM_SIZE; a ++) pgmRom[a] = (uint8_t)lsb[a] | ((uint8_t)msb[a] << 8);
+
+    return rv;
+}
+
+
+
+//
+// -- Put the CPU into its reset state: everything cleared, so the first instruction is a NOP
+//    ---------------------------------------------------------------------------------------
+void HW_IsaEngine_t::Reset(void)
+{
+    memset(value, 0, sizeof(value));
+    memset(q, 0, sizeof(q));
+
+    fetch = 0;
+    instr = 0;
+    fetchBus = 0;
+    pgmFlags = 0;
+    intFlags = 0;
+    halted = false;
+    cycles = 0;
+}
+
+
+
+//
+// -- Decode the control word at a control ROM address, the first time it is used
+//    ---------------------------------------------------------------------------
+const HW_IsaEngine_t::Decoded_t &HW_IsaEngine_t::Decode(uint16_t addr)
+{
+    Decoded_t &d = decoded[addr];
+    if (likely(d.valid)) return d;
+
+    const uint8_t *w = ctrlStore[addr];
+    auto Bit = [w](int rom, int bit) -> bool { return (w[rom] >> bit) & 1; };
+    auto Mask = [](bool b, uint32_t m) -> uint32_t { return b ? m : 0; };
+
+    memset(&d, 0, sizeof(d));
+
+    static const int8_t addr1Src[4] = { PGM_PC, PGM_RA, INT_PC, INT_RA };
+    d.addr1 = addr1Src[w[0] & 0x03];
+
+    // -- Address Bus 2 only addresses memory, which is not built yet, so it is not decoded
+
+    int f = w[2] & 0x0f;
+    if (f >= 1 && f <= 12) d.aluA = R1 + f - 1;
+    else if (f == 14) d.aluA = PGM_SP;
+    else if (f == 15) d.aluA = INT_SP;
+    else d.aluA = SRC_NONE;
+
+    f = w[3] & 0x0f;
+    if (f >= 1 && f <= 12) d.aluB = R1 + f - 1;
+    else if (f == 13) d.aluB = PGM_SP;
+    else if (f == 14) d.aluB = INT_SP;
+    else if (f == 15) d.aluB = SRC_FETCH;
+    else d.aluB = SRC_NONE;
+
+    f = w[4] & 0x3f;
+    if (f >= 1 && f <= 18) d.main = R1 + f - 1;             // the Main Bus numbers the registers in order
+    else if (f == 19) d.main = SRC_FETCH;
+    else if (f == 30) d.main = SRC_ALU;
+    else d.main = SRC_NONE;
+
+    d.swap = Bit(4, 6);
+    d.instrSuppress = Bit(4, 7);
+    d.carrySelect = w[5] & 0x03;
+    d.subtract = Bit(8, 1);
+    d.fetchSuppress = Bit(6, 3);
+    d.brk = Bit(6, 5);
+
+
+    //
+    // -- R1-R12 are packed as Load/Inc/Dec triples from ctrl9 bit 7 on
+    //    -------------------------------------------------------------
+    for (int r = R1; r <= R12; r ++) {
+        int n = 3 * (r - R1);
+        d.load |= Mask((w[9 + n / 8] >> (7 - n % 8)) & 1, 1 << r);
+        n ++;
+        d.inc |= Mask((w[9 + n / 8] >> (7 - n % 8)) & 1, 1 << r);
+        n ++;
+        d.dec |= Mask((w[9 + n / 8] >> (7 - n % 8)) & 1, 1 << r);
+    }
+
+    d.load |= Mask(Bit(7, 6), 1 << PGM_PC) | Mask(Bit(7, 4), 1 << PGM_RA) | Mask(Bit(7, 2), 1 << INT_PC)
+            | Mask(Bit(7, 0), 1 << INT_RA) | Mask(Bit(8, 7), 1 << PGM_SP) | Mask(Bit(8, 4), 1 << INT_SP);
+    d.inc |= Mask(Bit(7, 7), 1 << PGM_PC) | Mask(Bit(7, 5), 1 << PGM_RA) | Mask(Bit(7, 3), 1 << INT_PC)
+            | Mask(Bit(7, 1), 1 << INT_RA) | Mask(Bit(8, 6), 1 << PGM_SP) | Mask(Bit(8, 3), 1 << INT_SP);
+    d.dec |= Mask(Bit(8, 5), 1 << PGM_SP) | Mask(Bit(8, 2), 1 << INT_SP);
+
+
+    //
+    // -- the flags; the explicit carry and overflow controls are decoded where the mid-plane decodes them
+    //    ------------------------------------------------------------------------------------------------
+    d.pgmLatch = Mask(Bit(0, 5), FLAG_Z) | Mask(Bit(0, 3), FLAG_C) | Mask(Bit(1, 7), FLAG_N)
+            | Mask(Bit(1, 5), FLAG_V) | Mask(Bit(2, 7), FLAG_L);
+    d.intLatch = Mask(Bit(0, 4), FLAG_Z) | Mask(Bit(0, 2), FLAG_C) | Mask(Bit(1, 6), FLAG_N)
+            | Mask(Bit(1, 4), FLAG_V) | Mask(Bit(2, 6), FLAG_L);
+    d.pgmClear = Mask(Bit(0, 7), FLAG_C) | Mask(Bit(2, 5), FLAG_V);
+    d.pgmSet = Mask(Bit(0, 6), FLAG_C) | Mask(Bit(2, 4), FLAG_V);
+
+    d.valid = true;
+    return d;
+}
+
+
+
+//
+// -- Execute one CPU clock cycle
+//    ---------------------------
+void HW_IsaEngine_t::Step(void)
+{
+    if (halted) return;
+
+
+    //
+    // -- rising edge: the control word, fetch register and register outputs all latch; the instruction bus
+    //    is fed from the fetch register unless suppressed (and then the pull-downs make it a NOP)
+    //    -------------------------------------------------------------------------------------------------
+    const Decoded_t &d = Decode(instr & 0x7fff);
+    fetch = fetchBus;
+    memcpy(q, value, sizeof(q));
+    instr = d.instrSuppress ? 0 : fetch;
+
+
+    //
+    // -- clock high: drive the buses
+    //    ---------------------------
+    uint16_t aluA = Read(d.aluA);
+    uint16_t aluB = Read(d.aluB);
+
+    uint32_t cin;
+    switch (d.carrySelect) {
+        case 0: cin = 0; break;
+        case 1: cin = (pgmFlags & FLAG_C) ? 1 : 0; break;
+        case 2: cin = (pgmFlags & FLAG_C) ? 0 : 1; break;
+        default: cin = 1; break;
+    }
+
+    uint16_t b = d.subtract ? ~aluB : aluB;
+    uint32_t sum = aluA + b + cin;
+    uint16_t result = sum & 0xffff;
+    bool carry = (sum >> 16) & 1;
+    bool overflow = (~(aluA ^ b) & (aluA ^ result)) & 0x8000;
+
+    uint16_t mainBus = (d.main == SRC_ALU) ? result : Read(d.main);
+    if (d.swap) mainBus = (mainBus << 8) | (mainBus >> 8);
+
+    fetchBus = d.fetchSuppress ? 0 : pgmRom[q[d.addr1] & 0x7fff];
+
+
+    //
+    // -- clock high: LOAD is transparent, so the registers take the Main Bus; then on the falling edge the
+    //    counters move
+    //    -------------------------------------------------------------------------------------------------
+    for (uint32_t m = d.load; m; m &= m - 1) value[__builtin_ctz(m)] = mainBus;
+    for (uint32_t m = d.inc; m; m &= m - 1) value[__builtin_ctz(m)] ++;
+    for (uint32_t m = d.dec; m; m &= m - 1) value[__builtin_ctz(m)] --;
+
+
+    //
+    // -- falling edge: the flags latch
+    //    -----------------------------
+    if (d.pgmLatch | d.intLatch) {
+        bool n = mainBus & 0x8000;
+        uint8_t flags = (mainBus == 0 ? FLAG_Z : 0) | (carry ? FLAG_C : 0) | (n ? FLAG_N : 0)
+                | (overflow ? FLAG_V : 0) | ((n != overflow) ? FLAG_L : 0);
+
+        pgmFlags = (pgmFlags & ~d.pgmLatch) | (flags & d.pgmLatch);
+        intFlags = (intFlags & ~d.intLatch) | (flags & d.intLatch);
+    }
+
+    pgmFlags = (pgmFlags & ~d.pgmClear) | d.pgmSet;
+
+    if (d.brk) halted = true;
+
+    cycles ++;
+}
+
+
+
+//
+// -- Run up to `count` cycles, stopping early on a BREAK
+//    ---------------------------------------------------
+unsigned long HW_IsaEngine_t::Run(unsigned long count)
+{
+    unsigned long start = cycles;
+
+    while (!halted && cycles - start < count) Step();
+
+    return cycles - start;
+}
+
+
@@ -0,0 +1,366 @@
+//===================================================================================================================
+//  hw-netlist.cc -- An event-driven netlist kernel to propagate signals between components
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/hw-netlist.moc.cc"
+
+
+
+//
+// -- Construct a new (empty) netlist
+//    -------------------------------
+HW_Netlist_t::HW_Netlist_t(const QString &name, QObject *parent)
+        : QObject(parent), levelized(false), lowest(0), delta(0), settling(false), events(0), evaluations(0)
+{
+    setObjectName(name);
+    HW_Snapshot_t::Get()->Register(this);
+}
+
+
+
+//
+// -- Add a new net to the netlist, returning its index
+//    -------------------------------------------------
+HW_Netlist_t::Net_t HW_Netlist_t::NewNet(TriState_t initial)
+{
+    state.append(initial);
+    next.append(initial);
+    queued.append(false);
+    fanout.append(QList<Component_t *>());
+    drivers.append(QList<Component_t *>());
+    lanes.append(initial == HIGH ? ~0ull : 0);
+
+    return state.size() - 1;
+}
+
+
+
+//
+// -- Levelize the netlist so it can be settled level by level
+//
+//    This only works when there is no feedback in the logic.  When there is, the netlist is left as it was and
+//    will continue to be settled delta cycle by delta cycle.
+//    -------------------------------------------------------------------------------------------------------
+bool HW_Netlist_t::Levelize(void)
+{
+    QList<Component_t *> comps;
+
+    for (int n = 0; n < state.size(); n ++) {
+        for (Component_t *c : fanout[n]) if (!comps.contains(c)) comps.append(c);
+        for (Component_t *c : drivers[n]) if (!comps.contains(c)) comps.append(c);
+    }
+
+    for (Component_t *c : comps) c->level = 0;
+
+    // -- keep pushing levels up until nothing changes; with no feedback this takes no more passes than components
+    bool changed = true;
+    int passes = 0;
+
+    while (changed) {
+        if (++ passes > comps.size() + 1) {
+            qDebug() << "Netlist" << objectName() << "has feedback and cannot be levelized";
+            return false;
+        }
+
+        changed = false;
+
+        for (int n = 0; n < state.size(); n ++) {
+            for (Component_t *d : drivers[n]) {
+                for (Component_t *c : fanout[n]) {
+                    if (c->level <= d->level) {
+                        c->level = d->level + 1;
+                        changed = true;
+                    }
+                }
+            }
+        }
+    }
+
+    int top = 0;
+    for (Component_t *c : comps) if (c->level > top) top = c->level;
+
+    levels.clear();
+    for (int l = 0; l <= top; l ++) levels.append(QList<Component_t *>());
+
+    order.clear();
+    for (int l = 0; l <= top; l ++) {
+        for (Component_t *c : comps) if (c->level == l) order.append(c);
+    }
+
+    levelized = true;
+    return true;
+}
+
+
+
+//
+// -- Queue a change to a net, to be applied when the netlist is next settled
+//    -----------------------------------------------------------------------
+void HW_Netlist_t::Schedule(Net_t net, TriState_t s)
+{
+    next[net] = s;
+
+    if (!queued[net]) {
+        queued[net] = true;
+        changes.append(net);
+    }
+}
+
+
+
+//
+// -- Queue a component to be evaluated, once no matter how many of its inputs changed
+//    --------------------------------------------------------------------------------
+void HW_Netlist_t::Queue(Component_t *comp)
+{
+    if (comp->queued) return;
+    comp->queued = true;
+
+    if (levelized) {
+        levels[comp->level].append(comp);
+        if (comp->level < lowest) lowest = comp->level;
+    } else {
+        evals.append(comp);
+    }
+}
+
+
+
+//
+// -- Apply the queued changes to the nets, queueing each component reading a changed net
+//    -----------------------------------------------------------------------------------
+void HW_Netlist_t::Commit(void)
+{
+    work.swap(changes);
+
+    for (Net_t n : work) {
+        queued[n] = false;
+        if (state[n] == next[n]) continue;
+
+        state[n] = next[n];
+        events ++;
+
+        for (Component_t *c : fanout[n]) Queue(c);
+    }
+
+    work.clear();
+}
+
+
+
+//
+// -- Settle the netlist
+//
+//    When the drive comes from outside the netlist, this is called right away so that the outputs are stable
+//    by the time the caller gets control back -- as they would be with a direct connection.  A caller may also
+//    Schedule() several nets and then Settle() once.
+//    -------------------------------------------------------------------------------------------------------
+void HW_Netlist_t::Settle(void)
+{
+    if (settling) return;           // the settle already running will pick up anything new
+    settling = true;
+
+    if (levelized) SettleLevels();
+    else SettleDeltas();
+
+    settling = false;
+}
+
+
+
+//
+// -- Run delta cycles until nothing changes
+//    --------------------------------------
+void HW_Netlist_t::SettleDeltas(void)
+{
+    int cnt = 0;
+
+    while (!changes.isEmpty()) {
+        if (unlikely(++ cnt > MAX_DELTAS)) {
+            qDebug() << "Netlist" << objectName() << "did not settle after" << MAX_DELTAS << "delta cycles";
+
+            for (Net_t n : changes) queued[n] = false;
+            changes.clear();
+            break;
+        }
+
+        delta ++;
+        Commit();
+
+        // -- evaluate; anything driven here is picked up by the next delta cycle
+        for (Component_t *c : evals) {
+            c->queued = false;
+            c->Evaluate();
+        }
+
+        evaluations += evals.size();
+        evals.clear();
+    }
+}
+
+
+
+//
+// -- Evaluate the queued components level by level; each level only feeds the levels above it
+//    -----------------------------------------------------------------------------------------
+void HW_Netlist_t::SettleLevels(void)
+{
+    int cnt = 0;
+
+    lowest = levels.size();
+    Commit();
+
+    int l = lowest;
+
+    while (l < levels.size()) {
+        if (unlikely(++ cnt > MAX_DELTAS)) {
+            qDebug() << "Netlist" << objectName() << "did not settle after" << MAX_DELTAS << "levels";
+
+            for (QList<Component_t *> &lvl : levels) {
+                for (Component_t *c : lvl) c->queued = false;
+                lvl.clear();
+            }
+            break;
+        }
+
+        delta ++;
+        evals.swap(levels[l]);
+
+        for (Component_t *c : evals) {
+            c->queued = false;
+            c->Evaluate();
+        }
+
+        evaluations += evals.size();
+        evals.clear();
+
+        // -- a level below this one only needs work again if something drove the netlist from outside
+        lowest = levels.size();
+        Commit();
+
+        if (lowest <= l) l = lowest;
+        else while (l < levels.size() && levels[l].isEmpty()) l ++;
+    }
+}
+
+
+//
+// -- Evaluate every component once, in level order, across all 64 lanes
+//    ------------------------------------------------------------------
+void HW_Netlist_t::SettleLanes(void)
+{
+    if (!levelized) {
+        qDebug() << "Netlist" << objectName() << "must be levelized for bit-sliced evaluation";
+        return;
+    }
+
+    for (Component_t *c : order) c->EvaluateLanes();
+
+    evaluations += order.size();
+}
+
+
+
+//
+// -- Bind a pin of a component to a net it reads
+//    -------------------------------------------
+void HW_Netlist_t::Component_t::BindInput(HW_Netlist_t *nl, int pin, Net_t net)
+{
+    netlist = nl;
+    nets[pin] = net;
+    inputs |= (1u << pin);
+    nl->AddFanout(net, this);
+}
+
+
+
+//
+// -- Bind a pin of a component to a net it drives
+//    --------------------------------------------
+void HW_Netlist_t::Component_t::BindOutput(HW_Netlist_t *nl, int pin, Net_t net)
+{
+    netlist = nl;
+    nets[pin] = net;
+    outputs |= (1u << pin);
+    nl->AddDriver(net, this);
+}
+
+
+
+//
+// -- Drive the bound output nets from the pins, settling once for all of them
+//    ------------------------------------------------------------------------
+void HW_Netlist_t::Component_t::DriveOutputs(void)
+{
+    if (outputs == 0) return;
+
+    for (uint32_t o = outputs; o; o &= o - 1) {
+        int pin = __builtin_ctz(o);
+        netlist->Schedule(nets[pin], pins[pin]);
+    }
+
+    netlist->Settle();
+}
+
+
+
+//
+// -- When scheduled by a netlist, pick up all the input nets and update the outputs once
+//    -----------------------------------------------------------------------------------
+void HW_Netlist_t::Component_t::Evaluate(void)
+{
+    for (uint32_t i = inputs; i; i &= i - 1) {
+        int pin = __builtin_ctz(i);
+        pins[pin] = netlist->Get(nets[pin]);
+    }
+
+    Update();
+}
+
+
+
+//
+// -- Evaluate the lanes one at a time through the truth table, for an IC with no bit-sliced version
+//
+//    The pins are put back afterwards, so the scalar state of the IC is left as it was.
+//    ----------------------------------------------------------------------------------------------
+void HW_Netlist_t::Component_t::EvaluateLanes(void)
+{
+    TriState_t saved[MAX_PINS];
+    uint64_t in[MAX_PINS];
+    uint64_t out[MAX_PINS] = { 0 };
+
+    for (int p = 1; p < pinCount; p ++) {
+        saved[p] = pins[p];
+        if (inputs & (1u << p)) in[p] = InputLanes(p);
+    }
+
+    for (int l = 0; l < 64; l ++) {
+        for (uint32_t i = inputs; i; i &= i - 1) {
+            int pin = __builtin_ctz(i);
+            pins[pin] = (in[pin] >> l) & 1 ? HIGH : LOW;
+        }
+
+        Compute();
+
+        for (int p = 1; p < pinCount; p ++) {
+            if (pins[p] == HIGH) out[p] |= (1ull << l);
+        }
+    }
+
+    for (int p = 1; p < pinCount; p ++) {
+        pins[p] = saved[p];
+        if (!(inputs & (1u << p))) SetOutputLanes(p, out[p]);
+    }
+}
+
+
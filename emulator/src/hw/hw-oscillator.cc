@@ -20,8 +20,44 @@
 HW_Oscillator_t::HW_Oscillator_t(int interval)
 {
     state = LOW;
-    ProcessSetInterval(500);
-    connect(this, &QTimer::timeout, this, &HW_Oscillator_t::ProcessTimerStateChange);
+    running = false;
+    nextEdge = 0;
+    ProcessSetInterval(interval);
+    HW_Scheduler_t::Get()->Register(this);
+    HW_Snapshot_t::Get()->Register(this);
+}
+
+
+//
+// -- the scheduler must not take an edge on a deleted oscillator
+//    -----------------------------------------------------------
+HW_Oscillator_t::~HW_Oscillator_t()
+{
+    stop();
+    HW_Scheduler_t::Get()->Unregister(this);
+}
+
+
+//
+// -- start the oscillator: its first edge is one interval from now
+//    -------------------------------------------------------------
+void HW_Oscillator_t::StartTimer(void)
+{
+    running = true;
+    nextEdge = HW_Scheduler_t::Get()->GetTime() + halfPeriod;
+    HW_Scheduler_t::Get()->Start();
+}
+
+
+//
+// -- set the interval between edges in ms (the QTimer interval this replaces); 0 is the high-speed crystal
+//    -----------------------------------------------------------------------------------------------------
+void HW_Oscillator_t::ProcessSetInterval(int interval)
+{
+    halfPeriod = (interval <= 0) ? CRYSTAL_HALF_PERIOD : (HW_Scheduler_t::Time_t)interval * 1000000;
+
+    // -- like a QTimer, a running oscillator restarts its interval
+    if (running) nextEdge = HW_Scheduler_t::Get()->GetTime() + halfPeriod;
 }
 
 
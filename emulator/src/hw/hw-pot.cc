@@ -23,9 +23,13 @@ HW_Pot_t::HW_Pot_t(Qt::Orientation orient) : QSlider(orient)
     setMaximum(10);
     setFixedWidth(35);
     setValue(5);
+    pos = 5;
 
     label = new QLabel("5");
     label->setAlignment(Qt::AlignHCenter);
 
     connect(this, &QSlider::valueChanged, this, &HW_Pot_t::ProcessUpdateValue);
+
+    HW_Snapshot_t::Get()->Register(this);
+    HW_History_t::Get()->RegisterInput(this);
 }
@@ -0,0 +1,314 @@
+//===================================================================================================================
+//  hw-profile.cc -- Count where the simulation spends its time: IC input changes, signal emits and no-op updates
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/hw-profile.moc.cc"
+
+
+
+//
+// -- Qt's signal spy hook.  It is not in a public header (it is in `qobject_p.h`), but it has kept this shape
+//    since Qt 4 and QtTest relies on it to log signals.  It is only used when asked for, and only for the Qt
+//    versions it is known to have this shape in.
+//    -----------------------------------------------------------------------------------------------------
+#if defined(PROFILE_SIGNAL_SPY) && QT_VERSION >= QT_VERSION_CHECK(5, 0, 0) && QT_VERSION < QT_VERSION_CHECK(7, 0, 0)
+#define HAVE_SIGNAL_SPY 1
+
+QT_BEGIN_NAMESPACE
+struct QSignalSpyCallbackSet {
+    typedef void (*BeginCallback)(QObject *caller, int signal_or_method_index, void **argv);
+    typedef void (*EndCallback)(QObject *caller, int signal_or_method_index);
+    BeginCallback signal_begin_callback, slot_begin_callback;
+    EndCallback signal_end_callback, slot_end_callback;
+};
+
+void Q_CORE_EXPORT qt_register_signal_spy_callbacks(QSignalSpyCallbackSet *callback_set);
+QT_END_NAMESPACE
+
+
+static void SignalBegin(QObject *caller, int method, void **argv)
+{
+    HW_Profile_t::Get()->CountEmit(caller, method, argv);
+}
+
+static QSignalSpyCallbackSet spy = { SignalBegin, nullptr, nullptr, nullptr };
+#else
+#define HAVE_SIGNAL_SPY 0
+#endif
+
+
+
+//
+// -- Static class members
+//    --------------------
+HW_Profile_t *HW_Profile_t::singleton = nullptr;
+bool HW_Profile_t::enabled = false;
+
+
+
+//
+// -- Get the singleton instance, creating it as needed
+//    -------------------------------------------------
+HW_Profile_t *HW_Profile_t::Get(void)
+{
+    if (unlikely(singleton == nullptr)) singleton = new HW_Profile_t;
+    return singleton;
+}
+
+
+
+//
+// -- Start counting
+//    --------------
+void HW_Profile_t::Start(const QString &json)
+{
+    if (enabled) return;
+
+    jsonFile = json;
+    ics.clear();
+    inputs.clear();
+    emits.clear();
+
+    enabled = true;
+#if HAVE_SIGNAL_SPY
+    qt_register_signal_spy_callbacks(&spy);
+#endif
+
+    connect(qApp, &QCoreApplication::aboutToQuit, this, &HW_Profile_t::Stop, Qt::UniqueConnection);
+}
+
+
+
+//
+// -- Count a call to an input slot
+//    -----------------------------
+void HW_Profile_t::CountInput(QObject *ic, const char *slot, bool changed)
+{
+    Ic_t &i = ics[ic];
+    Slot_t &s = inputs[SlotKey_t(ic, slot)];
+
+    s.calls ++;
+
+    if (changed) {
+        i.changes ++;
+    } else {
+        i.noops ++;
+        s.noops ++;
+    }
+}
+
+
+
+//
+// -- Count a signal being emitted, and whether it carries anything different from the last time
+//    ------------------------------------------------------------------------------------------
+void HW_Profile_t::CountEmit(QObject *sender, int method, void **argv)
+{
+    // -- the GUI and the trace writer emit from their own threads; only the simulation (wherever the scheduler
+    //    runs) is counted
+    if (QThread::currentThread() != HW_Scheduler_t::Get()->thread()) return;
+
+    Signal_t &s = emits[SignalKey_t(sender, method)];
+
+    if (s.emits == 0) {
+        QMetaMethod m = sender->metaObject()->method(method);
+
+        s.name = QByteArray(sender->metaObject()->className()) + "::" + m.name();
+        for (int i = 0; i < m.parameterCount(); i ++) s.sizes.append(m.parameterMetaType(i).sizeOf());
+    }
+
+    QByteArray args;
+    for (int i = 0; i < s.sizes.size(); i ++) args.append((const char *)argv[i + 1], s.sizes[i]);
+
+    if (s.emits == 0 || args != s.last) {
+        s.changes ++;
+        s.last = args;
+    }
+
+    s.emits ++;
+}
+
+
+
+//
+// -- Name each component: its object name when it has one, otherwise its class and which one of them it is
+//    ------------------------------------------------------------------------------------------------------
+QHash<QObject *, QString> HW_Profile_t::Names(void)
+{
+    QHash<QObject *, QString> rv;
+    QHash<QString, int> seen;
+
+    for (QObject *obj : HW_Snapshot_t::Get()->GetComponents()) {
+        QString cls = obj->metaObject()->className();
+        int n = seen[cls] ++;
+
+        if (obj->objectName().isEmpty()) rv[obj] = cls + "#" + QString::number(n);
+        else rv[obj] = cls + " (" + obj->objectName() + ")";
+    }
+
+    return rv;
+}
+
+
+
+//
+// -- Report the busiest ICs, signals and slots
+//    -----------------------------------------
+void HW_Profile_t::Report(const QHash<QObject *, QString> &names)
+{
+    qDebug().noquote() << "Activity over" << Count() << "cycles";
+
+
+    //
+    // -- the ICs, by input changes
+    //    -------------------------
+    QList<QObject *> icList = ics.keys();
+    std::sort(icList.begin(), icList.end(), [this](QObject *a, QObject *b) {
+        return ics[a].changes > ics[b].changes;
+    });
+
+    qDebug().noquote() << "";
+    qDebug().noquote() << QString("%1 %2 %3").arg("IC", -50).arg("input changes", 14).arg("no-op updates", 14);
+
+    for (int i = 0; i < icList.size() && i < REPORT_ROWS; i ++) {
+        const Ic_t &ic = ics[icList[i]];
+        QString name = names.value(icList[i]);
+
+        qDebug().noquote() << QString("%1 %2 %3").arg(name, -50).arg(ic.changes, 14).arg(ic.noops, 14);
+    }
+
+
+    //
+    // -- the signals, by emits which changed nothing
+    //    -------------------------------------------
+    QList<SignalKey_t> sigList;
+    for (auto it = emits.cbegin(); it != emits.cend(); ++ it) {
+        if (names.contains(it.key().first)) sigList.append(it.key());
+    }
+
+    std::sort(sigList.begin(), sigList.end(), [this](const SignalKey_t &a, const SignalKey_t &b) {
+        return emits[a].emits - emits[a].changes > emits[b].emits - emits[b].changes;
+    });
+
+    qDebug().noquote() << "";
+    if (!HAVE_SIGNAL_SPY) qDebug().noquote() << "Signal emits are not counted in this build";
+    qDebug().noquote() << QString("%1 %2 %3 %4").arg("Signal", -50).arg("emits", 14).arg("transitions", 14)
+            .arg("redundant", 14);
+
+    for (int i = 0; i < sigList.size() && i < REPORT_ROWS; i ++) {
+        const Signal_t &s = emits[sigList[i]];
+        QString name = names.value(sigList[i].first) + " " + QString(s.name).section("::", 1);
+
+        qDebug().noquote() << QString("%1 %2 %3 %4").arg(name, -50).arg(s.emits, 14).arg(s.changes, 14)
+                .arg(s.emits - s.changes, 14);
+    }
+
+
+    //
+    // -- the input slots, by no-op updates
+    //    ---------------------------------
+    QList<SlotKey_t> slotList = inputs.keys();
+    std::sort(slotList.begin(), slotList.end(), [this](const SlotKey_t &a, const SlotKey_t &b) {
+        return inputs[a].noops > inputs[b].noops;
+    });
+
+    qDebug().noquote() << "";
+    qDebug().noquote() << QString("%1 %2 %3").arg("Input slot", -50).arg("calls", 14).arg("no-op updates", 14);
+
+    for (int i = 0; i < slotList.size() && i < REPORT_ROWS; i ++) {
+        const Slot_t &s = inputs[slotList[i]];
+        QString name = names.value(slotList[i].first) + " " + slotList[i].second;
+
+        qDebug().noquote() << QString("%1 %2 %3").arg(name, -50).arg(s.calls, 14).arg(s.noops, 14);
+    }
+}
+
+
+
+//
+// -- Write every count out as JSON
+//    -----------------------------
+bool HW_Profile_t::Dump(const QHash<QObject *, QString> &names)
+{
+    QJsonArray icArray;
+    for (auto it = ics.cbegin(); it != ics.cend(); ++ it) {
+        icArray.append(QJsonObject {
+            { "ic", names.value(it.key()) },
+            { "input_changes", (qint64)it.value().changes },
+            { "noops", (qint64)it.value().noops },
+        });
+    }
+
+    QJsonArray sigArray;
+    for (auto it = emits.cbegin(); it != emits.cend(); ++ it) {
+        if (!names.contains(it.key().first)) continue;
+
+        sigArray.append(QJsonObject {
+            { "component", names.value(it.key().first) },
+            { "signal", QString(it.value().name) },
+            { "emits", (qint64)it.value().emits },
+            { "transitions", (qint64)it.value().changes },
+        });
+    }
+
+    QJsonArray slotArray;
+    for (auto it = inputs.cbegin(); it != inputs.cend(); ++ it) {
+        slotArray.append(QJsonObject {
+            { "ic", names.value(it.key().first) },
+            { "slot", QString(it.key().second) },
+            { "calls", (qint64)it.value().calls },
+            { "noops", (qint64)it.value().noops },
+        });
+    }
+
+    QJsonObject root {
+        { "cycles", (qint64)Count() },
+        { "time_ns", (qint64)HW_Scheduler_t::Get()->GetTime() },
+        { "ics", icArray },
+        { "signals", sigArray },
+        { "slots", slotArray },
+    };
+
+    QFile f(jsonFile);
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qDebug().noquote() << "Unable to write profile" << jsonFile;
+        return false;
+    }
+
+    f.write(QJsonDocument(root).toJson());
+    return true;
+}
+
+
+
+//
+// -- Stop counting, report, and write the JSON
+//    -----------------------------------------
+void HW_Profile_t::Stop(void)
+{
+    if (!enabled) return;
+
+    // -- the counting stops between slices, so nothing is counted while the report is being made
+    HW_SimThread_t::Get()->Call([](void) {
+        enabled = false;
+#if HAVE_SIGNAL_SPY
+        qt_register_signal_spy_callbacks(nullptr);
+#endif
+    });
+
+    QHash<QObject *, QString> names = Names();
+
+    Report(names);
+    if (!jsonFile.isEmpty()) Dump(names);
+}
+
+
@@ -0,0 +1,203 @@
+//===================================================================================================================
+//  hw-rom-image.cc -- A ROM image file, mapped into memory once and shared by every IC that loads it
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/hw-rom-image.moc.cc"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+
+//
+// -- Static class members
+//    --------------------
+QMap<QString, HW_RomImage_t *> HW_RomImage_t::images;
+QFileSystemWatcher *HW_RomImage_t::watcher = nullptr;
+const uint8_t HW_RomImage_t::blank[SIZE] = { 0 };
+
+
+
+//
+// -- Construct an image and map its file
+//    -----------------------------------
+HW_RomImage_t::HW_RomImage_t(const QString &file, uint8_t fill) : path(file), fill(fill), refs(0), stale(false), map(nullptr), data(blank),
+        generation(0), checksum(qChecksum(QByteArrayView((const char *)blank, SIZE)))
+{
+    Map();
+}
+
+
+
+//
+// -- Unmap the image as it goes away
+//    -------------------------------
+HW_RomImage_t::~HW_RomImage_t()
+{
+    Unmap();
+}
+
+
+
+//
+// -- Map the file; anything short of 32K reads as the fill byte past its end
+//    -----------------------------------------------------------------------
+void HW_RomImage_t::Map(void)
+{
+    int fd = open(path.toStdString().c_str(), O_RDONLY);
+
+    if (fd < 0) {
+        qDebug() << "Unable to open file" << path;
+        return;
+    }
+
+    struct stat st;
+    long len = (fstat(fd, &st) == 0) ? qMin((long)st.st_size, (long)SIZE) : 0;
+
+    // -- a zeroed 32K region first, then the file over the front of it (a page past EOF would be SIGBUS)
+    void *m = mmap(nullptr, SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (m != MAP_FAILED && len > 0) {
+        if (mmap(m, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+            munmap(m, SIZE);
+            m = MAP_FAILED;
+        }
+    }
+
+    close(fd);
+
+    if (m == MAP_FAILED) {
+        qDebug() << "Unable to map file" << path;
+        return;
+    }
+
+    // -- copy-on-write each page of the file so the image no longer depends on it (see the header)
+    map = (uint8_t *)m;
+    for (long pg = 0; pg < len; pg += sysconf(_SC_PAGESIZE)) {
+        volatile uint8_t *p = map + pg;
+        *p = *p;
+    }
+
+    if (len < SIZE) memset(map + len, fill, SIZE - len);
+
+    mprotect(map, SIZE, PROT_READ);
+    data = map;
+    checksum = qChecksum(QByteArrayView((const char *)data, SIZE));
+    generation ++;
+}
+
+
+
+//
+// -- Drop the mapping and read as blank
+//    ----------------------------------
+void HW_RomImage_t::Unmap(void)
+{
+    data = blank;
+    checksum = qChecksum(QByteArrayView((const char *)blank, SIZE));
+    generation ++;
+
+    if (map) munmap(map, SIZE);
+    map = nullptr;
+}
+
+
+
+//
+// -- Get the image for a file, mapping it the first time it is asked for
+//    -------------------------------------------------------------------
+HW_RomImage_t *HW_RomImage_t::Get(const QString &file, uint8_t fill)
+{
+    QFileInfo info(file);
+    QString key = info.exists() ? info.canonicalFilePath() : info.absoluteFilePath();
+
+    HW_RomImage_t *rv = images.value(Key(key, fill), nullptr);
+
+    if (!rv) {
+        if (unlikely(watcher == nullptr)) {
+            watcher = new QFileSystemWatcher;
+            connect(watcher, &QFileSystemWatcher::fileChanged, watcher, &HW_RomImage_t::ProcessFileChanged);
+        }
+
+        rv = new HW_RomImage_t(key, fill);
+        images.insert(Key(key, fill), rv);
+        if (info.exists()) watcher->addPath(key);
+    }
+
+    rv->refs ++;
+    return rv;
+}
+
+
+
+//
+// -- Release an image; the last one out unmaps it
+//    --------------------------------------------
+void HW_RomImage_t::Release(HW_RomImage_t *image)
+{
+    if (image == nullptr || -- image->refs > 0) return;
+
+    images.remove(Key(image->path, image->fill));
+
+    // -- the same file may still be loaded with another fill
+    bool shared = false;
+    for (HW_RomImage_t *other : images) shared = shared || other->path == image->path;
+
+    if (watcher && !shared) watcher->removePath(image->path);
+    delete image;
+}
+
+
+
+//
+// -- A watched file changed: the new contents are picked up at the next reset
+//    ------------------------------------------------------------------------
+void HW_RomImage_t::ProcessFileChanged(const QString &file)
+{
+    for (HW_RomImage_t *image : images) {
+        if (image->path == file) image->stale.store(true, std::memory_order_relaxed);
+    }
+
+    // -- a file replaced rather than rewritten drops off the watch list; put it back
+    if (!watcher->files().contains(file) && QFileInfo::exists(file)) watcher->addPath(file);
+}
+
+
+
+//
+// -- Remap every image whose file has changed since it was mapped
+//    ------------------------------------------------------------
+void HW_RomImage_t::ReloadChanged(void)
+{
+    for (HW_RomImage_t *image : images) {
+        if (!image->stale.load(std::memory_order_relaxed)) continue;
+
+        image->Unmap();
+        image->Map();
+        image->stale.store(false, std::memory_order_relaxed);
+
+        // -- the watcher belongs to the GUI thread; this is called at a reset, on the simulation thread
+        if (watcher) {
+            QString path = image->path;
+
+            HW_SimThread_t::Get()->PostGui(watcher, [path](void) {
+                if (!watcher->files().contains(path) && QFileInfo::exists(path)) watcher->addPath(path);
+            });
+        }
+
+        HW_Computer_t::ShowMessage("Reloaded " + image->path);
+    }
+}
+
+
@@ -0,0 +1,438 @@
+//===================================================================================================================
+//  hw-scheduler.cc -- The virtual-time scheduler which owns simulated time and drives the oscillators
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/hw-scheduler.moc.cc"
+
+
+
+//
+// -- Static class members
+//    --------------------
+HW_Scheduler_t *HW_Scheduler_t::singleton = nullptr;
+
+
+
+//
+// -- Construct the scheduler at simulated time 0, paced to real time
+//    ---------------------------------------------------------------
+HW_Scheduler_t::HW_Scheduler_t(void)
+{
+    now = 0;
+    running = false;
+    paceBase = 0;
+    cpuHz = 0;
+    achievedHz = 0;
+    windowCycles = 0;
+    windowTime = 0;
+
+    tick = 0;
+    nextDue = NEVER;
+    lastId = 0;
+    pending = 0;
+
+    slice = new QTimer(this);
+    slice->setTimerType(Qt::PreciseTimer);
+    slice->setInterval(0);
+    connect(slice, &QTimer::timeout, this, &HW_Scheduler_t::ProcessSlice);
+
+    SetTargetFrequency(1000000000.0 / (2 * HW_Oscillator_t::CRYSTAL_HALF_PERIOD));
+}
+
+
+
+//
+// -- Get the singleton instance, creating it as needed
+//    -------------------------------------------------
+HW_Scheduler_t *HW_Scheduler_t::Get(void)
+{
+    if (unlikely(singleton == nullptr)) singleton = new HW_Scheduler_t;
+    return singleton;
+}
+
+
+
+//
+// -- Add an oscillator; the order of registration breaks ties between edges due at the same time
+//    -------------------------------------------------------------------------------------------
+void HW_Scheduler_t::Register(HW_Oscillator_t *osc)
+{
+    if (!oscillators.contains(osc)) oscillators.append(osc);
+}
+
+
+
+//
+// -- Remove an oscillator
+//    --------------------
+void HW_Scheduler_t::Unregister(HW_Oscillator_t *osc)
+{
+    oscillators.removeAll(osc);
+}
+
+
+
+//
+// -- Start giving the scheduler slices of the event loop
+//    ---------------------------------------------------
+void HW_Scheduler_t::Start(void)
+{
+    if (running) return;
+
+    running = true;
+    paceBase = now;
+    wall.start();
+    window.invalidate();
+    slice->start(0);
+}
+
+
+
+//
+// -- Stop taking edges
+//    -----------------
+void HW_Scheduler_t::Stop(void)
+{
+    running = false;
+    achievedHz = 0;
+    slice->stop();
+}
+
+
+
+//
+// -- Take the next edge or delayed event right away, whether or not the scheduler is running
+//    ---------------------------------------------------------------------------------------
+bool HW_Scheduler_t::Step(void)
+{
+    HW_Oscillator_t *osc = Next();
+    Time_t edge = osc ? osc->GetNextEdge() : NEVER;
+    Time_t due = NextDue();
+    if (edge == NEVER && due == NEVER) return false;
+
+    if (due <= edge) {
+        FireNext();
+    } else {
+        now = edge;
+        Turn(now);
+        osc->ProcessTimerStateChange();
+    }
+
+    return true;
+}
+
+
+
+//
+// -- Pace simulated time so the high-speed crystal runs at `hz`; 0 runs as fast as possible
+//    --------------------------------------------------------------------------------------
+void HW_Scheduler_t::SetTargetFrequency(double hz)
+{
+    crystalRate = (hz <= 0) ? 0 : hz * 2 * HW_Oscillator_t::CRYSTAL_HALF_PERIOD / 1000000000.0;
+    if (cpuHz == 0) rate = crystalRate;
+
+    paceBase = now;
+    wall.start();
+}
+
+
+
+//
+// -- Pace the CPU clock to `hz`; until it has been measured, the crystal's pace is used.  0 turns it off
+//    ---------------------------------------------------------------------------------------------------
+void HW_Scheduler_t::SetTargetCpuFrequency(double hz)
+{
+    cpuHz = (hz > 0) ? hz : 0;
+    rate = crystalRate;
+
+    paceBase = now;
+    wall.start();
+    window.invalidate();
+}
+
+
+
+//
+// -- Change the rate, carrying the pace on from where the old rate had it so no time is gained or lost
+//    -------------------------------------------------------------------------------------------------
+void HW_Scheduler_t::SetRate(double r)
+{
+    if (r == rate) return;
+
+    paceBase = (rate > 0) ? paceBase + (Time_t)(wall.nsecsElapsed() * rate) : now;
+    wall.start();
+    rate = r;
+}
+
+
+
+//
+// -- Measure the CPU clock over the last window and, when pacing the CPU clock, set the rate to hold it
+//
+//    The simulated time a CPU cycle takes is measured rather than worked out, since it depends on which clock
+//    is selected and on the divider.  With no cycles in the window (the clock is stopped or single-stepped)
+//    there is nothing to measure, so the crystal's pace is used until there is.
+//    -------------------------------------------------------------------------------------------------------
+void HW_Scheduler_t::Govern(void)
+{
+    unsigned long cycles = Count();
+
+    // -- a fresh window after a start, or when a restore has taken the machine backwards
+    if (!window.isValid() || cycles < windowCycles || now < windowTime) {
+        windowCycles = cycles;
+        windowTime = now;
+        window.start();
+        return;
+    }
+
+    if (window.elapsed() < GOVERN_MS) return;
+
+    cycles -= windowCycles;
+    achievedHz = cycles * 1000000000.0 / window.nsecsElapsed();
+
+    if (cpuHz > 0) SetRate(cycles ? cpuHz * (now - windowTime) / cycles / 1000000000.0 : crystalRate);
+
+    windowCycles += cycles;
+    windowTime = now;
+    window.start();
+}
+
+
+
+//
+// -- Schedule `fn` to run `delay` simulated ns from now, unless `context` is deleted first
+//    -------------------------------------------------------------------------------------
+HW_Scheduler_t::EventId_t HW_Scheduler_t::Schedule(Time_t delay, QObject *context, std::function<void(void)> fn)
+{
+    Event_t ev;
+    ev.due = now + delay;
+    ev.id = ++ lastId;
+    ev.context = context;
+    ev.fn = fn;
+
+    Insert(ev);
+    pending ++;
+
+    // -- NEVER with events pending means the earliest is not known; leave it to be recalculated
+    if (pending == 1 || (nextDue != NEVER && ev.due < nextDue)) nextDue = ev.due;
+
+    return ev.id;
+}
+
+
+
+//
+// -- Cancel a delayed event which has not yet fired; an unknown id is quietly ignored
+//    --------------------------------------------------------------------------------
+void HW_Scheduler_t::Cancel(EventId_t id)
+{
+    auto match = [id](const Event_t &ev) { return ev.id == id; };
+
+    for (int i = 0; i < WHEEL_SLOTS; i ++) {
+        if (wheel[i].removeIf(match)) goto found;
+    }
+
+    if (overflow.removeIf(match)) goto found;
+    return;
+
+found:
+    pending --;
+    nextDue = NEVER;            // recalculated on the next look
+}
+
+
+
+//
+// -- Move simulated time to `to` when a snapshot is restored; the pending events go with the old state
+//    -------------------------------------------------------------------------------------------------
+void HW_Scheduler_t::Restore(Time_t to)
+{
+    for (int i = 0; i < WHEEL_SLOTS; i ++) wheel[i].clear();
+    overflow.clear();
+
+    pending = 0;
+    nextDue = NEVER;
+
+    now = to;
+    tick = to / TICK_NS;
+    paceBase = now;
+    wall.start();
+    window.invalidate();
+}
+
+
+
+//
+// -- Place an event in the slot for its tick, or in overflow if the wheel does not reach that far yet
+//    ------------------------------------------------------------------------------------------------
+void HW_Scheduler_t::Insert(const Event_t &ev)
+{
+    Time_t t = ev.due / TICK_NS;
+
+    if (t < tick + WHEEL_SLOTS) wheel[t % WHEEL_SLOTS].append(ev);
+    else overflow.append(ev);
+}
+
+
+
+//
+// -- Turn the wheel forward to time `to`; overflow events which now fit on the wheel move onto it
+//    --------------------------------------------------------------------------------------------
+void HW_Scheduler_t::Turn(Time_t to)
+{
+    Time_t t = to / TICK_NS;
+    if (t <= tick) return;
+
+    tick = t;
+
+    for (int i = overflow.size() - 1; i >= 0; i --) {
+        if (overflow[i].due / TICK_NS < tick + WHEEL_SLOTS) {
+            wheel[(overflow[i].due / TICK_NS) % WHEEL_SLOTS].append(overflow[i]);
+            overflow.removeAt(i);
+        }
+    }
+}
+
+
+
+//
+// -- Find when the earliest delayed event is due: the first non-empty slot from the current tick holds it
+//    ----------------------------------------------------------------------------------------------------
+HW_Scheduler_t::Time_t HW_Scheduler_t::NextDue(void)
+{
+    if (likely(pending == 0)) return NEVER;
+    if (nextDue != NEVER) return nextDue;
+
+    for (int i = 0; i < WHEEL_SLOTS && nextDue == NEVER; i ++) {
+        for (const Event_t &ev : wheel[(tick + i) % WHEEL_SLOTS]) {
+            if (ev.due < nextDue) nextDue = ev.due;
+        }
+    }
+
+    if (nextDue == NEVER) {
+        for (const Event_t &ev : overflow) {
+            if (ev.due < nextDue) nextDue = ev.due;
+        }
+    }
+
+    return nextDue;
+}
+
+
+
+//
+// -- Fire the earliest delayed event; events due together go in the order they were scheduled
+//    ----------------------------------------------------------------------------------------
+void HW_Scheduler_t::FireNext(void)
+{
+    Time_t due = NextDue();
+    if (due == NEVER) return;
+
+    // -- the wheel must reach the event before it can be found in its slot
+    Turn(due);
+
+    QList<Event_t> &slot = wheel[(due / TICK_NS) % WHEEL_SLOTS];
+    int idx = -1;
+
+    for (int i = 0; i < slot.size(); i ++) {
+        if (slot[i].due == due && (idx < 0 || slot[i].id < slot[idx].id)) idx = i;
+    }
+
+    Event_t ev = slot.takeAt(idx);
+    pending --;
+    nextDue = NEVER;
+
+    now = due;
+    if (ev.context) ev.fn();
+}
+
+
+
+//
+// -- Find the oscillator due next; ties go to the first registered
+//    -------------------------------------------------------------
+HW_Oscillator_t *HW_Scheduler_t::Next(void) const
+{
+    HW_Oscillator_t *rv = nullptr;
+
+    for (HW_Oscillator_t *osc : oscillators) {
+        if (!osc->IsRunning()) continue;
+        if (!rv || osc->GetNextEdge() < rv->GetNextEdge()) rv = osc;
+    }
+
+    return rv;
+}
+
+
+
+//
+// -- Run one slice of the event loop's time, then sleep until the next edge is due if it caught up
+//    ---------------------------------------------------------------------------------------------
+void HW_Scheduler_t::ProcessSlice(void)
+{
+    QElapsedTimer budget;
+    budget.start();
+    int sleep = 0;
+
+    while (running && budget.elapsed() < SLICE_MS) {
+        HW_Oscillator_t *osc = Next();
+        Time_t edge = osc ? osc->GetNextEdge() : NEVER;
+        Time_t due = NextDue();
+        if (edge == NEVER && due == NEVER) break;
+
+        Time_t target = NEVER;
+        if (rate > 0) {
+            target = paceBase + (Time_t)(wall.nsecsElapsed() * rate);
+
+            // -- caught up: the wall time until the next edge is due, in whole ms (anything less is polled)
+            Time_t next = qMin(edge, due);
+            if (next > target) {
+                sleep = (int)qMin((double)SLICE_MS, (next - target) / rate / 1000000.0);
+                break;
+            }
+        }
+
+        // -- a bounded batch of edges and delayed events between looks at the wall clock
+        for (int i = 0; running && i < CHECK_EDGES; i ++) {
+            osc = Next();
+            edge = osc ? osc->GetNextEdge() : NEVER;
+            due = NextDue();
+            if (edge == NEVER && due == NEVER) break;
+
+            if (due <= edge) {
+                if (due > target) break;
+                FireNext();
+            } else {
+                if (edge > target) break;
+
+                now = edge;
+                Turn(now);
+                osc->ProcessTimerStateChange();
+            }
+        }
+    }
+
+    // -- behind: the time is made up over the next slices, but a long stall is not chased
+    if (rate > 0) {
+        Time_t target = paceBase + (Time_t)(wall.nsecsElapsed() * rate);
+        Time_t limit = (Time_t)(MAX_CATCHUP_MS * 1000000.0 * rate);
+
+        if (target > now + limit) {
+            paceBase = now + limit;
+            wall.start();
+        }
+    }
+
+    Govern();
+
+    if (running && slice->interval() != sleep) slice->setInterval(sleep);
+}
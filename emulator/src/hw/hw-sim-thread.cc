@@ -0,0 +1,243 @@
+//===================================================================================================================
+//  hw-sim-thread.cc -- Runs the simulation on a thread of its own, away from the GUI
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/hw-sim-thread.moc.cc"
+
+
+
+//
+// -- Static class members
+//    --------------------
+HW_SimThread_t *HW_SimThread_t::singleton = nullptr;
+
+
+
+//
+// -- Construct the simulation thread, not yet running
+//    ------------------------------------------------
+HW_SimThread_t::HW_SimThread_t(void) : head(0), tail(0), wake(false), seq(0)
+{
+    thread = nullptr;
+    ring = new std::function<void(void)>[RING_SIZE];
+    memset(&state, 0, sizeof(state));
+
+    publish = new QTimer(this);
+    publish->setInterval(PUBLISH_MS);
+    connect(publish, &QTimer::timeout, this, &HW_SimThread_t::ProcessPublish);
+}
+
+
+
+//
+// -- Get the singleton instance, creating it as needed
+//    -------------------------------------------------
+HW_SimThread_t *HW_SimThread_t::Get(void)
+{
+    if (unlikely(singleton == nullptr)) singleton = new HW_SimThread_t;
+    return singleton;
+}
+
+
+
+//
+// -- Move the scheduler onto its own thread and start it; its slice timer goes with it
+//    ---------------------------------------------------------------------------------
+void HW_SimThread_t::Start(void)
+{
+    if (thread) return;
+
+    ProcessPublish();
+    publish->start();
+
+    thread = new QThread;
+    thread->setObjectName("simulation");
+
+    HW_Scheduler_t::Get()->moveToThread(thread);
+    moveToThread(thread);
+    thread->start();
+
+    // -- this now lives on the simulation thread, but it must be stopped from the GUI thread as the app quits
+    connect(qApp, &QCoreApplication::aboutToQuit, this, &HW_SimThread_t::Stop, CNN_TYPE);
+}
+
+
+
+//
+// -- Stop the simulation and bring it back to the GUI thread, so anything tidied up after it is safe
+//    -----------------------------------------------------------------------------------------------
+void HW_SimThread_t::Stop(void)
+{
+    if (!thread) return;
+
+    QThread *gui = qApp->thread();
+
+    Call([this, gui](void) {
+        // -- a trace is drained and closed first, while the simulation is still here to stop feeding it
+        HW_Trace_t *trace = HW_Trace_t::Get();
+        trace->Stop();
+
+        HW_Scheduler_t::Get()->Stop();
+        publish->stop();
+
+        // -- the trace was created by a command, so it may live here too
+        if (trace->thread() == QThread::currentThread()) trace->moveToThread(gui);
+        HW_Scheduler_t::Get()->moveToThread(gui);
+        moveToThread(gui);
+    });
+
+    thread->quit();
+    thread->wait();
+    delete thread;
+    thread = nullptr;
+}
+
+
+
+//
+// -- Post a command for the simulation thread, waking it if it has not already been woken
+//    ------------------------------------------------------------------------------------
+void HW_SimThread_t::Post(std::function<void(void)> fn)
+{
+    if (!thread || QThread::currentThread() == thread) {
+        fn();
+        return;
+    }
+
+    uint64_t h = head.load(std::memory_order_relaxed);
+
+    while (unlikely(h - tail.load(std::memory_order_acquire) >= RING_SIZE)) QThread::yieldCurrentThread();
+
+    ring[h & (RING_SIZE - 1)] = std::move(fn);
+    head.store(h + 1, std::memory_order_release);
+
+    // -- one wake-up covers everything posted until the simulation starts draining
+    if (!wake.exchange(true, std::memory_order_acq_rel)) {
+        QMetaObject::invokeMethod(this, &HW_SimThread_t::ProcessCommands, Qt::QueuedConnection);
+    }
+}
+
+
+
+//
+// -- Run a command on the simulation thread and wait for it
+//    ------------------------------------------------------
+void HW_SimThread_t::Call(std::function<void(void)> fn)
+{
+    if (!thread || QThread::currentThread() == thread) {
+        fn();
+        return;
+    }
+
+    QSemaphore done;
+    Post([&fn, &done](void) { fn(); done.release(); });
+    done.acquire();
+}
+
+
+
+//
+// -- Run `fn` on the GUI thread; from the simulation thread it waits in the GUI's event loop
+//    ---------------------------------------------------------------------------------------
+void HW_SimThread_t::PostGui(QObject *widget, std::function<void(void)> fn)
+{
+    if (!thread || QThread::currentThread() != thread) fn();
+    else QMetaObject::invokeMethod(widget, fn, Qt::QueuedConnection);
+}
+
+
+
+//
+// -- Drain the ring; anything posted once `wake` is cleared will ask for another drain
+//    ---------------------------------------------------------------------------------
+void HW_SimThread_t::ProcessCommands(void)
+{
+    wake.exchange(false, std::memory_order_acq_rel);
+
+    uint64_t t = tail.load(std::memory_order_relaxed);
+    uint64_t h = head.load(std::memory_order_acquire);
+
+    for ( ; t != h; t ++) {
+        std::function<void(void)> fn = std::move(ring[t & (RING_SIZE - 1)]);
+        ring[t & (RING_SIZE - 1)] = nullptr;
+        tail.store(t + 1, std::memory_order_release);
+
+        fn();
+    }
+
+    ProcessPublish();
+}
+
+
+
+//
+// -- Add a bus to the published state
+//    --------------------------------
+int HW_SimThread_t::Watch(HW_Bus_16_t *bus)
+{
+    int idx = buses.indexOf(bus);
+    if (idx >= 0) return idx;
+    if (buses.size() >= BUS_CNT) return -1;
+
+    buses.append(bus);
+    return buses.size() - 1;
+}
+
+
+
+//
+// -- Publish the machine state for the GUI
+//    -------------------------------------
+void HW_SimThread_t::ProcessPublish(void)
+{
+    uint32_t s = seq.load(std::memory_order_relaxed);
+
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    state.cycles = Count();
+    state.time = HW_Scheduler_t::Get()->GetTime();
+    state.achievedHz = HW_Scheduler_t::Get()->GetAchievedFrequency();
+    state.targetHz = HW_Scheduler_t::Get()->GetTargetCpuFrequency();
+
+    for (int i = 0; i < buses.size(); i ++) {
+        state.value[i] = buses[i]->GetValue();
+        state.zMask[i] = buses[i]->GetZMask();
+    }
+
+    seq.store(s + 2, std::memory_order_release);
+}
+
+
+
+//
+// -- Read the state last published, trying again if it was being written at the time
+//    --------------------------------------------------------------------------------
+HW_SimThread_t::State_t HW_SimThread_t::Read(void) const
+{
+    State_t rv;
+
+    while (true) {
+        uint32_t before = seq.load(std::memory_order_acquire);
+
+        if (!(before & 1)) {
+            memcpy(&rv, &state, sizeof(rv));
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (seq.load(std::memory_order_relaxed) == before) return rv;
+        }
+
+        QThread::yieldCurrentThread();
+    }
+}
+
+
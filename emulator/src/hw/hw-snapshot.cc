@@ -0,0 +1,288 @@
+//===================================================================================================================
+//  hw-snapshot.cc -- Save and restore the state of the whole machine
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/hw-snapshot.moc.cc"
+
+
+
+//
+// -- Static class members
+//    --------------------
+HW_Snapshot_t *HW_Snapshot_t::singleton = nullptr;
+
+
+
+//
+// -- the fixed part of the header
+//    ----------------------------
+static const char magic[4] = { '1', '6', 'B', 'S' };
+
+typedef struct Header_t {
+    char magic[4];
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t count;
+    HW_Scheduler_t::Time_t time;
+} __attribute__((packed)) Header_t;
+
+
+
+//
+// -- Save or restore `len` bytes at `data`
+//    -------------------------------------
+void HW_Snapshot_t::Stream_t::Raw(void *data, qsizetype len)
+{
+    if (checking) {
+        if (!ok || pos + len > end) ok = false;
+        else pos += len;
+        return;
+    }
+
+    Copy(data, len);
+}
+
+
+
+//
+// -- Save or restore `len` bytes at `data`, even when only checking
+//    --------------------------------------------------------------
+void HW_Snapshot_t::Stream_t::Copy(void *data, qsizetype len)
+{
+    if (!restoring) {
+        buf->append((const char *)data, len);
+        return;
+    }
+
+    if (!ok || pos + len > end) {
+        ok = false;
+        return;
+    }
+
+    memcpy(data, buf->constData() + pos, len);
+    pos += len;
+}
+
+
+
+//
+// -- Get the singleton instance, creating it as needed
+//    -------------------------------------------------
+HW_Snapshot_t *HW_Snapshot_t::Get(void)
+{
+    if (unlikely(singleton == nullptr)) singleton = new HW_Snapshot_t;
+    return singleton;
+}
+
+
+
+//
+// -- Add a component; it is dropped again when it is deleted
+//    -------------------------------------------------------
+void HW_Snapshot_t::Add(QObject *obj, std::function<void(Stream_t &)> fn)
+{
+    entries.append({obj, fn});
+
+    connect(obj, &QObject::destroyed, this, [this, obj](void) {
+        entries.removeIf([obj](const Entry_t &e) { return e.obj == obj; });
+    });
+}
+
+
+
+//
+// -- The components, in the order they registered
+//    --------------------------------------------
+QList<QObject *> HW_Snapshot_t::GetComponents(void) const
+{
+    QList<QObject *> rv;
+    for (const Entry_t &e : entries) rv.append(e.obj);
+    return rv;
+}
+
+
+
+//
+// -- The place of a component in the registration order, or -1 when it is not registered
+//    -----------------------------------------------------------------------------------
+int HW_Snapshot_t::IndexOf(const QObject *obj) const
+{
+    for (int i = 0; i < entries.size(); i ++) {
+        if (entries[i].obj == obj) return i;
+    }
+
+    return -1;
+}
+
+
+
+//
+// -- Take a snapshot of the whole machine
+//    ------------------------------------
+QByteArray HW_Snapshot_t::Capture(void)
+{
+    QByteArray rv;
+    Stream_t s(&rv, false);
+
+    Header_t hdr;
+    memcpy(hdr.magic, magic, sizeof(magic));
+    hdr.version = VERSION;
+    hdr.reserved = 0;
+    hdr.count = entries.size();
+    hdr.time = HW_Scheduler_t::Get()->GetTime();
+    s & hdr;
+
+    for (const Entry_t &e : entries) {
+        QByteArray name(e.obj->metaObject()->className());
+        uint16_t nameLen = name.size();
+        s & nameLen;
+        s.Raw(name.data(), nameLen);
+
+        // -- the length is filled in once the state is known
+        qsizetype at = rv.size();
+        uint32_t len = 0;
+        s & len;
+
+        e.fn(s);
+
+        len = rv.size() - at - sizeof(len);
+        memcpy(rv.data() + at, &len, sizeof(len));
+    }
+
+    return rv;
+}
+
+
+
+//
+// -- Restore a snapshot; nothing is changed unless the whole snapshot fits this machine
+//
+//    The snapshot is walked twice: first only checking that every component finds its own state there, which
+//    touches nothing (not even the pending events), and only then restoring it.
+//    -------------------------------------------------------------------------------------------------------
+bool HW_Snapshot_t::Apply(const QByteArray &snap)
+{
+    if (!Load(snap, true)) return false;
+
+    if (!Load(snap, false)) {
+        qDebug().noquote() << "Snapshot failed to restore after it was checked; the machine state is not reliable";
+        return false;
+    }
+
+    emit SignalRestored();
+    return true;
+}
+
+
+
+//
+// -- Walk a snapshot restoring each component in turn, or only checking that each would restore
+//    ------------------------------------------------------------------------------------------
+bool HW_Snapshot_t::Load(const QByteArray &snap, bool check)
+{
+    QByteArray data(snap);
+    Stream_t s(&data, true, check);
+
+    Header_t hdr;
+    s.Copy(&hdr, sizeof(hdr));
+
+    if (!s.ok || memcmp(hdr.magic, magic, sizeof(magic)) != 0) {
+        qDebug().noquote() << "Not a machine snapshot";
+        return false;
+    }
+
+    if (hdr.version != VERSION) {
+        qDebug().noquote() << "Snapshot version" << hdr.version << "is not supported; expected" << VERSION;
+        return false;
+    }
+
+    if (hdr.count != (uint32_t)entries.size()) {
+        qDebug().noquote() << "Snapshot has" << hdr.count << "components; this machine has" << entries.size();
+        return false;
+    }
+
+    // -- any delayed events belong to the current state; the components will schedule their own again
+    if (!check) HW_Scheduler_t::Get()->Restore(hdr.time);
+
+    for (int i = 0; i < entries.size(); i ++) {
+        const Entry_t &e = entries[i];
+        uint16_t nameLen = 0;
+        uint32_t len = 0;
+
+        s.Copy(&nameLen, sizeof(nameLen));
+        QByteArray name(nameLen, '\0');
+        s.Copy(name.data(), nameLen);
+        s.Copy(&len, sizeof(len));
+
+        if (!s.ok || s.pos + len > s.end) {
+            qDebug().noquote() << "Snapshot is truncated at component" << i;
+            return false;
+        }
+
+        if (name != e.obj->metaObject()->className()) {
+            qDebug().noquote() << "Snapshot component" << i << "is" << name << "but this machine has"
+                    << e.obj->metaObject()->className();
+            return false;
+        }
+
+        // -- the component must consume exactly its own state
+        qsizetype end = s.pos + len;
+        s.end = end;
+        e.fn(s);
+
+        if (!s.ok || s.pos != end) {
+            qDebug().noquote() << "Snapshot state for component" << i << "(" << name << ") does not fit";
+            return false;
+        }
+
+        s.end = data.size();
+    }
+
+    return true;
+}
+
+
+
+//
+// -- Save a snapshot to a file
+//    -------------------------
+bool HW_Snapshot_t::Save(const QString &file)
+{
+    QFile f(file);
+
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qDebug().noquote() << "Unable to write snapshot" << file;
+        return false;
+    }
+
+    QByteArray snap = Capture();
+    return f.write(snap) == snap.size();
+}
+
+
+
+//
+// -- Restore a snapshot from a file
+//    ------------------------------
+bool HW_Snapshot_t::Restore(const QString &file)
+{
+    QFile f(file);
+
+    if (!f.open(QIODevice::ReadOnly)) {
+        qDebug().noquote() << "Unable to read snapshot" << file;
+        return false;
+    }
+
+    return Apply(f.readAll());
+}
+
+
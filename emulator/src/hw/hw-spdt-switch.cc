@@ -22,6 +22,8 @@ HW_SpdtSwitch_t::HW_SpdtSwitch_t(QString name, HighWhen_t w, QWidget *parent)
 {
     connect(this, &QPushButton::pressed, this, &HW_SpdtSwitch_t::ProcessPressed);
     connect(this, &QPushButton::released, this, &HW_SpdtSwitch_t::ProcessReleased);
+
+    HW_History_t::Get()->RegisterInput(this);
 }
 
 
@@ -0,0 +1,309 @@
+//===================================================================================================================
+//  hw-trace.cc -- Record the buses and control signals to a VCD waveform file
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/hw-trace.moc.cc"
+
+
+
+//
+// -- Static class members
+//    --------------------
+HW_Trace_t *HW_Trace_t::singleton = nullptr;
+
+
+
+//
+// -- Construct the tracer, not yet tracing
+//    -------------------------------------
+HW_Trace_t::HW_Trace_t(void) : head(0), tail(0), stopping(false)
+{
+    ring = new Change_t[RING_SIZE];
+    file = nullptr;
+    writer = nullptr;
+    tracing = false;
+    stalls = 0;
+}
+
+
+
+//
+// -- Get the singleton instance, creating it as needed
+//    -------------------------------------------------
+HW_Trace_t *HW_Trace_t::Get(void)
+{
+    if (unlikely(singleton == nullptr)) singleton = new HW_Trace_t;
+    return singleton;
+}
+
+
+
+//
+// -- Add a traced var, giving it the next VCD identifier (printable characters `!` through `~`, base 94)
+//    ---------------------------------------------------------------------------------------------------
+int HW_Trace_t::AddVar(const QString &scope, const QString &name, int width)
+{
+    int id = vars.size();
+    QByteArray code;
+
+    for (int n = id; ; n = n / 94 - 1) {
+        code.prepend((char)('!' + n % 94));
+        if (n < 94) break;
+    }
+
+    vars.append({scope, name, width, code, 0, ~0ull});
+    return id;
+}
+
+
+
+//
+// -- Trace a 16-bit bus; the bus records its own changes
+//    ---------------------------------------------------
+void HW_Trace_t::TraceBus(const QString &name, HW_Bus_16_t *bus)
+{
+    if (!bus) return;
+
+    int var = AddVar("buses", name, 16);
+    bus->SetTraceVar(var);
+    buses.append(bus);
+
+    Record(var, bus->GetValue(), bus->GetZMask());
+}
+
+
+
+//
+// -- Record one bit of a var put together from separate signals
+//    ----------------------------------------------------------
+void HW_Trace_t::RecordBit(int var, int bit, TriState_t state)
+{
+    Var_t &v = vars[var];
+    uint64_t b = (1ull << bit);
+
+    if (state == Z) v.zMask |= b;
+    else v.zMask &= ~b;
+
+    if (state == HIGH) v.value |= b;
+    else v.value &= ~b;
+
+    Record(var, v.value, v.zMask);
+}
+
+
+
+//
+// -- Start tracing to `fileName`
+//    ---------------------------
+bool HW_Trace_t::Start(const QString &fileName)
+{
+    if (tracing) return false;
+
+    file = new QFile(fileName);
+    if (!file->open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qDebug().noquote() << "Unable to write trace" << fileName;
+        delete file;
+        file = nullptr;
+        return false;
+    }
+
+    vars.clear();
+    head.store(0);
+    tail.store(0);
+    stopping.store(false);
+    stalls = 0;
+
+
+    //
+    // -- the buses
+    //    ---------
+    TraceBus("main", HW_Computer_t::GetMainBus());
+    TraceBus("addr1", HW_Computer_t::GetAddr1Bus());
+    TraceBus("addr2", HW_Computer_t::GetAddr2Bus());
+    TraceBus("alu_a", HW_Computer_t::GetAluABus());
+    TraceBus("alu_b", HW_Computer_t::GetAluBBus());
+    TraceBus("instr", HW_Computer_t::GetInstrBus());
+    TraceBus("fetch", HW_Computer_t::GetFetchBus());
+    TraceBus("ctrl_lookup", ControlLogic_MidPlane_t::GetCtrlBus());
+
+
+    //
+    // -- the control word, as the outputs of each control ROM
+    //    ----------------------------------------------------
+    for (int r = 0; r < ControlLogic_MidPlane_t::CTRL_ROM_CNT; r ++) {
+        CtrlRomModule_t *rom = ControlLogic_MidPlane_t::GetCtrlRom(r);
+        int var = AddVar("control", "ctrl" + QString::number(r, 16), 8);
+        auto bit = [this, var](int b) { return [this, var, b](TriState_t s) { RecordBit(var, b, s); }; };
+
+        probes.append(connect(rom, &CtrlRomModule_t::SignalBit0Updated, this, bit(0), Qt::DirectConnection));
+        probes.append(connect(rom, &CtrlRomModule_t::SignalBit1Updated, this, bit(1), Qt::DirectConnection));
+        probes.append(connect(rom, &CtrlRomModule_t::SignalBit2Updated, this, bit(2), Qt::DirectConnection));
+        probes.append(connect(rom, &CtrlRomModule_t::SignalBit3Updated, this, bit(3), Qt::DirectConnection));
+        probes.append(connect(rom, &CtrlRomModule_t::SignalBit4Updated, this, bit(4), Qt::DirectConnection));
+        probes.append(connect(rom, &CtrlRomModule_t::SignalBit5Updated, this, bit(5), Qt::DirectConnection));
+        probes.append(connect(rom, &CtrlRomModule_t::SignalBit6Updated, this, bit(6), Qt::DirectConnection));
+        probes.append(connect(rom, &CtrlRomModule_t::SignalBit7Updated, this, bit(7), Qt::DirectConnection));
+    }
+
+
+    //
+    // -- the clock phases
+    //    ----------------
+    ClockModule_t *clock = HW_Computer_t::GetClock();
+    int hs = AddVar("clock", "high_speed", 1);
+    int cpu = AddVar("clock", "cpu", 1);
+
+    probes.append(connect(clock, &ClockModule_t::SignalHighSpeedClockOutput, this,
+            [this, hs](TriState_t s) { RecordBit(hs, 0, s); }, Qt::DirectConnection));
+    probes.append(connect(clock, &ClockModule_t::SignalCpuClockOutput, this,
+            [this, cpu](TriState_t s) { RecordBit(cpu, 0, s); }, Qt::DirectConnection));
+
+
+    // -- everything is known, so the writer can start with the header; it gets a copy of its own to read
+    layout = vars;
+    layout.detach();
+
+    tracing = true;
+    writer = QThread::create([this]() { Drain(); });
+    writer->start();
+
+    // -- direct, since this may live on the simulation thread, which will be gone before a queued call runs
+    connect(qApp, &QCoreApplication::aboutToQuit, this, &HW_Trace_t::Stop, CNN_TYPE);
+
+    return true;
+}
+
+
+
+//
+// -- Stop tracing, waiting for the writer to empty the ring and close the file
+//    -------------------------------------------------------------------------
+void HW_Trace_t::Stop(void)
+{
+    if (!tracing) return;
+
+    for (const QMetaObject::Connection &c : probes) disconnect(c);
+    probes.clear();
+
+    for (HW_Bus_16_t *bus : buses) bus->SetTraceVar(-1);
+    buses.clear();
+
+    stopping.store(true, std::memory_order_release);
+    writer->wait();
+    delete writer;
+    writer = nullptr;
+
+    file->close();
+    delete file;
+    file = nullptr;
+
+    tracing = false;
+
+    if (stalls) qDebug().noquote() << "Trace: the simulation waited on the writer" << stalls << "times";
+}
+
+
+
+//
+// -- Format one change as VCD
+//    ------------------------
+void HW_Trace_t::Format(const Change_t &ch, QByteArray &out)
+{
+    const Var_t &v = layout[ch.var];
+
+    if (v.width == 1) {
+        out.append((ch.zMask & 1) ? ((ch.value & 1) ? 'x' : 'z') : ((ch.value & 1) ? '1' : '0'));
+    } else {
+        out.append('b');
+        for (int i = v.width - 1; i >= 0; i --) {
+            uint64_t b = (1ull << i);
+            out.append((ch.zMask & b) ? ((ch.value & b) ? 'x' : 'z') : ((ch.value & b) ? '1' : '0'));
+        }
+        out.append(' ');
+    }
+
+    out.append(v.code);
+    out.append('\n');
+}
+
+
+
+//
+// -- The writer thread: write the header, then drain the ring until told to stop
+//    ---------------------------------------------------------------------------
+void HW_Trace_t::Drain(void)
+{
+    QByteArray out;
+
+    out.append("$date " + QDateTime::currentDateTime().toString(Qt::ISODate).toLatin1() + " $end\n");
+    out.append("$version 16bcfs emulator $end\n");
+    out.append("$timescale 1ns $end\n");
+
+    QString scope;
+    for (const Var_t &v : std::as_const(layout)) {
+        if (v.scope != scope) {
+            if (!scope.isEmpty()) out.append("$upscope $end\n");
+            scope = v.scope;
+            out.append("$scope module " + scope.toLatin1() + " $end\n");
+        }
+
+        out.append("$var wire " + QByteArray::number(v.width) + " " + v.code + " " + v.name.toLatin1() + " $end\n");
+    }
+
+    if (!scope.isEmpty()) out.append("$upscope $end\n");
+    out.append("$enddefinitions $end\n");
+
+    HW_Scheduler_t::Time_t last = 0;
+    bool first = true;
+    uint64_t t = tail.load(std::memory_order_relaxed);
+
+    while (true) {
+        // -- look at `stopping` first: anything recorded before it was set is then sure to be seen
+        bool stop = stopping.load(std::memory_order_acquire);
+        uint64_t h = head.load(std::memory_order_acquire);
+
+        if (t == h) {
+            if (stop) break;
+
+            file->write(out);
+            out.clear();
+            QThread::usleep(500);
+            continue;
+        }
+
+        for ( ; t != h; t ++) {
+            const Change_t &ch = ring[t & (RING_SIZE - 1)];
+
+            // -- time only goes backwards when a snapshot is restored; VCD cannot, so it holds still instead
+            HW_Scheduler_t::Time_t at = first ? ch.time : qMax(last, ch.time);
+
+            if (first || at != last) {
+                out.append("#" + QByteArray::number(at) + "\n");
+                last = at;
+                first = false;
+            }
+
+            Format(ch, out);
+        }
+
+        tail.store(t, std::memory_order_release);
+
+        if (out.size() > 65536) {
+            file->write(out);
+            out.clear();
+        }
+    }
+
+    file->write(out);
+}
+
+
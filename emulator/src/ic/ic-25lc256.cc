@@ -20,7 +20,7 @@
 
 
 //
-// -- construct an EEPROM, loading its contents from disk
+// -- construct an EEPROM, mapping its contents from disk
 //    ---------------------------------------------------
 IC_25lc256_t::IC_25lc256_t(const QString &file)
 {
@@ -33,19 +33,9 @@ IC_25lc256_t::IC_25lc256_t(const QString &file)
 
     TriggerFirstUpdate();
 
-    QSettings *settings = HW_Computer_t::GetSettings();
-    QString folder = settings->value(key).toString();
-    QString fn = folder + "/" + file;
-    FILE *fp = fopen(fn.toStdString().c_str(), "r");
+    image = HW_RomImage_t::Get(HW_Computer_t::GetCtrlRomFolder() + "/" + file);
 
-    if (!fp) {
-        qDebug() << "Unable to open file" << fn;
-        memset(contents, 0, sizeof(contents));
-        return;
-    }
-
-    fread(contents, 1, sizeof(contents), fp);
-    fclose(fp);
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -55,6 +45,8 @@ IC_25lc256_t::IC_25lc256_t(const QString &file)
 //    -----------------------------
 void IC_25lc256_t::ProcessUpdateCs(TriState_t state)
 {
+    PROFILE_INPUT(pins[CSb], state);
+
     pins[CSb] = state;
 
     // -- it really doesn't matter what it changes to; reset no matter what
@@ -73,6 +65,8 @@ void IC_25lc256_t::ProcessUpdateCs(TriState_t state)
 //    ------------------------------------------------------------------
 void IC_25lc256_t::ProcessUpdateSck(TriState_t state)
 {
+    PROFILE_INPUT(pins[SCK], state);
+
     pins[SCK] = state;
 
     if (pins[CSb] != LOW) return;               // if not active, do nothing
@@ -276,7 +270,7 @@ void IC_25lc256_t::ProcessUpdateSck(TriState_t state)
 
     case ADDRESS_LSB | BIT7 | CLK_LO:
         mode = READING;
-        byte = contents[addr];
+        byte = image->Data()[addr];
 
         pins[SO] = (byte & (1<<7) ? HIGH : LOW);
         emit SignalSoUpdated(pins[SO]);
@@ -361,7 +355,7 @@ void IC_25lc256_t::ProcessUpdateSck(TriState_t state)
     case READING | BIT7 | CLK_LO:
         addr ++;
         addr &= 0x7fff;         // make sure it wraps properly
-        byte = contents[addr];
+        byte = image->Data()[addr];
 
         pins[SO] = (byte & (1<<7) ? HIGH : LOW);
         emit SignalSoUpdated(pins[SO]);
@@ -32,6 +32,8 @@ IC_74xx04_t::IC_74xx04_t(void)
     pins[A5] = LOW;
     pins[Y6] = HIGH;
     pins[A6] = LOW;
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
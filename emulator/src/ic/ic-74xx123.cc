@@ -7,6 +7,7 @@
 //      Date     Tracker  Version  Description
 //  -----------  -------  -------  ---------------------------------------------------------------------------------
 //  2023-Nov-03  Initial  v0.0.1   Initial Version
+//  2026-Oct-17  Initial  v0.0.2   Time the output pulse in simulated time from the RC values
 //===================================================================================================================
 
 
@@ -15,10 +16,13 @@
 
 
 //
-// -- This is the contructor for the UP/DOWN cnter, having 16 pins
-//    --------------------------------------------------------------
-IC_74xx123_t::IC_74xx123_t(void)
+// -- This is the contructor for the multivibrator, having 16 pins; `rext` is in ohms and `cext` in pF
+//    ------------------------------------------------------------------------------------------------
+IC_74xx123_t::IC_74xx123_t(int rext, int cext)
 {
+    // -- K is about 0.45 for the 74HC123 with Cext over 10nF; ohms * pF is in ps
+    width = (HW_Scheduler_t::Time_t)rext * cext * 45 / 100 / 1000;
+
     pins[A1b] = LOW;
     pins[B1] = HIGH;
     pins[RD1b] = HIGH;
@@ -44,11 +48,15 @@ IC_74xx123_t::IC_74xx123_t(void)
 
     cycling1 = false;
     cycling2 = false;
+    end1 = 0;
+    end2 = 0;
 
 //    connect(this, &IC_74xx123_t::SignalQ1Updated, this, &IC_74xx123_t::DebugQ1);
 //    connect(this, &IC_74xx123_t::SignalQ1bUpdated, this, &IC_74xx123_t::DebugQ1b);
 //    connect(this, &IC_74xx123_t::SignalQ2Updated, this, &IC_74xx123_t::DebugQ2);
 //    connect(this, &IC_74xx123_t::SignalQ2bUpdated, this, &IC_74xx123_t::DebugQ2b);
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -78,7 +86,8 @@ void IC_74xx123_t::ProcessUpdates1Complete(void)
                 emit SignalQ1bUpdated(LOW);
 
                 cycling1 = true;
-                QTimer::singleShot(50, this, &IC_74xx123_t::ProcessUpdateRCEXT1);
+                end1 = HW_Scheduler_t::Get()->GetTime() + width;
+                HW_Scheduler_t::Get()->Schedule(width, this, [this]() { ProcessUpdateRCEXT1(); });
             }
         }
     }
@@ -115,7 +124,8 @@ void IC_74xx123_t::ProcessUpdates2Complete(void)
                 emit SignalQ2bUpdated(LOW);
 
                 cycling2 = true;
-                QTimer::singleShot(50, this, &IC_74xx123_t::ProcessUpdateRCEXT2);
+                end2 = HW_Scheduler_t::Get()->GetTime() + width;
+                HW_Scheduler_t::Get()->Schedule(width, this, [this]() { ProcessUpdateRCEXT2(); });
             }
         }
     }
@@ -128,6 +138,24 @@ exit:
 
 
 
+//
+// -- Save or restore the state; a pulse in progress is scheduled again to end when it would have
+//    -------------------------------------------------------------------------------------------
+void IC_74xx123_t::Snapshot(HW_Snapshot_t::Stream_t &s)
+{
+    s & pins & a1 & b1 & rd1 & a2 & b2 & rd2 & cycling1 & cycling2 & end1 & end2;
+
+    if (!s.IsRestoring()) return;
+
+    HW_Scheduler_t *sched = HW_Scheduler_t::Get();
+    HW_Scheduler_t::Time_t now = sched->GetTime();
+
+    if (cycling1) sched->Schedule(end1 > now ? end1 - now : 0, this, [this]() { ProcessUpdateRCEXT1(); });
+    if (cycling2) sched->Schedule(end2 > now ? end2 - now : 0, this, [this]() { ProcessUpdateRCEXT2(); });
+}
+
+
+
 //
 // -- A timeout has occurred, perform the updates
 //    -------------------------------------------
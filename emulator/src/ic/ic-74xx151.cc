@@ -33,6 +33,8 @@ IC_74xx151_t::IC_74xx151_t(void)
     pins[STb] = HIGH;
     pins[Y] = LOW;
     pins[W] = HIGH;
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -37,6 +37,8 @@ IC_74xx157_t::IC_74xx157_t(void)
     pins[Gb] = HIGH;
 
     TriggerFirstUpdate();
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -35,6 +35,8 @@ IC_74xx164_t::IC_74xx164_t(void)
     pins[QH] = LOW;
 
     TriggerFirstUpdate();
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -61,6 +63,8 @@ void IC_74xx164_t::TriggerFirstUpdate(void)
 //    --------------------------
 void IC_74xx164_t::ProcessUpdateClr(TriState_t state)
 {
+    PROFILE_INPUT(pins[CLRb], state);
+
     pins[CLRb] = state;
 
     if (state == HIGH) return;
@@ -114,6 +118,8 @@ void IC_74xx164_t::ProcessUpdateClr(TriState_t state)
 //    -------------------------------
 void IC_74xx164_t::ProcessUpdateClk(TriState_t state)
 {
+    PROFILE_INPUT(pins[CLK], state);
+
     if (pins[CLK] == state) return;
 
     pins[CLK] = state;
@@ -40,6 +40,8 @@ IC_74xx165_t::IC_74xx165_t(void)
     clockState = HIGH;
 
     TriggerFirstUpdate();
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -38,6 +38,8 @@ IC_74xx193_t::IC_74xx193_t()
     lastDown = pins[DOWN];
 
     cnt = 0;
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -46,14 +48,6 @@ IC_74xx193_t::IC_74xx193_t()
 //    ------------------
 void IC_74xx193_t::ProcessUpdatesComplete(void)
 {
-    TriState_t newQa;
-    TriState_t newQb;
-    TriState_t newQc;
-    TriState_t newQd;
-    TriState_t newCOb;
-    TriState_t newBOb;
-
-
     if (pins[UP] == LOW && pins[DOWN] == LOW) {
         qDebug("Invalid state on 74xx193: Both UP and DOWN are LOW at the same time");
     }
@@ -109,6 +103,34 @@ void IC_74xx193_t::ProcessUpdatesComplete(void)
 
 
     cnt &= 0xf;
+    UpdateOutputs();
+
+    lastUp = pins[UP];
+    lastDown = pins[DOWN];
+}
+
+
+//
+// -- set the count directly, as though it had been clocked there (the fast boot uses this)
+//    -------------------------------------------------------------------------------------
+void IC_74xx193_t::PresetCount(int count)
+{
+    cnt = count & 0xf;
+    UpdateOutputs();
+}
+
+
+//
+// -- drive the outputs from the current count, emitting only what changes
+//    --------------------------------------------------------------------
+void IC_74xx193_t::UpdateOutputs(void)
+{
+    TriState_t newQa;
+    TriState_t newQb;
+    TriState_t newQc;
+    TriState_t newQd;
+    TriState_t newCOb;
+    TriState_t newBOb;
 
 
     if (cnt == 15) {
@@ -154,10 +176,6 @@ void IC_74xx193_t::ProcessUpdatesComplete(void)
         pins[COb] = newCOb;
         emit SignalCoUpdated(newCOb);
     }
-
-
-    lastUp = pins[UP];
-    lastDown = pins[DOWN];
 }
 
 
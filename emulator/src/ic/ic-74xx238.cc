@@ -17,7 +17,7 @@
 //
 // -- This is the contructor for the UP/DOWN cnter, having 16 pins
 //    --------------------------------------------------------------
-IC_74xx238_t::IC_74xx238_t(void)
+IC_74xx238_t::IC_74xx238_t(void) : HW_Netlist_t::Component_t(pins, PIN_CNT(16))
 {
     pins[A] = LOW;
     pins[B] = LOW;
@@ -33,6 +33,8 @@ IC_74xx238_t::IC_74xx238_t(void)
     pins[Y2] = LOW;
     pins[Y1] = LOW;
     pins[Y0] = LOW;
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -40,6 +42,27 @@ IC_74xx238_t::IC_74xx238_t(void)
 // -- Update the XOR Gates, being careful not to push any changes for performance reasons
 //    -----------------------------------------------------------------------------------
 void IC_74xx238_t::ProcessUpdatesComplete(void)
+{
+    Compute();
+
+    emit SignalY0Updated(pins[Y0]);
+    emit SignalY1Updated(pins[Y1]);
+    emit SignalY2Updated(pins[Y2]);
+    emit SignalY3Updated(pins[Y3]);
+    emit SignalY4Updated(pins[Y4]);
+    emit SignalY5Updated(pins[Y5]);
+    emit SignalY6Updated(pins[Y6]);
+    emit SignalY7Updated(pins[Y7]);
+
+    DriveOutputs();
+}
+
+
+
+//
+// -- The truth table: the selected output is driven HIGH while the chip is enabled
+//    ----------------------------------------------------------------------------
+void IC_74xx238_t::Compute(void)
 {
     pins[Y0] = LOW;
     pins[Y1] = LOW;
@@ -87,15 +110,28 @@ void IC_74xx238_t::ProcessUpdatesComplete(void)
             break;
         }
     }
+}
 
-    emit SignalY0Updated(pins[Y0]);
-    emit SignalY1Updated(pins[Y1]);
-    emit SignalY2Updated(pins[Y2]);
-    emit SignalY3Updated(pins[Y3]);
-    emit SignalY4Updated(pins[Y4]);
-    emit SignalY5Updated(pins[Y5]);
-    emit SignalY6Updated(pins[Y6]);
-    emit SignalY7Updated(pins[Y7]);
+
+
+//
+// -- The bit-sliced version of the same truth table, 64 lanes at a time
+//    ------------------------------------------------------------------
+void IC_74xx238_t::EvaluateLanes(void)
+{
+    uint64_t a = InputLanes(A);
+    uint64_t b = InputLanes(B);
+    uint64_t c = InputLanes(C);
+    uint64_t en = InputLanes(G1) & ~InputLanes(G2Ab) & ~InputLanes(G2Bb);
+
+    SetOutputLanes(Y0, en & ~c & ~b & ~a);
+    SetOutputLanes(Y1, en & ~c & ~b &  a);
+    SetOutputLanes(Y2, en & ~c &  b & ~a);
+    SetOutputLanes(Y3, en & ~c &  b &  a);
+    SetOutputLanes(Y4, en &  c & ~b & ~a);
+    SetOutputLanes(Y5, en &  c & ~b &  a);
+    SetOutputLanes(Y6, en &  c &  b & ~a);
+    SetOutputLanes(Y7, en &  c &  b &  a);
 }
 
 
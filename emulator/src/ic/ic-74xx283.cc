@@ -17,7 +17,7 @@
 //
 // -- This is the contructor for the full adder
 //    -----------------------------------------
-IC_74xx283_t::IC_74xx283_t()
+IC_74xx283_t::IC_74xx283_t() : HW_Netlist_t::Component_t(pins, PIN_CNT(16))
 {
     pins[CIN] = LOW;
     pins[A0] = LOW;
@@ -40,6 +40,8 @@ IC_74xx283_t::IC_74xx283_t()
     sum = 0;
 
     TriggerFirstUpdate();
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -57,46 +59,92 @@ void IC_74xx283_t::TriggerFirstUpdate(void)
 
 
 
+//
+// -- Update all of the A inputs at once
+//    ----------------------------------
+void IC_74xx283_t::ProcessAUpdate(uint8_t val)
+{
+    pins[A0] = (val & (1 << 0)) ? HIGH : LOW;
+    pins[A1] = (val & (1 << 1)) ? HIGH : LOW;
+    pins[A2] = (val & (1 << 2)) ? HIGH : LOW;
+    pins[A3] = (val & (1 << 3)) ? HIGH : LOW;
+    UpdateSum();
+}
+
+
+
+//
+// -- Update all of the B inputs at once
+//    ----------------------------------
+void IC_74xx283_t::ProcessBUpdate(uint8_t val)
+{
+    pins[B0] = (val & (1 << 0)) ? HIGH : LOW;
+    pins[B1] = (val & (1 << 1)) ? HIGH : LOW;
+    pins[B2] = (val & (1 << 2)) ? HIGH : LOW;
+    pins[B3] = (val & (1 << 3)) ? HIGH : LOW;
+    UpdateSum();
+}
+
+
+
 //
 // -- Update the sum based on a change of the inputs
 //    ----------------------------------------------
 void IC_74xx283_t::UpdateSum(void)
 {
+    TriState_t was[5] = { pins[S0], pins[S1], pins[S2], pins[S3], pins[COUT], };
+
     // -- take care that these internal values are updated before something might further update in a signal
+    Compute();
+
+    if (pins[S0] != was[0]) emit SignalS0Updated(pins[S0]);
+    if (pins[S1] != was[1]) emit SignalS1Updated(pins[S1]);
+    if (pins[S2] != was[2]) emit SignalS2Updated(pins[S2]);
+    if (pins[S3] != was[3]) emit SignalS3Updated(pins[S3]);
+    if (pins[COUT] != was[4]) emit SignalCOutUpdated(pins[COUT]);
+
+    DriveOutputs();
+}
+
+
+
+//
+// -- The sum of the inputs onto the output pins
+//    ------------------------------------------
+void IC_74xx283_t::Compute(void)
+{
     a = ((pins[A3] << 3) | (pins[A2] << 2) | (pins[A1] << 1) | (pins[A0] << 0) & 0x0f);
     b = ((pins[B3] << 3) | (pins[B2] << 2) | (pins[B1] << 1) | (pins[B0] << 0) & 0x0f);
     sum = a + b + (pins[CIN]==HIGH?1:0);
 
-    TriState_t bit0 = ((sum&(1<<0))?HIGH:LOW);
-    TriState_t bit1 = ((sum&(1<<1))?HIGH:LOW);
-    TriState_t bit2 = ((sum&(1<<2))?HIGH:LOW);
-    TriState_t bit3 = ((sum&(1<<3))?HIGH:LOW);
-    TriState_t bit4 = ((sum&(1<<4))?HIGH:LOW);
+    pins[S0] = ((sum&(1<<0))?HIGH:LOW);
+    pins[S1] = ((sum&(1<<1))?HIGH:LOW);
+    pins[S2] = ((sum&(1<<2))?HIGH:LOW);
+    pins[S3] = ((sum&(1<<3))?HIGH:LOW);
+    pins[COUT] = ((sum&(1<<4))?HIGH:LOW);
+}
 
-    if (pins[S0] != bit0) {
-        pins[S0] = bit0;
-        emit SignalS0Updated(pins[S0]);
-    }
 
-    if (pins[S1] != bit1) {
-        pins[S1] = bit1;
-        emit SignalS1Updated(pins[S1]);
-    }
 
-    if (pins[S2] != bit2) {
-        pins[S2] = bit2;
-        emit SignalS2Updated(pins[S2]);
-    }
+//
+// -- The bit-sliced version of the adder, 64 lanes at a time (a ripple of full adders)
+//    ---------------------------------------------------------------------------------
+void IC_74xx283_t::EvaluateLanes(void)
+{
+    const int aPin[4] = { A0, A1, A2, A3, };
+    const int bPin[4] = { B0, B1, B2, B3, };
+    const int sPin[4] = { S0, S1, S2, S3, };
+    uint64_t carry = InputLanes(CIN);
 
-    if (pins[S3] != bit3) {
-        pins[S3] = bit3;
-        emit SignalS3Updated(pins[S3]);
-    }
+    for (int i = 0; i < 4; i ++) {
+        uint64_t a = InputLanes(aPin[i]);
+        uint64_t b = InputLanes(bPin[i]);
 
-    if (pins[COUT] != bit4) {
-        pins[COUT] = bit4;
-        emit SignalCOutUpdated(pins[COUT]);
+        SetOutputLanes(sPin[i], a ^ b ^ carry);
+        carry = (a & b) | (carry & (a ^ b));
     }
+
+    SetOutputLanes(COUT, carry);
 }
 
 
@@ -28,6 +28,8 @@ IC_74xx30_t::IC_74xx30_t(void)
     pins[G] = LOW;
     pins[H] = LOW;
     pins[Y] = HIGH;
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
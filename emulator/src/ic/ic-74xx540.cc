@@ -37,6 +37,8 @@ IC_74xx540_t::IC_74xx540_t()
     pins[Y1] = Z;
     pins[Y0] = Z;
     pins[OE2b] = HIGH;
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -37,6 +37,8 @@ IC_74xx541_t::IC_74xx541_t()
     pins[Y1] = Z;
     pins[Y0] = Z;
     pins[OE2b] = HIGH;
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -75,6 +77,34 @@ void IC_74xx541_t::UpdateOutputs(void)
     emit SignalY5Updated(oe==HIGH?Z:pins[Y5]);
     emit SignalY6Updated(oe==HIGH?Z:pins[Y6]);
     emit SignalY7Updated(oe==HIGH?Z:pins[Y7]);
+
+    emit SignalYWordUpdated(oe==HIGH ? 0x00 :
+            ((pins[Y0] == HIGH ? (1 << 0) : 0) |
+             (pins[Y1] == HIGH ? (1 << 1) : 0) |
+             (pins[Y2] == HIGH ? (1 << 2) : 0) |
+             (pins[Y3] == HIGH ? (1 << 3) : 0) |
+             (pins[Y4] == HIGH ? (1 << 4) : 0) |
+             (pins[Y5] == HIGH ? (1 << 5) : 0) |
+             (pins[Y6] == HIGH ? (1 << 6) : 0) |
+             (pins[Y7] == HIGH ? (1 << 7) : 0)), oe==HIGH ? 0x00 : 0xff);
+}
+
+
+//
+// -- Update all the D inputs at once, with only one update of the outputs
+//    --------------------------------------------------------------------
+void IC_74xx541_t::ProcessUpdateDWord(uint8_t d)
+{
+    pins[D0] = (d & (1 << 0)) ? HIGH : LOW;
+    pins[D1] = (d & (1 << 1)) ? HIGH : LOW;
+    pins[D2] = (d & (1 << 2)) ? HIGH : LOW;
+    pins[D3] = (d & (1 << 3)) ? HIGH : LOW;
+    pins[D4] = (d & (1 << 4)) ? HIGH : LOW;
+    pins[D5] = (d & (1 << 5)) ? HIGH : LOW;
+    pins[D6] = (d & (1 << 6)) ? HIGH : LOW;
+    pins[D7] = (d & (1 << 7)) ? HIGH : LOW;
+
+    UpdateOutputs();
 }
 
 
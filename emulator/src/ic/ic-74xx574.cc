@@ -46,6 +46,8 @@ IC_74xx574_t::IC_74xx574_t()
     d6 = LOW;
     d7 = LOW;
     d8 = LOW;
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -72,6 +74,40 @@ void IC_74xx574_t::TriggerFirstUpdate(void)
     emit SignalQ6Updated(pins[Q6]);
     emit SignalQ7Updated(pins[Q7]);
     emit SignalQ8Updated(pins[Q8]);
+
+    emit SignalQWordUpdated(QWord(), 0xff);
+}
+
+
+//
+// -- pack the Q outputs into a byte
+//    ------------------------------
+uint8_t IC_74xx574_t::QWord(void) const
+{
+    return  (pins[Q8] == HIGH ? (1 << 0) : 0) |
+            (pins[Q7] == HIGH ? (1 << 1) : 0) |
+            (pins[Q6] == HIGH ? (1 << 2) : 0) |
+            (pins[Q5] == HIGH ? (1 << 3) : 0) |
+            (pins[Q4] == HIGH ? (1 << 4) : 0) |
+            (pins[Q3] == HIGH ? (1 << 5) : 0) |
+            (pins[Q2] == HIGH ? (1 << 6) : 0) |
+            (pins[Q1] == HIGH ? (1 << 7) : 0);
+}
+
+
+//
+// -- update all the D inputs at once
+//    -------------------------------
+void IC_74xx574_t::ProcessUpdateDWord(uint8_t d)
+{
+    pins[D8] = (d & (1 << 0)) ? HIGH : LOW;
+    pins[D7] = (d & (1 << 1)) ? HIGH : LOW;
+    pins[D6] = (d & (1 << 2)) ? HIGH : LOW;
+    pins[D5] = (d & (1 << 3)) ? HIGH : LOW;
+    pins[D4] = (d & (1 << 4)) ? HIGH : LOW;
+    pins[D3] = (d & (1 << 5)) ? HIGH : LOW;
+    pins[D2] = (d & (1 << 6)) ? HIGH : LOW;
+    pins[D1] = (d & (1 << 7)) ? HIGH : LOW;
 }
 
 
@@ -80,6 +116,8 @@ void IC_74xx574_t::TriggerFirstUpdate(void)
 //    --------------------------------------------------------------------------
 void IC_74xx574_t::ProcessUpdateOE(TriState_t state)
 {
+    PROFILE_INPUT(pins[OEb], state);
+
     pins[OEb] = state;
 
     emit SignalQ1Updated(pins[OEb]==HIGH?Z:pins[Q1]);
@@ -90,6 +128,8 @@ void IC_74xx574_t::ProcessUpdateOE(TriState_t state)
     emit SignalQ6Updated(pins[OEb]==HIGH?Z:pins[Q6]);
     emit SignalQ7Updated(pins[OEb]==HIGH?Z:pins[Q7]);
     emit SignalQ8Updated(pins[OEb]==HIGH?Z:pins[Q8]);
+
+    emit SignalQWordUpdated(QWord(), DriveMask());
 }
 
 
@@ -98,6 +138,8 @@ void IC_74xx574_t::ProcessUpdateOE(TriState_t state)
 //    ----------------------
 void IC_74xx574_t::ProcessUpdateClockLatch(TriState_t state)
 {
+    PROFILE_INPUT(pins[CLK], state);
+
     pins[CLK] = state;
 
     if (state == HIGH) {
@@ -137,6 +179,8 @@ void IC_74xx574_t::ProcessUpdateClockOutput(TriState_t state)
         emit SignalQ6Updated((pins[OEb]==HIGH)?Z:pins[Q6]);
         emit SignalQ7Updated((pins[OEb]==HIGH)?Z:pins[Q7]);
         emit SignalQ8Updated((pins[OEb]==HIGH)?Z:pins[Q8]);
+
+        emit SignalQWordUpdated(QWord(), DriveMask());
     }
 }
 
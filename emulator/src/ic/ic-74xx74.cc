@@ -40,6 +40,8 @@ IC_74xx74_t::IC_74xx74_t(void)
     lastClk2 = LOW;
 
     TriggerFirstUpdate();
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -60,6 +62,8 @@ void IC_74xx74_t::TriggerFirstUpdate(void)
 //    -----------------------------------
 void IC_74xx74_t::ProcessUpdateClr1(TriState_t state)
 {
+    PROFILE_INPUT(pins[CLR1b], state);
+
     TriState_t q1 = pins[Q1];
     TriState_t q1b = pins[Q1b];
 
@@ -90,6 +94,8 @@ void IC_74xx74_t::ProcessUpdateClr1(TriState_t state)
 //    -----------------------------------
 void IC_74xx74_t::ProcessUpdateClr2(TriState_t state)
 {
+    PROFILE_INPUT(pins[CLR2b], state);
+
     TriState_t q2 = pins[Q2];
     TriState_t q2b = pins[Q2b];
 
@@ -120,6 +126,8 @@ void IC_74xx74_t::ProcessUpdateClr2(TriState_t state)
 //    ---------------------------------
 void IC_74xx74_t::ProcessUpdatePre1(TriState_t state)
 {
+    PROFILE_INPUT(pins[PRE1b], state);
+
     TriState_t q1 = pins[Q1];
     TriState_t q1b = pins[Q1b];
 
@@ -150,6 +158,8 @@ void IC_74xx74_t::ProcessUpdatePre1(TriState_t state)
 //    -----------------------------------
 void IC_74xx74_t::ProcessUpdatePre2(TriState_t state)
 {
+    PROFILE_INPUT(pins[PRE2b], state);
+
     TriState_t q2 = pins[Q2];
     TriState_t q2b = pins[Q2b];
 
@@ -180,6 +190,8 @@ void IC_74xx74_t::ProcessUpdatePre2(TriState_t state)
 //    -------------------
 void IC_74xx74_t::ProcessUpdateClockLatch1(TriState_t state)
 {
+    PROFILE_INPUT(pins[CLK1], state);
+
     lastClk1 = pins[CLK1];
     pins[CLK1] = state;
 
@@ -217,6 +229,8 @@ void IC_74xx74_t::ProcessUpdateClockOutput1(TriState_t state)
 //    -------------------
 void IC_74xx74_t::ProcessUpdateClockLatch2(TriState_t state)
 {
+    PROFILE_INPUT(pins[CLK2], state);
+
     lastClk2 = pins[CLK2];
     pins[CLK2] = state;
 
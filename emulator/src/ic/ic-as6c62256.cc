@@ -63,9 +63,14 @@ IC_as6c62256_t::IC_as6c62256_t(IC_25lc256_t *sanity) : reference(sanity)
 
     updating = false;
 
-    memset(contents, -1, 32*1024);
+    memset(contents, -1, SIZE);
+    refHash = 0;
+    refGeneration = ~0u;
+    Rehash();
 
     TriggerFirstUpdate();
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -143,7 +148,14 @@ void IC_as6c62256_t::ProcessInput(void)
                 (pins[A0] == HIGH ? (1<<0) : 0);
 
 
+    uint8_t old = contents[addr];
+    if (old == byte) return;
+
     contents[addr] = byte;
+    hash ^= Mix(addr, old) ^ Mix(addr, byte);
+
+    int page = addr / PAGE_SIZE;
+    dirty[page / 64] |= (1ull << (page % 64));
 }
 
 
@@ -202,25 +214,25 @@ void IC_as6c62256_t::ProcessOutput(void)
     nq1 = ((outputValue & (1<<1)) != 0) ? HIGH : LOW;
     nq0 = ((outputValue & (1<<0)) != 0) ? HIGH : LOW;
 
-#if !defined(PEDANTIC_COPY) || (PEDANTIC_COPY == 0)
-    emit SignalDq0Updated(nq0);
-    emit SignalDq1Updated(nq1);
-    emit SignalDq2Updated(nq2);
-    emit SignalDq3Updated(nq3);
-    emit SignalDq4Updated(nq4);
-    emit SignalDq5Updated(nq5);
-    emit SignalDq6Updated(nq6);
-    emit SignalDq7Updated(nq7);
-#else
-    if (dq0 != nq0) emit SignalDq0Updated(nq0);
-    if (dq1 != nq1) emit SignalDq1Updated(nq1);
-    if (dq2 != nq2) emit SignalDq2Updated(nq2);
-    if (dq3 != nq3) emit SignalDq3Updated(nq3);
-    if (dq4 != nq4) emit SignalDq4Updated(nq4);
-    if (dq5 != nq5) emit SignalDq5Updated(nq5);
-    if (dq6 != nq6) emit SignalDq6Updated(nq6);
-    if (dq7 != nq7) emit SignalDq7Updated(nq7);
-#endif
+    if (HW_Computer_t::IsFastBoot()) {
+        emit SignalDq0Updated(nq0);
+        emit SignalDq1Updated(nq1);
+        emit SignalDq2Updated(nq2);
+        emit SignalDq3Updated(nq3);
+        emit SignalDq4Updated(nq4);
+        emit SignalDq5Updated(nq5);
+        emit SignalDq6Updated(nq6);
+        emit SignalDq7Updated(nq7);
+    } else {
+        if (dq0 != nq0) emit SignalDq0Updated(nq0);
+        if (dq1 != nq1) emit SignalDq1Updated(nq1);
+        if (dq2 != nq2) emit SignalDq2Updated(nq2);
+        if (dq3 != nq3) emit SignalDq3Updated(nq3);
+        if (dq4 != nq4) emit SignalDq4Updated(nq4);
+        if (dq5 != nq5) emit SignalDq5Updated(nq5);
+        if (dq6 != nq6) emit SignalDq6Updated(nq6);
+        if (dq7 != nq7) emit SignalDq7Updated(nq7);
+    }
 }
 
 
@@ -287,41 +299,103 @@ void IC_as6c62256_t::UpdateAll(void)
 
 
 //
-// -- Do a sanity check by checking the contents of the RAM against the ROM when enabled
-//    ----------------------------------------------------------------------------------
-void IC_as6c62256_t::ProcessSanityCheck(QString name)
+// -- Hash a whole RAM's (or ROM's) worth of data
+//    -------------------------------------------
+uint64_t IC_as6c62256_t::Hash(const uint8_t *data)
+{
+    uint64_t rv = 0;
+    for (int addr = 0; addr < SIZE; addr ++) rv ^= Mix(addr, data[addr]);
+    return rv;
+}
+
+
+
+//
+// -- The contents were replaced wholesale: hash them again and compare everything at the next check
+//    ----------------------------------------------------------------------------------------------
+void IC_as6c62256_t::Rehash(void)
+{
+    hash = Hash(contents);
+    memset(dirty, 0, sizeof(dirty));
+    fullCheck = true;
+}
+
+
+
+//
+// -- Find the first byte which differs from the ROM, either over the dirty pages or over everything; -1 if none
+//    ----------------------------------------------------------------------------------------------------------
+int IC_as6c62256_t::FirstDifference(const uint8_t *rom, bool all)
+{
+    for (int page = 0; page < PAGE_CNT; page ++) {
+        if (!all && (dirty[page / 64] & (1ull << (page % 64))) == 0) continue;
+
+        int base = page * PAGE_SIZE;
+
+        // -- memcmp is vectorized; only a page that differs is looked at byte by byte
+        if (memcmp(rom + base, contents + base, PAGE_SIZE) == 0) continue;
+
+        for (int loc = base; loc < base + PAGE_SIZE; loc ++) {
+            if (rom[loc] != contents[loc]) return loc;
+        }
+    }
+
+    return -1;
+}
+
+
+
+//
+// -- Do a sanity check by checking the contents of the RAM against the ROM when enabled.  Only the pages written
+//    since the last check are compared, unless the whole RAM's hash disagrees with the ROM's or `full` is asked
+//    for; then everything is compared to find where.
+//    -----------------------------------------------------------------------------------------------------------
+void IC_as6c62256_t::ProcessSanityCheck(QString name, bool full)
 {
     if (reference == nullptr) return;
 
     // -- note that this is a friend function to the ROM class definition, so the private members are accessible here
-    int loc;
-    for (loc = 0; loc < 32 * 1024; loc ++)
-    {
-        if (reference->contents[loc] != this->contents[loc]) break;
+    const uint8_t *rom = reference->image->Data();
+
+    if (refGeneration != reference->image->GetGeneration()) {
+        refHash = Hash(rom);
+        refGeneration = reference->image->GetGeneration();
+        fullCheck = true;
     }
 
-    if (loc != 32 * 1024) {
+    bool all = full || fullCheck || hash != refHash;
+    int loc = FirstDifference(rom, all);
+
+    if (loc >= 0) {
         qDebug() << "ERROR!!!  " << name << "RAM is no longer congruent with the reference ROM!!!";
         qDebug() << "The first instance with a problem is at index" << loc;
-        qDebug() << "Expected" << Qt::hex << reference->contents[loc] << "and read" << Qt::hex << this->contents[loc];
+        qDebug() << "Expected" << Qt::hex << rom[loc] << "and read" << Qt::hex << this->contents[loc];
         exit(EXIT_FAILURE);
     } else {
 //        qDebug() << "... data is sane.";
     }
+
+    memset(dirty, 0, sizeof(dirty));
+    fullCheck = false;
 }
 
 
 
 //
-// -- If we are not performing a pedantic copy of the EEPROM to SRAM, knock it out quickly here
-//    -----------------------------------------------------------------------------------------
-void IC_as6c62256_t::CopyEeprom(void)
+// -- For a fast boot, knock out the copy of the EEPROM to SRAM in one step and verify it against the checksum
+//    the image took when it was mapped
+//    --------------------------------------------------------------------------------------------------------
+bool IC_as6c62256_t::CopyEeprom(void)
 {
-#if !defined(PEDANTIC_COPY) || (PEDANTIC_COPY == 0)
-    if (reference == nullptr) return;
+    if (reference == nullptr) return true;
+
+    // -- note that this is a friend function to the ROM class definition, so the private members are accessible here
+    memcpy(this->contents, reference->image->Data(), SIZE);
+    Rehash();
+
+    QByteArrayView ram((const char *)this->contents, SIZE);
 
-    memcpy(this->contents, reference->contents, 32*1024);
-#endif
+    return qChecksum(ram) == reference->image->GetChecksum();
 }
 
 
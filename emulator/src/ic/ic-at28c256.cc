@@ -50,24 +50,12 @@ IC_at28c256_t::IC_at28c256_t(const QString &file)
 
     outputValue = 0;
 
-    memset(contents, -1, 32*1024);
-
-
-    //
-    // -- read the contents of the EEPROM from disk
-    //    -----------------------------------------
-    FILE *fp = fopen(file.toStdString().c_str(), "r");
-
-    if (!fp) {
-        qDebug() << "Unable to open file" << file;
-        memset(contents, 0, sizeof(contents));
-        return;
-    }
-
-    fread(contents, 1, sizeof(contents), fp);
-    fclose(fp);
+    // -- map the contents of the EEPROM from disk; an erased EEPROM reads 0xff past the end of the file
+    image = HW_RomImage_t::Get(file, 0xff);
 
     TriggerFirstUpdate();
+
+    HW_Snapshot_t::Get()->Register(this);
 }
 
 
@@ -95,6 +83,8 @@ void IC_at28c256_t::OutputZ(void)
     emit SignalDq5Updated(Z);
     emit SignalDq6Updated(Z);
     emit SignalDq7Updated(Z);
+
+    emit SignalDqWordUpdated(0, 0x00);
 }
 
 
@@ -132,7 +122,7 @@ void IC_at28c256_t::ProcessOutput(void)
                 (pins[ A0] == HIGH ? (1<< 0) : 0);
 
 
-    outputValue = contents[addr];
+    outputValue = image->Data()[addr];
 
 
     nq7 = ((outputValue & (1<<7)) != 0) ? HIGH : LOW;
@@ -153,6 +143,34 @@ void IC_at28c256_t::ProcessOutput(void)
     emit SignalDq5Updated(nq5);
     emit SignalDq6Updated(nq6);
     emit SignalDq7Updated(nq7);
+
+    emit SignalDqWordUpdated(outputValue, 0xff);
+}
+
+
+
+//
+// -- Update all the address lines at once, with only one update of the outputs
+//    -------------------------------------------------------------------------
+void IC_at28c256_t::ProcessUpdateAddr(uint16_t addr)
+{
+    pins[ A0] = (addr & (1 <<  0)) ? HIGH : LOW;
+    pins[ A1] = (addr & (1 <<  1)) ? HIGH : LOW;
+    pins[ A2] = (addr & (1 <<  2)) ? HIGH : LOW;
+    pins[ A3] = (addr & (1 <<  3)) ? HIGH : LOW;
+    pins[ A4] = (addr & (1 <<  4)) ? HIGH : LOW;
+    pins[ A5] = (addr & (1 <<  5)) ? HIGH : LOW;
+    pins[ A6] = (addr & (1 <<  6)) ? HIGH : LOW;
+    pins[ A7] = (addr & (1 <<  7)) ? HIGH : LOW;
+    pins[ A8] = (addr & (1 <<  8)) ? HIGH : LOW;
+    pins[ A9] = (addr & (1 <<  9)) ? HIGH : LOW;
+    pins[A10] = (addr & (1 << 10)) ? HIGH : LOW;
+    pins[A11] = (addr & (1 << 11)) ? HIGH : LOW;
+    pins[A12] = (addr & (1 << 12)) ? HIGH : LOW;
+    pins[A13] = (addr & (1 << 13)) ? HIGH : LOW;
+    pins[A14] = (addr & (1 << 14)) ? HIGH : LOW;
+
+    UpdateAll();
 }
 
 
@@ -0,0 +1,57 @@
+//===================================================================================================================
+// ic-quad-gate.cc -- The parts of the quad two-input gate ICs which do not depend on the gate
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+#include "../moc/ic-quad-gate.moc.cc"
+
+
+//
+// -- Construct a quad gate IC with every input at `in` and every output at `y`
+//    -------------------------------------------------------------------------
+IC_QuadGateBase_t::IC_QuadGateBase_t(TriState_t in, TriState_t y)
+{
+    high = (in == HIGH ? 0xff : 0x00);
+    low = (in == LOW ? 0xff : 0x00);
+    out = (y == HIGH ? 0x0f : 0x00) | (y == LOW ? 0xf0 : 0x00);
+
+    HW_Snapshot_t::Get()->Register(this);
+}
+
+
+//
+// -- use when built to make sure all the connections are updated
+//    -----------------------------------------------------------
+void IC_QuadGateBase_t::TriggerFirstUpdate(void)
+{
+    UpdatesComplete();
+    emit SignalY1Updated(Output(0));
+    emit SignalY2Updated(Output(1));
+    emit SignalY3Updated(Output(2));
+    emit SignalY4Updated(Output(3));
+}
+
+
+
+//
+// -- Emit the output of one gate
+//    ---------------------------
+void IC_QuadGateBase_t::EmitGate(int gate)
+{
+    switch (gate) {
+    case 0: emit SignalY1Updated(Output(0)); break;
+    case 1: emit SignalY2Updated(Output(1)); break;
+    case 2: emit SignalY3Updated(Output(2)); break;
+    case 3: emit SignalY4Updated(Output(3)); break;
+    }
+}
+
+
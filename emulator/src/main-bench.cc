@@ -0,0 +1,100 @@
+//===================================================================================================================
+//  main-bench.cc -- this is the main entry point for the benchmarks
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  Usage: emu-bench [--behavioral] [--pedantic-copy] [--filter <text>] [--cycles <n>] [<pgm-rom-folder>]
+//
+//  Runs the micro benchmarks on parts built on their own, then builds the computer headless (the same way as
+//  `emu-cli`) for the macro benchmarks.  The table goes to stderr and the JSON to stdout, so the JSON can be
+//  redirected to a file and kept.
+//
+//  `--filter` only runs the benchmarks whose name contains `<text>`.  `--cycles` is how many CPU clock cycles
+//  the cycles-per-second run takes (100000 by default).  `--pedantic-copy` also times the boot with the control
+//  ROMs shifted in bit by bit.  The program run is in `<pgm-rom-folder>`, `../16bcfs-tests/episode-0114` unless
+//  another is given.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+
+
+
+//
+// -- This is never allocated when running headless, but the linker needs to find it
+//    ------------------------------------------------------------------------------
+GUI_Application_t *app = nullptr;
+
+
+//
+// -- get the current clock count
+//    ---------------------------
+unsigned long Count(void)
+{
+    return HW_Computer_t::GetClock()->GetClockCount();
+}
+
+
+//
+// -- The main entry point for the benchmarks
+//    ---------------------------------------
+int main(int argc, char *argv[])
+{
+    bool pedantic = false;
+    QString filter;
+    QString folder = "../16bcfs-tests/episode-0114";
+    unsigned long cycles = 100000;
+
+    for (int i = 1; i < argc; i ++) {
+        QString arg(argv[i]);
+
+        if (arg == "--behavioral") HW_Computer_t::SetDefaultFidelity(HW_Computer_t::BEHAVIORAL);
+        else if (arg == "--pedantic-copy") pedantic = true;
+        else if (arg == "--filter" && i + 1 < argc) filter = argv[++ i];
+        else if (arg == "--cycles" && i + 1 < argc) cycles = QString(argv[++ i]).toULong();
+        else if (!arg.startsWith("--")) folder = arg;
+        else {
+            qDebug().noquote() << "Usage:" << argv[0] << "[--behavioral] [--pedantic-copy] [--filter <text>]"
+                    << "[--cycles <n>] [<pgm-rom-folder>]";
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (cycles == 0) {
+        qDebug().noquote() << "Invalid cycle count";
+        return EXIT_FAILURE;
+    }
+
+    debug = false;
+    headless = true;
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication bench(argc, argv);
+
+    // -- settings will use these if not provided explicitly; they will be relied upon
+    bench.setOrganizationName("eryjus");
+    bench.setApplicationName("16bcfs-emulator");
+
+    HW_Computer_t::SetPgmRomFolder(folder);
+    HW_Computer_t::Get();
+
+    HW_Bench_t runner(filter);
+    int rv = EXIT_SUCCESS;
+
+    // -- the machine is timed first, while nothing else has been built beside it
+    if (!runner.RunMacro(cycles, pedantic)) rv = EXIT_FAILURE;
+    runner.RunMicro();
+
+    runner.Report();
+
+    QFile out;
+    out.open(stdout, QIODevice::WriteOnly);
+    out.write(runner.ToJson());
+
+    return rv;
+}
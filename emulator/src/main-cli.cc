@@ -0,0 +1,247 @@
+//===================================================================================================================
+//  main-cli.cc -- this is the main entry point for the headless emulator, used for batch runs
+//
+//      Copyright (c) 2023-2025 - Adam Clark
+//      License: Beerware
+//
+//  The headless emulator builds the exact same computer as the GUI emulator, but never builds the widget tree
+//  or updates any LEDs.  The modules are still `QGroupBox` subclasses (and the switches are still widgets), so
+//  a `QApplication` is still required.  It is run on the `offscreen` platform so no display is needed.
+//
+//  Usage: emu-cli [--behavioral] [--pedantic-copy] [--restore-snapshot <file>] [--save-snapshot <file>]
+//                 [--trace <file>] [--profile <json>] <pgm-rom-folder> <cycles>
+//         emu-cli --isa <pgm-rom-folder> <cycles>
+//         emu-cli --check-decoders
+//
+//  `--behavioral` builds every module that has a behavioral model that way, unless the `fidelity/<module>`
+//  setting says otherwise.
+//
+//  `--pedantic-copy` turns off the fast boot for this run, so the control ROMs are shifted from EEPROM into SRAM
+//  bit by bit the way the hardware does it, rather than bulk-loaded.
+//
+//  `--restore-snapshot` starts from a machine snapshot instead of a power-on reset; `<cycles>` then counts from
+//  the clock count in the snapshot.  `--save-snapshot` saves one once the cycles have run.  Taken right after
+//  boot, a snapshot lets every test start warm without the reset and the control ROM copy.
+//
+//  `--trace` records the buses, the control word and the clock phases to a VCD waveform file for the whole run.
+//
+//  `--profile` counts the input changes of each IC, the emits of each signal and the no-op updates of each input
+//  slot, reports the busiest of each at the end of the run and writes all of them to `<json>`.
+//
+//  `--isa` does not build the computer either.  It runs the program on the instruction-level engine, straight
+//  from the control ROM images in the `control-rom/folder` setting, and dumps the registers at the end.
+//
+//  The last form does not build the computer at all.  It runs every input through the control logic's 7-bit
+//  decoder using the bit-sliced netlist (64 inputs per pass) and checks that exactly the right output is set.
+//
+//      Date     Tracker  Version  Description
+//  -----------  -------  -------  ---------------------------------------------------------------------------------
+//  2026-Oct-17  Initial  v0.0.1   Initial version
+//===================================================================================================================
+
+
+#include "16bcfs.hh"
+
+
+
+//
+// -- This is never allocated when running headless, but the linker needs to find it
+//    ------------------------------------------------------------------------------
+GUI_Application_t *app = nullptr;
+
+
+//
+// -- The number of CPU clock cycles to run before quitting
+//    -----------------------------------------------------
+static unsigned long cycles = 0;
+
+
+//
+// -- get the current clock count
+//    ---------------------------
+unsigned long Count(void)
+{
+    return HW_Computer_t::GetClock()->GetClockCount();
+}
+
+
+//
+// -- Check the 7-bit decoder exhaustively, 64 inputs at a time
+//    ---------------------------------------------------------
+static int CheckDecoders(void)
+{
+    SubDemux7_t demux;
+    int errors = 0;
+
+    for (int pass = 0; pass < 2; pass ++) {
+        uint64_t sel[7] = { 0 };
+        uint64_t out[128];
+
+        // -- lane `l` decodes the input `pass * 64 + l`
+        for (int l = 0; l < 64; l ++) {
+            int in = pass * 64 + l;
+            for (int b = 0; b < 7; b ++) if (in & (1 << b)) sel[b] |= (1ull << l);
+        }
+
+        demux.DecodeLanes(sel, out);
+
+        for (int o = 0; o < 128; o ++) {
+            uint64_t expected = ((o >> 6) == pass) ? (1ull << (o & 0x3f)) : 0;
+
+            if (out[o] != expected) {
+                qDebug().noquote() << "Decoder output" << QString::number(o, 8) << "is wrong: lanes"
+                        << QString::number(out[o], 16) << "expected" << QString::number(expected, 16);
+                errors ++;
+            }
+        }
+    }
+
+    qDebug().noquote() << "Decoder check complete:" << errors << "errors";
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+
+//
+// -- Run the program on the instruction-level engine
+//    -----------------------------------------------
+static int RunIsa(const QString &folder, const QString &count)
+{
+    bool ok;
+    unsigned long n = count.toULong(&ok);
+    if (!ok) {
+        qDebug().noquote() << "Invalid cycle count:" << count;
+        return EXIT_FAILURE;
+    }
+
+    HW_IsaEngine_t *engine = new HW_IsaEngine_t;
+
+    if (!engine->LoadControlRoms(HW_Computer_t::GetSettings()->value(key).toString())
+            || !engine->LoadProgramRom(folder)) {
+        delete engine;
+        return EXIT_FAILURE;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    unsigned long ran = engine->Run(n);
+    qint64 ns = timer.nsecsElapsed();
+
+    qDebug().noquote() << "Completed" << ran << "cycles" << (engine->IsHalted() ? "(BREAK)" : "")
+            << "at" << (ns ? (double)ran * 1000.0 / ns : 0.0) << "MHz";
+
+    static const char *names[HW_IsaEngine_t::REG_CNT] = {
+        "R1", "R2", "R3", "R4", "R5", "R6", "R7", "R8", "R9", "R10", "R11", "R12",
+        "PGM_SP", "PGM_RA", "PGM_PC", "INT_SP", "INT_RA", "INT_PC",
+    };
+
+    for (int r = 0; r < HW_IsaEngine_t::REG_CNT; r ++) {
+        qDebug().noquote() << QString(names[r]).leftJustified(7)
+                << QString::number(engine->GetRegister((HW_IsaEngine_t::Register_t)r), 16).rightJustified(4, '0');
+    }
+
+    qDebug().noquote() << "Flags  " << "PGM" << QString::number(engine->GetPgmFlags(), 2).rightJustified(5, '0')
+            << "INT" << QString::number(engine->GetIntFlags(), 2).rightJustified(5, '0') << "(LVNCZ)";
+
+    delete engine;
+
+    return EXIT_SUCCESS;
+}
+
+
+//
+// -- The main entry point for the headless application
+//    -------------------------------------------------
+int main(int argc, char *argv[])
+{
+    if (argc == 2 && QString(argv[1]) == "--check-decoders") return CheckDecoders();
+
+    if (argc == 4 && QString(argv[1]) == "--isa") return RunIsa(QString(argv[2]), QString(argv[3]));
+
+    bool pedantic = false;
+    QString restoreFile;
+    QString saveFile;
+    QString traceFile;
+    QString profileFile;
+
+    while (argc > 3) {
+        int used = 1;
+
+        if (QString(argv[1]) == "--behavioral") HW_Computer_t::SetDefaultFidelity(HW_Computer_t::BEHAVIORAL);
+        else if (QString(argv[1]) == "--pedantic-copy") pedantic = true;
+        else if (QString(argv[1]) == "--restore-snapshot" && argc > 4) { restoreFile = argv[2]; used = 2; }
+        else if (QString(argv[1]) == "--save-snapshot" && argc > 4) { saveFile = argv[2]; used = 2; }
+        else if (QString(argv[1]) == "--trace" && argc > 4) { traceFile = argv[2]; used = 2; }
+        else if (QString(argv[1]) == "--profile" && argc > 4) { profileFile = argv[2]; used = 2; }
+        else break;
+
+        argv[used] = argv[0];
+        argc -= used;
+        argv += used;
+    }
+
+    if (argc != 3) {
+        qDebug().noquote() << "Usage:" << argv[0] << "[--behavioral] [--pedantic-copy] [--restore-snapshot <file>]"
+                << "[--save-snapshot <file>] [--trace <file>] [--profile <json>] <pgm-rom-folder> <cycles>";
+        qDebug().noquote() << "      " << argv[0] << "--isa <pgm-rom-folder> <cycles>";
+        qDebug().noquote() << "      " << argv[0] << "--check-decoders";
+        return EXIT_FAILURE;
+    }
+
+    bool ok;
+    cycles = QString(argv[2]).toULong(&ok);
+    if (!ok) {
+        qDebug().noquote() << "Invalid cycle count:" << argv[2];
+        return EXIT_FAILURE;
+    }
+
+    debug = false;
+    headless = true;
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication cli(argc, argv);
+
+    // -- settings will use these if not provided explicitly; they will be relied upon
+    cli.setOrganizationName("eryjus");
+    cli.setApplicationName("16bcfs-emulator");
+
+    HW_Computer_t::SetPgmRomFolder(QString(argv[1]));
+    if (!profileFile.isEmpty()) HW_Profile_t::Get()->Start(profileFile);
+    HW_Computer_t::Get();
+    if (pedantic) HW_Computer_t::SetFastBoot(false);
+    if (!traceFile.isEmpty() && !HW_Trace_t::Get()->Start(traceFile)) return EXIT_FAILURE;
+
+    // -- batch runs are not paced; stop the scheduler mid-slice so no extra cycles run before quitting
+    HW_Scheduler_t::Get()->SetTargetFrequency(0);
+
+    QObject::connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalCpuClockOutput, &cli,
+            [&cli](TriState_t state) {
+                if (state == HIGH && Count() >= cycles) {
+                    HW_Scheduler_t::Get()->Stop();
+                    cli.quit();
+                }
+            });
+
+    if (restoreFile.isEmpty()) {
+        HW_Computer_t::Get()->PerformReset();
+        HW_Computer_t::GetClock()->SelectHighSpeedClock();
+    } else {
+        QElapsedTimer timer;
+        timer.start();
+
+        if (!HW_Snapshot_t::Get()->Restore(restoreFile)) return EXIT_FAILURE;
+
+        qDebug().noquote() << "Restored" << restoreFile << "at" << Count() << "cycles in" << timer.elapsed() << "ms";
+        cycles += Count();
+    }
+
+    int rv = cli.exec();
+
+    HW_Trace_t::Get()->Stop();
+    qDebug().noquote() << "Completed" << Count() << "cycles";
+    HW_Profile_t::Get()->Stop();
+
+    if (!saveFile.isEmpty() && !HW_Snapshot_t::Get()->Save(saveFile)) rv = EXIT_FAILURE;
+
+    return rv;
+}
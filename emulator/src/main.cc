@@ -42,6 +42,9 @@ int main(int argc, char *argv[])
     app->setApplicationName("16bcfs-emulator");
     HW_Computer_t::Get()->PerformReset();
 
+    // -- from here on the machine runs on a thread of its own, and the GUI only posts inputs to it
+    HW_SimThread_t::Get()->Start();
+
     return app->exec();
 }
 
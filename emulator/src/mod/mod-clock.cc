@@ -26,12 +26,13 @@
 ClockModule_t::ClockModule_t(void) : QGroupBox("Clock Module")
 {
     clockCount = 0;
+    HW_Snapshot_t::Get()->Register(this);
 
     setFixedWidth(190);
     setFixedHeight(150);
 
     AllocateComponents();
-    BuildGui();
+    if (!headless) BuildGui();
     WireUp();
     SetDebug();
     TriggerFirstUpdate();
@@ -46,6 +47,17 @@ ClockModule_t::ClockModule_t(void) : QGroupBox("Clock Module")
 
 
 
+//
+// -- Select the high speed oscillator as the CPU clock (same as pressing the Osc button)
+//    -----------------------------------------------------------------------------------
+void ClockModule_t::SelectHighSpeedClock(void)
+{
+    oscMomentary->ProcessClick();
+    oscMomentary->ProcessRelease();
+}
+
+
+
 //
 // -- allocate all the components needed for this module
 //    --------------------------------------------------
@@ -164,11 +176,11 @@ void ClockModule_t::WireUp(void)
     //
     // -- The inputs into nand1
     //    ---------------------
-    connect(oscMomentary, &GUI_MomentarySwitch_t::SignalSwitchChanged, nand1, &IC_74xx00_t::ProcessUpdateA1);
-    connect(nand1, &IC_74xx00_t::SignalY2Updated, nand1, &IC_74xx00_t::ProcessUpdateB1);
+    connect(oscMomentary, &GUI_MomentarySwitch_t::SignalSwitchChanged, nand1, &IC_74xx00_t::ProcessUpdateA1, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY2Updated, nand1, &IC_74xx00_t::ProcessUpdateB1, CNN_TYPE);
 
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, nand1, &IC_74xx00_t::ProcessUpdateA2);
-    connect(nor1, &IC_74xx02_t::SignalY1Updated, nand1, &IC_74xx00_t::ProcessUpdateB2);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, nand1, &IC_74xx00_t::ProcessUpdateA2, CNN_TYPE);
+    connect(nor1, &IC_74xx02_t::SignalY1Updated, nand1, &IC_74xx00_t::ProcessUpdateB2, CNN_TYPE);
 
 
     // -- the other 2 gates are unused
@@ -182,35 +194,35 @@ void ClockModule_t::WireUp(void)
     //
     // -- The inputs into nand2
     //    ---------------------
-    connect(and1, &IC_74xx08_t::SignalY1Updated, nand2, &IC_74xx00_t::ProcessUpdateA1);     // set
-    connect(nand2, &IC_74xx00_t::SignalY2Updated, nand2, &IC_74xx00_t::ProcessUpdateB1);
+    connect(and1, &IC_74xx08_t::SignalY1Updated, nand2, &IC_74xx00_t::ProcessUpdateA1, CNN_TYPE);     // set
+    connect(nand2, &IC_74xx00_t::SignalY2Updated, nand2, &IC_74xx00_t::ProcessUpdateB1, CNN_TYPE);
 
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, nand2, &IC_74xx00_t::ProcessUpdateA2);
-    connect(nor1, &IC_74xx02_t::SignalY2Updated, nand2, &IC_74xx00_t::ProcessUpdateB2);     // reset
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, nand2, &IC_74xx00_t::ProcessUpdateA2, CNN_TYPE);
+    connect(nor1, &IC_74xx02_t::SignalY2Updated, nand2, &IC_74xx00_t::ProcessUpdateB2, CNN_TYPE);     // reset
 
 
-    connect(nand2, &IC_74xx00_t::SignalY4Updated, nand2, &IC_74xx00_t::ProcessUpdateA3);
-    connect(nor1, &IC_74xx02_t::SignalY3Updated, nand2, &IC_74xx00_t::ProcessUpdateB3);     // reset
+    connect(nand2, &IC_74xx00_t::SignalY4Updated, nand2, &IC_74xx00_t::ProcessUpdateA3, CNN_TYPE);
+    connect(nor1, &IC_74xx02_t::SignalY3Updated, nand2, &IC_74xx00_t::ProcessUpdateB3, CNN_TYPE);     // reset
 
-    connect(nor1, &IC_74xx02_t::SignalY4Updated, nand2, &IC_74xx00_t::ProcessUpdateA4);     // set
-    connect(nand2, &IC_74xx00_t::SignalY3Updated, nand2, &IC_74xx00_t::ProcessUpdateB4);
+    connect(nor1, &IC_74xx02_t::SignalY4Updated, nand2, &IC_74xx00_t::ProcessUpdateA4, CNN_TYPE);     // set
+    connect(nand2, &IC_74xx00_t::SignalY3Updated, nand2, &IC_74xx00_t::ProcessUpdateB4, CNN_TYPE);
 
 
 
     //
     // -- Inputs for the nor gates
     //    ------------------------
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA1);
-    connect(nand2, &IC_74xx00_t::SignalY4Updated, nor1, &IC_74xx02_t::ProcessUpdateB1);
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA1, CNN_TYPE);
+    connect(nand2, &IC_74xx00_t::SignalY4Updated, nor1, &IC_74xx02_t::ProcessUpdateB1, CNN_TYPE);
 
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA2);
-    connect(nand2, &IC_74xx00_t::SignalY4Updated, nor1, &IC_74xx02_t::ProcessUpdateB2);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA2, CNN_TYPE);
+    connect(nand2, &IC_74xx00_t::SignalY4Updated, nor1, &IC_74xx02_t::ProcessUpdateB2, CNN_TYPE);
 
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA3);
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateB3);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA3, CNN_TYPE);
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateB3, CNN_TYPE);
 
 
-    connect(stepMomentary, &GUI_MomentarySwitch_t::SignalSwitchChanged, nor1, &IC_74xx02_t::ProcessUpdateA4);
+    connect(stepMomentary, &GUI_MomentarySwitch_t::SignalSwitchChanged, nor1, &IC_74xx02_t::ProcessUpdateA4, CNN_TYPE);
     // B4 is handled in `ProcessSignalBreak`
 
 
@@ -218,26 +230,26 @@ void ClockModule_t::WireUp(void)
     //
     // -- Inputs into the and gates
     //    -------------------------
-    connect(adjMomentary, &GUI_MomentarySwitch_t::SignalSwitchChanged, and1, &IC_74xx08_t::ProcessUpdateA1);
+    connect(adjMomentary, &GUI_MomentarySwitch_t::SignalSwitchChanged, and1, &IC_74xx08_t::ProcessUpdateA1, CNN_TYPE);
     // B1 is handled in `ProcessReset`
 
 
-    connect(divider1, &IC_74xx193_t::SignalBoUpdated, and1, &IC_74xx08_t::ProcessUpdateA2);
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, and1, &IC_74xx08_t::ProcessUpdateB2);
+    connect(divider1, &IC_74xx193_t::SignalBoUpdated, and1, &IC_74xx08_t::ProcessUpdateA2, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, and1, &IC_74xx08_t::ProcessUpdateB2, CNN_TYPE);
 
-    connect(adj, &HW_Oscillator_t::SignalStateChanged, and1, &IC_74xx08_t::ProcessUpdateA3);
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, and1, &IC_74xx08_t::ProcessUpdateB3);
+    connect(adj, &HW_Oscillator_t::SignalStateChanged, and1, &IC_74xx08_t::ProcessUpdateA3, CNN_TYPE);
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, and1, &IC_74xx08_t::ProcessUpdateB3, CNN_TYPE);
 
-    connect(singleStepDebounced, &HW_SpdtSwitch_t::SignalState, and1, &IC_74xx08_t::ProcessUpdateA4);
-    connect(nand2, &IC_74xx00_t::SignalY4Updated, and1, &IC_74xx08_t::ProcessUpdateB4);
+    connect(singleStepDebounced, &HW_SpdtSwitch_t::SignalState, and1, &IC_74xx08_t::ProcessUpdateA4, CNN_TYPE);
+    connect(nand2, &IC_74xx00_t::SignalY4Updated, and1, &IC_74xx08_t::ProcessUpdateB4, CNN_TYPE);
 
 
 
     //
     // -- and 2 gates
     //    -----------
-    connect(nand2, &IC_74xx00_t::SignalY3Updated, and2, &IC_74xx08_t::ProcessUpdateA1);
-    connect(latch1, &IC_74xx74_t::SignalQ1Updated, and2, &IC_74xx08_t::ProcessUpdateB1);
+    connect(nand2, &IC_74xx00_t::SignalY3Updated, and2, &IC_74xx08_t::ProcessUpdateA1, CNN_TYPE);
+    connect(latch1, &IC_74xx74_t::SignalQ1Updated, and2, &IC_74xx08_t::ProcessUpdateB1, CNN_TYPE);
 
 
     and2->ProcessA2High();
@@ -245,30 +257,30 @@ void ClockModule_t::WireUp(void)
 
 
     // -- the other 2 gates are drivers for LEDs
-    connect(nand2, &IC_74xx00_t::SignalY4Updated, and2, &IC_74xx08_t::ProcessUpdateA3);
-    connect(nand2, &IC_74xx00_t::SignalY4Updated, and2, &IC_74xx08_t::ProcessUpdateB3);
+    connect(nand2, &IC_74xx00_t::SignalY4Updated, and2, &IC_74xx08_t::ProcessUpdateA3, CNN_TYPE);
+    connect(nand2, &IC_74xx00_t::SignalY4Updated, and2, &IC_74xx08_t::ProcessUpdateB3, CNN_TYPE);
 
-    connect(or1, &IC_74xx32_t::SignalY2Updated, and2, &IC_74xx08_t::ProcessUpdateA4);
-    connect(or1, &IC_74xx32_t::SignalY2Updated, and2, &IC_74xx08_t::ProcessUpdateB4);
+    connect(or1, &IC_74xx32_t::SignalY2Updated, and2, &IC_74xx08_t::ProcessUpdateA4, CNN_TYPE);
+    connect(or1, &IC_74xx32_t::SignalY2Updated, and2, &IC_74xx08_t::ProcessUpdateB4, CNN_TYPE);
 
 
 
     //
     // -- Inputs into the Or gate
     //    -----------------------
-    connect(and1, &IC_74xx08_t::SignalY2Updated, or1, &IC_74xx32_t::ProcessUpdateA1);
-    connect(and1, &IC_74xx08_t::SignalY3Updated, or1, &IC_74xx32_t::ProcessUpdateB1);
+    connect(and1, &IC_74xx08_t::SignalY2Updated, or1, &IC_74xx32_t::ProcessUpdateA1, CNN_TYPE);
+    connect(and1, &IC_74xx08_t::SignalY3Updated, or1, &IC_74xx32_t::ProcessUpdateB1, CNN_TYPE);
 
-    connect(and2, &IC_74xx08_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateA2);
-    connect(and1, &IC_74xx08_t::SignalY4Updated, or1, &IC_74xx32_t::ProcessUpdateB2);
+    connect(and2, &IC_74xx08_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateA2, CNN_TYPE);
+    connect(and1, &IC_74xx08_t::SignalY4Updated, or1, &IC_74xx32_t::ProcessUpdateB2, CNN_TYPE);
 
 
     // These 2 gates drive LEDs
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateA3);
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateB3);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateA3, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateB3, CNN_TYPE);
 
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateA4);
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateB4);
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateA4, CNN_TYPE);
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateB4, CNN_TYPE);
 
 
 
@@ -276,9 +288,9 @@ void ClockModule_t::WireUp(void)
     // -- Inputs for the latch
     //    --------------------
     latch1->ProcessUpdatePre1(HIGH);
-    connect(latch1, &IC_74xx74_t::SignalQ1bUpdated, latch1, &IC_74xx74_t::ProcessUpdateD1);
-    connect(or1, &IC_74xx32_t::SignalY1Updated, latch1, &IC_74xx74_t::ProcessUpdateClockLatch1);
-    connect(or1, &IC_74xx32_t::SignalY1Updated, latch1, &IC_74xx74_t::ProcessUpdateClockOutput1);
+    connect(latch1, &IC_74xx74_t::SignalQ1bUpdated, latch1, &IC_74xx74_t::ProcessUpdateD1, CNN_TYPE);
+    connect(or1, &IC_74xx32_t::SignalY1Updated, latch1, &IC_74xx74_t::ProcessUpdateClockLatch1, CNN_TYPE);
+    connect(or1, &IC_74xx32_t::SignalY1Updated, latch1, &IC_74xx74_t::ProcessUpdateClockOutput1, CNN_TYPE);
     // Set1 is handled in `ProcessCpyHld`
 
 
@@ -293,13 +305,13 @@ void ClockModule_t::WireUp(void)
     //
     // -- Inputs into the counter as the clock divider
     //    --------------------------------------------
-    connect(div0, &GUI_DipSwitch_t::SignalSwitchChanged, divider1, &IC_74xx193_t::ProcessUpdateA);
-    connect(div1, &GUI_DipSwitch_t::SignalSwitchChanged, divider1, &IC_74xx193_t::ProcessUpdateB);
-    connect(div2, &GUI_DipSwitch_t::SignalSwitchChanged, divider1, &IC_74xx193_t::ProcessUpdateC);
-    connect(div3, &GUI_DipSwitch_t::SignalSwitchChanged, divider1, &IC_74xx193_t::ProcessUpdateD);
-    connect(divider1, &IC_74xx193_t::SignalBoUpdated, divider1, &IC_74xx193_t::ProcessUpdateLoad);
+    connect(div0, &GUI_DipSwitch_t::SignalSwitchChanged, divider1, &IC_74xx193_t::ProcessUpdateA, CNN_TYPE);
+    connect(div1, &GUI_DipSwitch_t::SignalSwitchChanged, divider1, &IC_74xx193_t::ProcessUpdateB, CNN_TYPE);
+    connect(div2, &GUI_DipSwitch_t::SignalSwitchChanged, divider1, &IC_74xx193_t::ProcessUpdateC, CNN_TYPE);
+    connect(div3, &GUI_DipSwitch_t::SignalSwitchChanged, divider1, &IC_74xx193_t::ProcessUpdateD, CNN_TYPE);
+    connect(divider1, &IC_74xx193_t::SignalBoUpdated, divider1, &IC_74xx193_t::ProcessUpdateLoad, CNN_TYPE);
     divider1->ProcessUpdateUp(HIGH);
-    connect(osc, &HW_Oscillator_t::SignalStateChanged, divider1, &IC_74xx193_t::ProcessUpdateDown);
+    connect(osc, &HW_Oscillator_t::SignalStateChanged, divider1, &IC_74xx193_t::ProcessUpdateDown, CNN_TYPE);
     divider1->ProcessUpdateClr(LOW);
 
 
@@ -307,31 +319,32 @@ void ClockModule_t::WireUp(void)
     //
     // -- Connect the HS_CLK crystal to its output
     //    ----------------------------------------
-    connect(osc, &HW_Oscillator_t::SignalStateChanged, this, &ClockModule_t::ProcessHighSpeedClock);
+    connect(osc, &HW_Oscillator_t::SignalStateChanged, this, &ClockModule_t::ProcessHighSpeedClock, CNN_TYPE);
 
 
 
     //
     // -- connect the CPU Clock to its output
     //    -----------------------------------
-    connect(or1, &IC_74xx32_t::SignalY2Updated, this, &ClockModule_t::ProcessCpuClock);
+    connect(or1, &IC_74xx32_t::SignalY2Updated, this, &ClockModule_t::IncrementClockCount, CNN_TYPE);
+    connect(or1, &IC_74xx32_t::SignalY2Updated, this, &ClockModule_t::ProcessCpuClock, CNN_TYPE);
 
 
 
     //
     // -- connect up the LEDs
     //    -------------------
-    connect(or1, &IC_74xx32_t::SignalY3Updated, oscLed, &GUI_Led_t::ProcessStateChange);
-    connect(or1, &IC_74xx32_t::SignalY4Updated, adjLed, &GUI_Led_t::ProcessStateChange);
-    connect(and2, &IC_74xx08_t::SignalY3Updated, stepLed, &GUI_Led_t::ProcessStateChange);
-    connect(and2, &IC_74xx08_t::SignalY4Updated, actualClock, &GUI_Led_t::ProcessStateChange);
+    connect(or1, &IC_74xx32_t::SignalY3Updated, oscLed, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
+    connect(or1, &IC_74xx32_t::SignalY4Updated, adjLed, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
+    connect(and2, &IC_74xx08_t::SignalY3Updated, stepLed, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
+    connect(and2, &IC_74xx08_t::SignalY4Updated, actualClock, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
 
 
 
     //
     // -- connect the pot to adjust the adjustible clock
     //    ----------------------------------------------
-    connect(speedPot, &HW_Pot_t::SignalValueChanged, adj, &HW_Oscillator_t::ProcessRawInterval);
+    connect(speedPot, &HW_Pot_t::SignalValueChanged, adj, &HW_Oscillator_t::ProcessRawInterval, CNN_TYPE);
 }
 
 
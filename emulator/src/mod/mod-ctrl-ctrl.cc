@@ -78,7 +78,7 @@ CtrlRomCtrlModule_t::CtrlRomCtrlModule_t(void) : QGroupBox("Control ROM Control"
     setFixedHeight(120);
 
     AllocateComponents();
-    BuildGui();
+    if (!headless) BuildGui();
     WireUp();
     SetDebug();
     TriggerFirstUpdate();
@@ -219,9 +219,9 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // -- Gate 1 is used for the In Reset condition
     //    -----------------------------------------
     resetting->ProcessUpdateClr1(HIGH);                                                             // pin 1: #CLR1
-    connect(nand2, &IC_74xx00_t::SignalY4Updated, resetting, &IC_74xx74_t::ProcessUpdateD1);        // pin 2: D1
-    connect(inv1, &IC_74xx04_t::SignalY1Updated, resetting, &IC_74xx74_t::ProcessUpdateClockLatch1);       // pin 3: CLK1 from local clock
-    connect(inv1, &IC_74xx04_t::SignalY1Updated, resetting, &IC_74xx74_t::ProcessUpdateClockOutput1);       // pin 3: CLK1 from local clock
+    connect(nand2, &IC_74xx00_t::SignalY4Updated, resetting, &IC_74xx74_t::ProcessUpdateD1, CNN_TYPE);        // pin 2: D1
+    connect(inv1, &IC_74xx04_t::SignalY1Updated, resetting, &IC_74xx74_t::ProcessUpdateClockLatch1, CNN_TYPE);       // pin 3: CLK1 from local clock
+    connect(inv1, &IC_74xx04_t::SignalY1Updated, resetting, &IC_74xx74_t::ProcessUpdateClockOutput1, CNN_TYPE);       // pin 3: CLK1 from local clock
     // pin 4 is handled in ProcessResetUpdate() -- below
     // pin 5 is the Q output pin
     // pin 6 is the #Q output pin
@@ -233,9 +233,9 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // pin 8 is the #Q pin (unused)
     // pin 9 is the Q pin (handled by its inputs)
     // pin 10 is handled in ProcessResetUpdate() -- below
-    connect(inv1, &IC_74xx04_t::SignalY1Updated, resetting, &IC_74xx74_t::ProcessUpdateClockLatch2);       // pin 11: CLK2 from local clock
-    connect(inv1, &IC_74xx04_t::SignalY1Updated, resetting, &IC_74xx74_t::ProcessUpdateClockOutput2);       // pin 11: CLK2 from local clock
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, resetting, &IC_74xx74_t::ProcessUpdateD2);        // pin 12: D2
+    connect(inv1, &IC_74xx04_t::SignalY1Updated, resetting, &IC_74xx74_t::ProcessUpdateClockLatch2, CNN_TYPE);       // pin 11: CLK2 from local clock
+    connect(inv1, &IC_74xx04_t::SignalY1Updated, resetting, &IC_74xx74_t::ProcessUpdateClockOutput2, CNN_TYPE);       // pin 11: CLK2 from local clock
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, resetting, &IC_74xx74_t::ProcessUpdateD2, CNN_TYPE);        // pin 12: D2
     resetting->ProcessUpdateClr2(HIGH);                                                             // pin 13: #CLR2
 
 
@@ -249,10 +249,10 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // -- Gates 1&2 are used for the Copying (Qc) SR Latch
     //    ------------------------------------------------
     // pin 1 is the set pin, and handled in ProcessResetUpdate() -- below
-    connect(nand1, &IC_74xx00_t::SignalY2Updated, nand1, &IC_74xx00_t::ProcessUpdateB1);            // pin 2: 1B Input
+    connect(nand1, &IC_74xx00_t::SignalY2Updated, nand1, &IC_74xx00_t::ProcessUpdateB1, CNN_TYPE);            // pin 2: 1B Input
     // pin 3 is the output of the set-side gate -- Qc
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, nand1, &IC_74xx00_t::ProcessUpdateA2);            // pin 4: 2A input
-    connect(addrC, &IC_74xx193_t::SignalCoUpdated, nand1, &IC_74xx00_t::ProcessUpdateB2);           // pin 5: 2B input
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, nand1, &IC_74xx00_t::ProcessUpdateA2, CNN_TYPE);            // pin 4: 2A input
+    connect(addrC, &IC_74xx193_t::SignalCoUpdated, nand1, &IC_74xx00_t::ProcessUpdateB2, CNN_TYPE);           // pin 5: 2B input
     // pin 6 is the output of the reset-side gate -- #Qc
 
 
@@ -260,11 +260,11 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // -- Gates 3&4 are for the Shifting (Qs) SR latch
     //    --------------------------------------------
     // pin 8 is the output of the reset-side gate -- #Qs
-    connect(inv1, &IC_74xx04_t::SignalY6Updated, nand1, &IC_74xx00_t::ProcessUpdateA3);             // pin 9: 3A Input
-    connect(nand1, &IC_74xx00_t::SignalY4Updated, nand1, &IC_74xx00_t::ProcessUpdateB3);            // pin 10: 3B Input
+    connect(inv1, &IC_74xx04_t::SignalY6Updated, nand1, &IC_74xx00_t::ProcessUpdateA3, CNN_TYPE);             // pin 9: 3A Input
+    connect(nand1, &IC_74xx00_t::SignalY4Updated, nand1, &IC_74xx00_t::ProcessUpdateB3, CNN_TYPE);            // pin 10: 3B Input
     // pin 11 is the output of the set-side gate -- Qs
-    connect(nand1, &IC_74xx00_t::SignalY3Updated, nand1, &IC_74xx00_t::ProcessUpdateA4);            // pin 12: 4A Input
-    connect(inv1, &IC_74xx04_t::SignalY5Updated, nand1, &IC_74xx00_t::ProcessUpdateB4);             // pin 13: 4B Input
+    connect(nand1, &IC_74xx00_t::SignalY3Updated, nand1, &IC_74xx00_t::ProcessUpdateA4, CNN_TYPE);            // pin 12: 4A Input
+    connect(inv1, &IC_74xx04_t::SignalY5Updated, nand1, &IC_74xx00_t::ProcessUpdateB4, CNN_TYPE);             // pin 13: 4B Input
 
 
 
@@ -275,11 +275,11 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //
     // -- Gates 1&2 are used for the Copying (Ql) SR Latch
     //    ------------------------------------------------
-    connect(or1, &IC_74xx32_t::SignalY3Updated, nand2, &IC_74xx00_t::ProcessUpdateA1);              // pin 1: 2B input (Set)
-    connect(nand2, &IC_74xx00_t::SignalY2Updated, nand2, &IC_74xx00_t::ProcessUpdateB1);            // pin 2: 1B Input
+    connect(or1, &IC_74xx32_t::SignalY3Updated, nand2, &IC_74xx00_t::ProcessUpdateA1, CNN_TYPE);              // pin 1: 2B input (Set)
+    connect(nand2, &IC_74xx00_t::SignalY2Updated, nand2, &IC_74xx00_t::ProcessUpdateB1, CNN_TYPE);            // pin 2: 1B Input
     // pin 3 is the output of the set-side gate -- Ql
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, nand2, &IC_74xx00_t::ProcessUpdateA2);            // pin 4: 2A input
-    connect(inv1, &IC_74xx04_t::SignalY6Updated, nand2, &IC_74xx00_t::ProcessUpdateB2);             // pin 5: 1A Input (Reset)
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, nand2, &IC_74xx00_t::ProcessUpdateA2, CNN_TYPE);            // pin 4: 2A input
+    connect(inv1, &IC_74xx04_t::SignalY6Updated, nand2, &IC_74xx00_t::ProcessUpdateB2, CNN_TYPE);             // pin 5: 1A Input (Reset)
     // pin 6 is the output of the reset-side gate -- #Ql
 
 
@@ -308,7 +308,7 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //
     // -- Gate 1 is used for (Qc * CLK)
     //    -----------------------------
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, and1, &IC_74xx08_t::ProcessUpdateA1);             // pin 1: Qc input
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, and1, &IC_74xx08_t::ProcessUpdateA1, CNN_TYPE);             // pin 1: Qc input
 //    connect(clock, &HW_Oscillator_t::SignalStateChanged, and1, &IC_74xx08_t::ProcessUpdateB1);      // pin 2: CLK input
     // pin 3 is the output (Qc * CLK)
 
@@ -316,8 +316,8 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //
     // -- Gate 2 is ued for ((Qc * CLK) * Qs)
     //    -----------------------------------
-    connect(and1, &IC_74xx08_t::SignalY1Updated, and1, &IC_74xx08_t::ProcessUpdateA2);              // pin 4: (Qc * CLK) input
-    connect(nand1, &IC_74xx00_t::SignalY4Updated, and1, &IC_74xx08_t::ProcessUpdateB2);             // pin 5: Qs
+    connect(and1, &IC_74xx08_t::SignalY1Updated, and1, &IC_74xx08_t::ProcessUpdateA2, CNN_TYPE);              // pin 4: (Qc * CLK) input
+    connect(nand1, &IC_74xx00_t::SignalY4Updated, and1, &IC_74xx08_t::ProcessUpdateB2, CNN_TYPE);             // pin 5: Qs
     // pin 6 is the output ((Qc * CLK) * Qs)
 
 
@@ -325,16 +325,16 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // -- Gate 3 is used for ((#Bc * #Bb) * Ba)
     //    -------------------------------------
     // pin 8 is the output ((#Bc * #Bb) * Ba)
-    connect(bits, &IC_74xx193_t::SignalQaUpdated, and1, &IC_74xx08_t::ProcessUpdateA3);             // pin 9: Ba input
-    connect(and1, &IC_74xx08_t::SignalY4Updated, and1, &IC_74xx08_t::ProcessUpdateB3);              // pin 10: (#Bc * #Bb) input
+    connect(bits, &IC_74xx193_t::SignalQaUpdated, and1, &IC_74xx08_t::ProcessUpdateA3, CNN_TYPE);             // pin 9: Ba input
+    connect(and1, &IC_74xx08_t::SignalY4Updated, and1, &IC_74xx08_t::ProcessUpdateB3, CNN_TYPE);              // pin 10: (#Bc * #Bb) input
 
 
     //
     // -- Gate 4 is used for (#Bc * #Bb)
     //    ------------------------------
     // pin 11 is the output (#Bc * #Bb)
-    connect(inv1, &IC_74xx04_t::SignalY3Updated, and1, &IC_74xx08_t::ProcessUpdateA4);              // pin 12: #Bc Input
-    connect(inv1, &IC_74xx04_t::SignalY2Updated, and1, &IC_74xx08_t::ProcessUpdateB4);              // pin 13: #Bb Input
+    connect(inv1, &IC_74xx04_t::SignalY3Updated, and1, &IC_74xx08_t::ProcessUpdateA4, CNN_TYPE);              // pin 12: #Bc Input
+    connect(inv1, &IC_74xx04_t::SignalY2Updated, and1, &IC_74xx08_t::ProcessUpdateB4, CNN_TYPE);              // pin 13: #Bb Input
 
 
 
@@ -345,16 +345,16 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //
     // -- Gate 1 is used for (#CLK * #Bd)
     //    -------------------------------
-    connect(inv1, &IC_74xx04_t::SignalY1Updated, and2, &IC_74xx08_t::ProcessUpdateA1);              // pin 1: #CLK Input
-    connect(inv1, &IC_74xx04_t::SignalY4Updated, and2, &IC_74xx08_t::ProcessUpdateB1);              // pin 2: #Bd Input
+    connect(inv1, &IC_74xx04_t::SignalY1Updated, and2, &IC_74xx08_t::ProcessUpdateA1, CNN_TYPE);              // pin 1: #CLK Input
+    connect(inv1, &IC_74xx04_t::SignalY4Updated, and2, &IC_74xx08_t::ProcessUpdateB1, CNN_TYPE);              // pin 2: #Bd Input
     // pin 3 is the output (#CLK * #Bd)
 
 
     //
     // -- Gate 2 is used for ((#CLK * #Bd) * ((#Bc * #Bb) * Ba))
     //    ------------------------------------------------------
-    connect(and2, &IC_74xx08_t::SignalY1Updated, and2, &IC_74xx08_t::ProcessUpdateA2);              // pin 4: (#CLK * #Bd) Input
-    connect(and1, &IC_74xx08_t::SignalY3Updated, and2, &IC_74xx08_t::ProcessUpdateB2);              // pin 5: ((#Bc * #Bb) * Ba) Input
+    connect(and2, &IC_74xx08_t::SignalY1Updated, and2, &IC_74xx08_t::ProcessUpdateA2, CNN_TYPE);              // pin 4: (#CLK * #Bd) Input
+    connect(and1, &IC_74xx08_t::SignalY3Updated, and2, &IC_74xx08_t::ProcessUpdateB2, CNN_TYPE);              // pin 5: ((#Bc * #Bb) * Ba) Input
     // pin 6 is the complete ((#CLK * #Bd) * ((#Bc * #Bb) * Ba)) Output
 
 
@@ -362,16 +362,16 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // -- Gate 3 is used for (Bd * ((#Bc * #Bb) * Ba))
     //    --------------------------------------------
     // pin 8 is the output (Bd * ((#Bc * #Bb) * Ba))
-    connect(bits, &IC_74xx193_t::SignalQdUpdated, and2, &IC_74xx08_t::ProcessUpdateA3);             // pin 9: Bd Input
-    connect(and1, &IC_74xx08_t::SignalY3Updated, and2, &IC_74xx08_t::ProcessUpdateB3);              // pin 10: ((#Bc * #Bb) * Ba) Input
+    connect(bits, &IC_74xx193_t::SignalQdUpdated, and2, &IC_74xx08_t::ProcessUpdateA3, CNN_TYPE);             // pin 9: Bd Input
+    connect(and1, &IC_74xx08_t::SignalY3Updated, and2, &IC_74xx08_t::ProcessUpdateB3, CNN_TYPE);              // pin 10: ((#Bc * #Bb) * Ba) Input
 
 
     //
     // -- Gate 4 is used for (#Qr * /BO)
     //    ------------------------------
     // pin 11 is the output (#Qr * /BO)
-    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, and2, &IC_74xx08_t::ProcessUpdateA4);        // pin 12: #Qr Input
-    connect(bits, &IC_74xx193_t::SignalBoUpdated, and2, &IC_74xx08_t::ProcessUpdateB4);             // pin 13: /BO Input
+    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, and2, &IC_74xx08_t::ProcessUpdateA4, CNN_TYPE);        // pin 12: #Qr Input
+    connect(bits, &IC_74xx193_t::SignalBoUpdated, and2, &IC_74xx08_t::ProcessUpdateB4, CNN_TYPE);             // pin 13: /BO Input
 
 
 
@@ -382,16 +382,16 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //
     // -- Gate 1 is used for (((Qc * CLK) * Qs) * #Qr)
     //    --------------------------------------------
-    connect(and1, &IC_74xx08_t::SignalY2Updated, and3, &IC_74xx08_t::ProcessUpdateA1);              // pin 1:
-    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, and3, &IC_74xx08_t::ProcessUpdateB1);        // pin 2:
+    connect(and1, &IC_74xx08_t::SignalY2Updated, and3, &IC_74xx08_t::ProcessUpdateA1, CNN_TYPE);              // pin 1:
+    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, and3, &IC_74xx08_t::ProcessUpdateB1, CNN_TYPE);        // pin 2:
     // pin 3 is the output (((Qc * CLK) * Qs) * #Qr)
 
 
     //
     // -- Gate 2 is (Qs * Qc)
     //    -------------------
-    connect(nand1, &IC_74xx00_t::SignalY4Updated, and3, &IC_74xx08_t::ProcessUpdateA2);             // pin 4
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, and3, &IC_74xx08_t::ProcessUpdateB2);             // pin 5
+    connect(nand1, &IC_74xx00_t::SignalY4Updated, and3, &IC_74xx08_t::ProcessUpdateA2, CNN_TYPE);             // pin 4
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, and3, &IC_74xx08_t::ProcessUpdateB2, CNN_TYPE);             // pin 5
     // pin 6 is (Qs * Qc)
 
 
@@ -419,16 +419,16 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //
     // -- Gate 1 is (Ba + Bb)
     //    -------------------
-    connect(bits, &IC_74xx193_t::SignalQaUpdated, or1, &IC_74xx32_t::ProcessUpdateA1);              // pin 1: Ba
-    connect(bits, &IC_74xx193_t::SignalQbUpdated, or1, &IC_74xx32_t::ProcessUpdateB1);              // pin 2: Bb
+    connect(bits, &IC_74xx193_t::SignalQaUpdated, or1, &IC_74xx32_t::ProcessUpdateA1, CNN_TYPE);              // pin 1: Ba
+    connect(bits, &IC_74xx193_t::SignalQbUpdated, or1, &IC_74xx32_t::ProcessUpdateB1, CNN_TYPE);              // pin 2: Bb
     // pin 3 is the (Ba + Bb) output
 
 
     //
     // -- Gate 2 is (Bc + Bd)
     //    -------------------
-    connect(bits, &IC_74xx193_t::SignalQcUpdated, or1, &IC_74xx32_t::ProcessUpdateA2);              // pin 4: Bc
-    connect(bits, &IC_74xx193_t::SignalQdUpdated, or1, &IC_74xx32_t::ProcessUpdateB2);              // pin 5: Bd
+    connect(bits, &IC_74xx193_t::SignalQcUpdated, or1, &IC_74xx32_t::ProcessUpdateA2, CNN_TYPE);              // pin 4: Bc
+    connect(bits, &IC_74xx193_t::SignalQdUpdated, or1, &IC_74xx32_t::ProcessUpdateB2, CNN_TYPE);              // pin 5: Bd
     // pin 6 is the (Bc + Bd) output
 
 
@@ -436,16 +436,16 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // -- Gate 3 is ((Ba + Bb) + (Bc + Bd))
     //    ---------------------------------
     // pin 8 is the ((Ba + Bb) + (Bc + Bd)) output
-    connect(or1, &IC_74xx32_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateA3);                // pin 9: (Ba + Bb)
-    connect(or1, &IC_74xx32_t::SignalY2Updated, or1, &IC_74xx32_t::ProcessUpdateB3);                // pin 10: (Bc + Bd)
+    connect(or1, &IC_74xx32_t::SignalY1Updated, or1, &IC_74xx32_t::ProcessUpdateA3, CNN_TYPE);                // pin 9: (Ba + Bb)
+    connect(or1, &IC_74xx32_t::SignalY2Updated, or1, &IC_74xx32_t::ProcessUpdateB3, CNN_TYPE);                // pin 10: (Bc + Bd)
 
 
     //
     // -- Gate 4 is (Qr + #Qc)
     //    --------------------
     // pin 11 is (Qr + #Qc)
-    connect(nand1, &IC_74xx00_t::SignalY2Updated, or1, &IC_74xx32_t::ProcessUpdateA4);              // pin 12: #Qc Input
-    connect(resetting, &IC_74xx74_t::SignalQ1Updated, or1, &IC_74xx32_t::ProcessUpdateB4);          // pin 13: Qr Input
+    connect(nand1, &IC_74xx00_t::SignalY2Updated, or1, &IC_74xx32_t::ProcessUpdateA4, CNN_TYPE);              // pin 12: #Qc Input
+    connect(resetting, &IC_74xx74_t::SignalQ1Updated, or1, &IC_74xx32_t::ProcessUpdateB4, CNN_TYPE);          // pin 13: Qr Input
 
 
 
@@ -456,8 +456,8 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //
     // -- Gate 1 is (#Qc * #Qc)
     //    ---------------------
-    connect(resetting, &IC_74xx74_t::SignalQ2Updated, oNand1, &IC_74xx03_t::ProcessUpdateA1);          // pin 1: #Done Input
-    connect(resetting, &IC_74xx74_t::SignalQ2Updated, oNand1, &IC_74xx03_t::ProcessUpdateB1);          // pin 2: #Done Input
+    connect(resetting, &IC_74xx74_t::SignalQ2Updated, oNand1, &IC_74xx03_t::ProcessUpdateA1, CNN_TYPE);          // pin 1: #Done Input
+    connect(resetting, &IC_74xx74_t::SignalQ2Updated, oNand1, &IC_74xx03_t::ProcessUpdateB1, CNN_TYPE);          // pin 2: #Done Input
     // pin 3 is the output (#Qc + #Qc)
 
 
@@ -500,14 +500,14 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //
     // -- Gate 2 is #Bb
     //    -------------
-    connect(bits, &IC_74xx193_t::SignalQbUpdated, inv1, &IC_74xx04_t::ProcessUpdateA2);             // pin 3: Bb
+    connect(bits, &IC_74xx193_t::SignalQbUpdated, inv1, &IC_74xx04_t::ProcessUpdateA2, CNN_TYPE);             // pin 3: Bb
     // pin 4 is #Bb output
 
 
     //
     // -- Gate 3 is #Bc
     //    -------------
-    connect(bits, &IC_74xx193_t::SignalQcUpdated, inv1, &IC_74xx04_t::ProcessUpdateA3);             // pin 5: Bb
+    connect(bits, &IC_74xx193_t::SignalQcUpdated, inv1, &IC_74xx04_t::ProcessUpdateA3, CNN_TYPE);             // pin 5: Bb
     // pin 6 is #Bb output
 
 
@@ -515,21 +515,21 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // -- Gate 4 is #Bd
     //    -------------
     // pin 8 is #Bd
-    connect(bits, &IC_74xx193_t::SignalQdUpdated, inv1, &IC_74xx04_t::ProcessUpdateA4);             // pin 9: Bb
+    connect(bits, &IC_74xx193_t::SignalQdUpdated, inv1, &IC_74xx04_t::ProcessUpdateA4, CNN_TYPE);             // pin 9: Bb
 
 
     //
     // -- Gate 5 is #(Bd * #Bc * #Bb * Ba)
     //    --------------------------------
     // pin 10 is #(Bd * #Bc * #Bb * Ba)
-    connect(and2, &IC_74xx08_t::SignalY3Updated, inv1, &IC_74xx04_t::ProcessUpdateA5);              // pin 11: (Bd * #Bc * #Bb * Ba)
+    connect(and2, &IC_74xx08_t::SignalY3Updated, inv1, &IC_74xx04_t::ProcessUpdateA5, CNN_TYPE);              // pin 11: (Bd * #Bc * #Bb * Ba)
 
 
     //
     // -- Gate 6 is #(#CLK * #Bd * #Bc * #Bb * Ba)
     //    ----------------------------------------
     // pin 12 is #(#CLK * #Bd * #Bc * #Bb * Ba)
-    connect(and2, &IC_74xx08_t::SignalY2Updated, inv1, &IC_74xx04_t::ProcessUpdateA6);              // pin 13: (#CLK * #Bd * #Bc * #Bb * Ba)
+    connect(and2, &IC_74xx08_t::SignalY2Updated, inv1, &IC_74xx04_t::ProcessUpdateA6, CNN_TYPE);              // pin 13: (#CLK * #Bd * #Bc * #Bb * Ba)
 
 
 
@@ -538,38 +538,38 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //    -----------------------------------------------
     HW_Bus_16_t *instrBus = HW_Computer_t::Get()->GetInstrBus();
 
-    connect(resetting, &IC_74xx74_t::SignalQ2Updated, mux0, &IC_74xx157_t::ProcessUpdateAB);        // pin 1: #Done
-    connect(instrBus, &HW_Bus_16_t::SignalBit0Updated, mux0, &IC_74xx157_t::ProcessUpdateA1);       // pin 2: Input A1: bit 0
-    connect(addr0, &IC_74xx193_t::SignalQaUpdated, mux0, &IC_74xx157_t::ProcessUpdateB1);           // pin 3: Input B1: bit 0
+    connect(resetting, &IC_74xx74_t::SignalQ2Updated, mux0, &IC_74xx157_t::ProcessUpdateAB, CNN_TYPE);        // pin 1: #Done
+    connect(instrBus, &HW_Bus_16_t::SignalBit0Updated, mux0, &IC_74xx157_t::ProcessUpdateA1, CNN_TYPE);       // pin 2: Input A1: bit 0
+    connect(addr0, &IC_74xx193_t::SignalQaUpdated, mux0, &IC_74xx157_t::ProcessUpdateB1, CNN_TYPE);           // pin 3: Input B1: bit 0
     // pin 4: Output Y1
-    connect(instrBus, &HW_Bus_16_t::SignalBit1Updated, mux0, &IC_74xx157_t::ProcessUpdateA2);       // pin 5: Input A2: bit 1
-    connect(addr0, &IC_74xx193_t::SignalQbUpdated, mux0, &IC_74xx157_t::ProcessUpdateB2);           // pin 6: Input B2: bit 1
+    connect(instrBus, &HW_Bus_16_t::SignalBit1Updated, mux0, &IC_74xx157_t::ProcessUpdateA2, CNN_TYPE);       // pin 5: Input A2: bit 1
+    connect(addr0, &IC_74xx193_t::SignalQbUpdated, mux0, &IC_74xx157_t::ProcessUpdateB2, CNN_TYPE);           // pin 6: Input B2: bit 1
     // pin 6: Output Y2
     // pin 9: Output Y3
-    connect(addr0, &IC_74xx193_t::SignalQcUpdated, mux0, &IC_74xx157_t::ProcessUpdateB3);           // pin 10: Input B3: bit 2
-    connect(instrBus, &HW_Bus_16_t::SignalBit2Updated, mux0, &IC_74xx157_t::ProcessUpdateA3);       // pin 11: Input A3: bit 2
+    connect(addr0, &IC_74xx193_t::SignalQcUpdated, mux0, &IC_74xx157_t::ProcessUpdateB3, CNN_TYPE);           // pin 10: Input B3: bit 2
+    connect(instrBus, &HW_Bus_16_t::SignalBit2Updated, mux0, &IC_74xx157_t::ProcessUpdateA3, CNN_TYPE);       // pin 11: Input A3: bit 2
     // pin 12: Output Y4
-    connect(addr0, &IC_74xx193_t::SignalQdUpdated, mux0, &IC_74xx157_t::ProcessUpdateB4);           // pin 13: Input B4: bit 3
-    connect(instrBus, &HW_Bus_16_t::SignalBit3Updated, mux0, &IC_74xx157_t::ProcessUpdateA4);       // pin 14: Input A4: bit 3
+    connect(addr0, &IC_74xx193_t::SignalQdUpdated, mux0, &IC_74xx157_t::ProcessUpdateB4, CNN_TYPE);           // pin 13: Input B4: bit 3
+    connect(instrBus, &HW_Bus_16_t::SignalBit3Updated, mux0, &IC_74xx157_t::ProcessUpdateA4, CNN_TYPE);       // pin 14: Input A4: bit 3
     mux0->ProcessUpdateGb(LOW);                                                                     // pin 15: Input /G
 
 
     //
     // -- Connect up MUX4 -- the next least significant nibble
     //    ----------------------------------------------------
-    connect(resetting, &IC_74xx74_t::SignalQ2Updated, mux4, &IC_74xx157_t::ProcessUpdateAB);        // pin 1: #Done
-    connect(instrBus, &HW_Bus_16_t::SignalBit4Updated, mux4, &IC_74xx157_t::ProcessUpdateA1);       // pin 2: Input A1: bit 4
-    connect(addr4, &IC_74xx193_t::SignalQaUpdated, mux4, &IC_74xx157_t::ProcessUpdateB1);           // pin 3: Input B1: bit 4
+    connect(resetting, &IC_74xx74_t::SignalQ2Updated, mux4, &IC_74xx157_t::ProcessUpdateAB, CNN_TYPE);        // pin 1: #Done
+    connect(instrBus, &HW_Bus_16_t::SignalBit4Updated, mux4, &IC_74xx157_t::ProcessUpdateA1, CNN_TYPE);       // pin 2: Input A1: bit 4
+    connect(addr4, &IC_74xx193_t::SignalQaUpdated, mux4, &IC_74xx157_t::ProcessUpdateB1, CNN_TYPE);           // pin 3: Input B1: bit 4
     // pin 4: Output Y1
-    connect(instrBus, &HW_Bus_16_t::SignalBit5Updated, mux4, &IC_74xx157_t::ProcessUpdateA2);       // pin 5: Input A2: bit 5
-    connect(addr4, &IC_74xx193_t::SignalQbUpdated, mux4, &IC_74xx157_t::ProcessUpdateB2);           // pin 6: Input B2: bit 5
+    connect(instrBus, &HW_Bus_16_t::SignalBit5Updated, mux4, &IC_74xx157_t::ProcessUpdateA2, CNN_TYPE);       // pin 5: Input A2: bit 5
+    connect(addr4, &IC_74xx193_t::SignalQbUpdated, mux4, &IC_74xx157_t::ProcessUpdateB2, CNN_TYPE);           // pin 6: Input B2: bit 5
     // pin 6: Output Y2
     // pin 9: Output Y3
-    connect(addr4, &IC_74xx193_t::SignalQcUpdated, mux4, &IC_74xx157_t::ProcessUpdateB3);           // pin 10: Input B3: bit 6
-    connect(instrBus, &HW_Bus_16_t::SignalBit6Updated, mux4, &IC_74xx157_t::ProcessUpdateA3);       // pin 11: Input A3: bit 6
+    connect(addr4, &IC_74xx193_t::SignalQcUpdated, mux4, &IC_74xx157_t::ProcessUpdateB3, CNN_TYPE);           // pin 10: Input B3: bit 6
+    connect(instrBus, &HW_Bus_16_t::SignalBit6Updated, mux4, &IC_74xx157_t::ProcessUpdateA3, CNN_TYPE);       // pin 11: Input A3: bit 6
     // pin 12: Output Y4
-    connect(addr4, &IC_74xx193_t::SignalQdUpdated, mux4, &IC_74xx157_t::ProcessUpdateB4);           // pin 13: Input B4: bit 7
-    connect(instrBus, &HW_Bus_16_t::SignalBit7Updated, mux4, &IC_74xx157_t::ProcessUpdateA4);       // pin 14: Input A4: bit 7
+    connect(addr4, &IC_74xx193_t::SignalQdUpdated, mux4, &IC_74xx157_t::ProcessUpdateB4, CNN_TYPE);           // pin 13: Input B4: bit 7
+    connect(instrBus, &HW_Bus_16_t::SignalBit7Updated, mux4, &IC_74xx157_t::ProcessUpdateA4, CNN_TYPE);       // pin 14: Input A4: bit 7
     mux4->ProcessUpdateGb(LOW);                                                                     // pin 15: Input /G
 
 
@@ -577,19 +577,19 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //
     // -- Connect up MUX8 -- the next most significant nibble
     //    ---------------------------------------------------
-    connect(resetting, &IC_74xx74_t::SignalQ2Updated, mux8, &IC_74xx157_t::ProcessUpdateAB);        // pin 1: #Done
-    connect(instrBus, &HW_Bus_16_t::SignalBit8Updated, mux8, &IC_74xx157_t::ProcessUpdateA1);       // pin 2: Input A1: bit 8
-    connect(addr8, &IC_74xx193_t::SignalQaUpdated, mux8, &IC_74xx157_t::ProcessUpdateB1);           // pin 3: Input B1: bit 8
+    connect(resetting, &IC_74xx74_t::SignalQ2Updated, mux8, &IC_74xx157_t::ProcessUpdateAB, CNN_TYPE);        // pin 1: #Done
+    connect(instrBus, &HW_Bus_16_t::SignalBit8Updated, mux8, &IC_74xx157_t::ProcessUpdateA1, CNN_TYPE);       // pin 2: Input A1: bit 8
+    connect(addr8, &IC_74xx193_t::SignalQaUpdated, mux8, &IC_74xx157_t::ProcessUpdateB1, CNN_TYPE);           // pin 3: Input B1: bit 8
     // pin 4: Output Y1
-    connect(instrBus, &HW_Bus_16_t::SignalBit9Updated, mux8, &IC_74xx157_t::ProcessUpdateA2);       // pin 5: Input A2: bit 9
-    connect(addr8, &IC_74xx193_t::SignalQbUpdated, mux8, &IC_74xx157_t::ProcessUpdateB2);           // pin 6: Input B2: bit 9
+    connect(instrBus, &HW_Bus_16_t::SignalBit9Updated, mux8, &IC_74xx157_t::ProcessUpdateA2, CNN_TYPE);       // pin 5: Input A2: bit 9
+    connect(addr8, &IC_74xx193_t::SignalQbUpdated, mux8, &IC_74xx157_t::ProcessUpdateB2, CNN_TYPE);           // pin 6: Input B2: bit 9
     // pin 6: Output Y2
     // pin 9: Output Y3
-    connect(addr8, &IC_74xx193_t::SignalQcUpdated, mux8, &IC_74xx157_t::ProcessUpdateB3);           // pin 10: Input B3: bit 10
-    connect(instrBus, &HW_Bus_16_t::SignalBitAUpdated, mux8, &IC_74xx157_t::ProcessUpdateA3);       // pin 11: Input A3: bit 10
+    connect(addr8, &IC_74xx193_t::SignalQcUpdated, mux8, &IC_74xx157_t::ProcessUpdateB3, CNN_TYPE);           // pin 10: Input B3: bit 10
+    connect(instrBus, &HW_Bus_16_t::SignalBitAUpdated, mux8, &IC_74xx157_t::ProcessUpdateA3, CNN_TYPE);       // pin 11: Input A3: bit 10
     // pin 12: Output Y4
-    connect(addr8, &IC_74xx193_t::SignalQdUpdated, mux8, &IC_74xx157_t::ProcessUpdateB4);           // pin 13: Input B4: bit 11
-    connect(instrBus, &HW_Bus_16_t::SignalBitBUpdated, mux8, &IC_74xx157_t::ProcessUpdateA4);       // pin 14: Input A4: bit 11
+    connect(addr8, &IC_74xx193_t::SignalQdUpdated, mux8, &IC_74xx157_t::ProcessUpdateB4, CNN_TYPE);           // pin 13: Input B4: bit 11
+    connect(instrBus, &HW_Bus_16_t::SignalBitBUpdated, mux8, &IC_74xx157_t::ProcessUpdateA4, CNN_TYPE);       // pin 14: Input A4: bit 11
     mux8->ProcessUpdateGb(LOW);                                                                     // pin 15: Input /G
 
 
@@ -597,18 +597,18 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //
     // -- Connect up MUXc -- the most significant nibble
     //    ----------------------------------------------
-    connect(resetting, &IC_74xx74_t::SignalQ2Updated, muxC, &IC_74xx157_t::ProcessUpdateAB);        // pin 1: #Done
-    connect(instrBus, &HW_Bus_16_t::SignalBitCUpdated, muxC, &IC_74xx157_t::ProcessUpdateA1);       // pin 2: Input A1: bit 12
-    connect(addrC, &IC_74xx193_t::SignalQaUpdated, muxC, &IC_74xx157_t::ProcessUpdateB1);           // pin 3: Input B1: bit 12
+    connect(resetting, &IC_74xx74_t::SignalQ2Updated, muxC, &IC_74xx157_t::ProcessUpdateAB, CNN_TYPE);        // pin 1: #Done
+    connect(instrBus, &HW_Bus_16_t::SignalBitCUpdated, muxC, &IC_74xx157_t::ProcessUpdateA1, CNN_TYPE);       // pin 2: Input A1: bit 12
+    connect(addrC, &IC_74xx193_t::SignalQaUpdated, muxC, &IC_74xx157_t::ProcessUpdateB1, CNN_TYPE);           // pin 3: Input B1: bit 12
     // pin 4: Output Y1
-    connect(instrBus, &HW_Bus_16_t::SignalBitDUpdated, muxC, &IC_74xx157_t::ProcessUpdateA2);       // pin 5: Input A2: bit 13
-    connect(addrC, &IC_74xx193_t::SignalQbUpdated, muxC, &IC_74xx157_t::ProcessUpdateB2);           // pin 6: Input B2: bit 13
+    connect(instrBus, &HW_Bus_16_t::SignalBitDUpdated, muxC, &IC_74xx157_t::ProcessUpdateA2, CNN_TYPE);       // pin 5: Input A2: bit 13
+    connect(addrC, &IC_74xx193_t::SignalQbUpdated, muxC, &IC_74xx157_t::ProcessUpdateB2, CNN_TYPE);           // pin 6: Input B2: bit 13
     // pin 6: Output Y2
     // pin 9: Output Y3
-    connect(addrC, &IC_74xx193_t::SignalQcUpdated, muxC, &IC_74xx157_t::ProcessUpdateB3);           // pin 10: Input B3: bit 14
-    connect(instrBus, &HW_Bus_16_t::SignalBitEUpdated, muxC, &IC_74xx157_t::ProcessUpdateA3);       // pin 11: Input A3: bit 14
+    connect(addrC, &IC_74xx193_t::SignalQcUpdated, muxC, &IC_74xx157_t::ProcessUpdateB3, CNN_TYPE);           // pin 10: Input B3: bit 14
+    connect(instrBus, &HW_Bus_16_t::SignalBitEUpdated, muxC, &IC_74xx157_t::ProcessUpdateA3, CNN_TYPE);       // pin 11: Input A3: bit 14
     // pin 12: Output Y4
-    connect(addrC, &IC_74xx193_t::SignalQdUpdated, muxC, &IC_74xx157_t::ProcessUpdateB4);           // pin 13: Input B4: bit 15
+    connect(addrC, &IC_74xx193_t::SignalQdUpdated, muxC, &IC_74xx157_t::ProcessUpdateB4, CNN_TYPE);           // pin 13: Input B4: bit 15
     muxC->ProcessUpdateA4(LOW);                                                                     // pin 14: Input A4: bit 15
     muxC->ProcessUpdateGb(LOW);                                                                     // pin 15: Input /G
 
@@ -626,10 +626,10 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // bit 7: output Bd
     bits->ProcessUpdateD(HIGH);                                                                     // pin 9: Input D
     bits->ProcessUpdateC(LOW);                                                                      // pin 10: Input C
-    connect(and2, &IC_74xx08_t::SignalY4Updated, bits, &IC_74xx193_t::ProcessUpdateLoad);           // pin 11: Load (#Qr * /BO)
+    connect(and2, &IC_74xx08_t::SignalY4Updated, bits, &IC_74xx193_t::ProcessUpdateLoad, CNN_TYPE);           // pin 11: Load (#Qr * /BO)
     // bit 12: /CO Output
     // bit 13: /BO Output
-    connect(nand1, &IC_74xx00_t::SignalY2Updated, bits, &IC_74xx193_t::ProcessUpdateClr);           // pin 14: CLR
+    connect(nand1, &IC_74xx00_t::SignalY2Updated, bits, &IC_74xx193_t::ProcessUpdateClr, CNN_TYPE);           // pin 14: CLR
     bits->ProcessUpdateA(HIGH);                                                                     // pin 15: Input A
 
 
@@ -641,12 +641,12 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // bit 2: output Addr0 Qb
     // bit 3: output Addr0 Qa
     addr0->ProcessUpdateDown(HIGH);                                                                 // pin 4: Down count clock (tied high)
-    connect(nand1, &IC_74xx00_t::SignalY4Updated, addr0, &IC_74xx193_t::ProcessUpdateUp);           // pin 5: Up Count clock
+    connect(nand1, &IC_74xx00_t::SignalY4Updated, addr0, &IC_74xx193_t::ProcessUpdateUp, CNN_TYPE);           // pin 5: Up Count clock
     // bit 6: output Addr0 Qc
     // bit 7: output Addr0 Qd
     addr0->ProcessUpdateD(HIGH);                                                                    // pin 9: Input D
     addr0->ProcessUpdateC(HIGH);                                                                    // pin 10: Input C
-    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, addr0, &IC_74xx193_t::ProcessUpdateLoad);    // pin 11: Load (#Qr * /BO)
+    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, addr0, &IC_74xx193_t::ProcessUpdateLoad, CNN_TYPE);    // pin 11: Load (#Qr * /BO)
     // bit 12: /CO Output
     // bit 13: /BO Output
     addr0->ProcessUpdateClr(LOW);                                                                   // pin 14: CLR (never clear, only load)
@@ -660,13 +660,13 @@ void CtrlRomCtrlModule_t::WireUp(void)
     addr4->ProcessUpdateB(HIGH);                                                                    // pin 1: Input B
     // bit 2: output Addr4 Qb
     // bit 3: output Addr4 Qa
-    connect(addr0, &IC_74xx193_t::SignalBoUpdated, addr4, &IC_74xx193_t::ProcessUpdateUp);          // pin 5: Down Count clock
-    connect(addr0, &IC_74xx193_t::SignalCoUpdated, addr4, &IC_74xx193_t::ProcessUpdateUp);          // pin 5: Up Count clock
+    connect(addr0, &IC_74xx193_t::SignalBoUpdated, addr4, &IC_74xx193_t::ProcessUpdateUp, CNN_TYPE);          // pin 5: Down Count clock
+    connect(addr0, &IC_74xx193_t::SignalCoUpdated, addr4, &IC_74xx193_t::ProcessUpdateUp, CNN_TYPE);          // pin 5: Up Count clock
     // bit 6: output Addr4 Qc
     // bit 7: output Addr4 Qd
     addr4->ProcessUpdateD(HIGH);                                                                    // pin 9: Input D
     addr4->ProcessUpdateC(HIGH);                                                                    // pin 10: Input C
-    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, addr4, &IC_74xx193_t::ProcessUpdateLoad);    // pin 11: Load (#Qr * /BO)
+    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, addr4, &IC_74xx193_t::ProcessUpdateLoad, CNN_TYPE);    // pin 11: Load (#Qr * /BO)
     // bit 12: /CO Output
     // bit 13: /BO Output
     addr4->ProcessUpdateClr(LOW);                                                                   // pin 14: CLR (never clear, only load)
@@ -680,13 +680,13 @@ void CtrlRomCtrlModule_t::WireUp(void)
     addr8->ProcessUpdateB(HIGH);                                                                    // pin 1: Input B
     // bit 2: output Addr8 Qb
     // bit 3: output Addr8 Qa
-    connect(addr4, &IC_74xx193_t::SignalBoUpdated, addr8, &IC_74xx193_t::ProcessUpdateUp);          // pin 5: Down Count clock
-    connect(addr4, &IC_74xx193_t::SignalCoUpdated, addr8, &IC_74xx193_t::ProcessUpdateUp);          // pin 5: Up Count clock
+    connect(addr4, &IC_74xx193_t::SignalBoUpdated, addr8, &IC_74xx193_t::ProcessUpdateUp, CNN_TYPE);          // pin 5: Down Count clock
+    connect(addr4, &IC_74xx193_t::SignalCoUpdated, addr8, &IC_74xx193_t::ProcessUpdateUp, CNN_TYPE);          // pin 5: Up Count clock
     // bit 6: output Addr8 Qc
     // bit 7: output Addr8 Qd
     addr8->ProcessUpdateD(HIGH);                                                                    // pin 9: Input D
     addr8->ProcessUpdateC(HIGH);                                                                    // pin 10: Input C
-    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, addr8, &IC_74xx193_t::ProcessUpdateLoad);    // pin 11: Load (#Qr * /BO)
+    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, addr8, &IC_74xx193_t::ProcessUpdateLoad, CNN_TYPE);    // pin 11: Load (#Qr * /BO)
     // bit 12: /CO Output
     // bit 13: /BO Output
     addr8->ProcessUpdateClr(LOW);                                                                   // pin 14: CLR (never clear, only load)
@@ -700,13 +700,13 @@ void CtrlRomCtrlModule_t::WireUp(void)
     addrC->ProcessUpdateB(HIGH);                                                                    // pin 1: Input B
     // bit 2: output AddrC Qb
     // bit 3: output AddrC Qa
-    connect(addr8, &IC_74xx193_t::SignalBoUpdated, addrC, &IC_74xx193_t::ProcessUpdateUp);          // pin 5: Down Count clock
-    connect(addr8, &IC_74xx193_t::SignalCoUpdated, addrC, &IC_74xx193_t::ProcessUpdateUp);          // pin 5: Up Count clock
+    connect(addr8, &IC_74xx193_t::SignalBoUpdated, addrC, &IC_74xx193_t::ProcessUpdateUp, CNN_TYPE);          // pin 5: Down Count clock
+    connect(addr8, &IC_74xx193_t::SignalCoUpdated, addrC, &IC_74xx193_t::ProcessUpdateUp, CNN_TYPE);          // pin 5: Up Count clock
     // bit 6: output AddrC Qc
     // bit 7: output AddrC Qd
     addrC->ProcessUpdateD(LOW);                                                                     // pin 9: Input D
     addrC->ProcessUpdateC(HIGH);                                                                    // pin 10: Input C
-    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, addrC, &IC_74xx193_t::ProcessUpdateLoad);    // pin 11: Load (#Qr * /BO)
+    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, addrC, &IC_74xx193_t::ProcessUpdateLoad, CNN_TYPE);    // pin 11: Load (#Qr * /BO)
     // bit 12: /CO Output
     // bit 13: /BO Output
     addrC->ProcessUpdateClr(LOW);                                                                   // pin 14: CLR (never clear, only load)
@@ -717,8 +717,8 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //
     // -- Wire up the command/address shifter
     //    -----------------------------------
-    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, shift, &IC_74xx165_t::ProcessUpdateShLd);    // pin 1: SH or /LD selection
-    connect(and1, &IC_74xx08_t::SignalY2Updated, shift, &IC_74xx165_t::ProcessUpdateClk);           // pin 2: Clock (Qc * CLK * #Qs)
+    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, shift, &IC_74xx165_t::ProcessUpdateShLd, CNN_TYPE);    // pin 1: SH or /LD selection
+    connect(and1, &IC_74xx08_t::SignalY2Updated, shift, &IC_74xx165_t::ProcessUpdateClk, CNN_TYPE);           // pin 2: Clock (Qc * CLK * #Qs)
     shift->ProcessUpdateE(LOW);                                                                     // pin 3: bit E
     shift->ProcessUpdateF(LOW);                                                                     // pin 4: bit F
     shift->ProcessUpdateG(LOW);                                                                     // pin 5: bit G
@@ -738,15 +738,15 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //    ----------------
 //    connect(clock, &HW_Oscillator_t::SignalStateChanged, clk, &GUI_Led_t::ProcessStateChange);
 
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, cpy, &GUI_Led_t::ProcessStateChange);
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, oe, &GUI_Led_t::ProcessStateChange);
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, we, &GUI_Led_t::ProcessStateChange);
-    connect(and3, &IC_74xx08_t::SignalY2Updated, ce, &GUI_Led_t::ProcessStateChange);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, cpy, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, oe, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, we, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
+    connect(and3, &IC_74xx08_t::SignalY2Updated, ce, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
 
-    connect(bits, &IC_74xx193_t::SignalQaUpdated, bit0, &GUI_Led_t::ProcessStateChange);
-    connect(bits, &IC_74xx193_t::SignalQbUpdated, bit1, &GUI_Led_t::ProcessStateChange);
-    connect(bits, &IC_74xx193_t::SignalQcUpdated, bit2, &GUI_Led_t::ProcessStateChange);
-    connect(bits, &IC_74xx193_t::SignalQdUpdated, bit3, &GUI_Led_t::ProcessStateChange);
+    connect(bits, &IC_74xx193_t::SignalQaUpdated, bit0, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
+    connect(bits, &IC_74xx193_t::SignalQbUpdated, bit1, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
+    connect(bits, &IC_74xx193_t::SignalQcUpdated, bit2, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
+    connect(bits, &IC_74xx193_t::SignalQdUpdated, bit3, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
 
 
 
@@ -755,20 +755,20 @@ void CtrlRomCtrlModule_t::WireUp(void)
     //    ------------------------------------------------
     HW_Bus_1_t *cpyHld = HW_Computer_t::GetCpyHldBus();
     oNand1->setObjectName("CtrlCtrl:oNand1");
-    connect(oNand1, &IC_74xx03_t::SignalY1Updated, cpyHld, &HW_Bus_1_t::ProcessUpdateBit0);
-    connect(resetting, &IC_74xx74_t::SignalQ1Updated, this, &CtrlRomCtrlModule_t::SignalQrUpdated);
-    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, this, &CtrlRomCtrlModule_t::SignalQrbUpdated);
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, this, &CtrlRomCtrlModule_t::SignalQcUpdated);
-    connect(resetting, &IC_74xx74_t::SignalQ2bUpdated, this, &CtrlRomCtrlModule_t::SignalQcbUpdated);
-    connect(nand1, &IC_74xx00_t::SignalY2Updated, this, &CtrlRomCtrlModule_t::ProcessQcb);
-    connect(nand1, &IC_74xx00_t::SignalY4Updated, this, &CtrlRomCtrlModule_t::SignalQsUpdated);
-    connect(nand1, &IC_74xx00_t::SignalY3Updated, this, &CtrlRomCtrlModule_t::SignalQsbUpdated);
-    connect(and3, &IC_74xx08_t::SignalY1Updated, this, &CtrlRomCtrlModule_t::SignalShiftClockUpdated);
-    connect(or1, &IC_74xx32_t::SignalY4Updated, this, &CtrlRomCtrlModule_t::SignalEepromCsUpdated);
-    connect(shift, &IC_74xx165_t::SignalQHUpdated, this, &CtrlRomCtrlModule_t::SignalEepromCmdAddrUpdated);
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, this, &CtrlRomCtrlModule_t::SignalSramOeUpdated);
-    connect(nand2, &IC_74xx00_t::SignalY2Updated, this, &CtrlRomCtrlModule_t::SignalSramWeUpdated);
-    connect(and3, &IC_74xx08_t::SignalY2Updated, this, &CtrlRomCtrlModule_t::SignalSramCeUpdated);
+    connect(oNand1, &IC_74xx03_t::SignalY1Updated, cpyHld, &HW_Bus_1_t::ProcessUpdateBit0, CNN_TYPE);
+    connect(resetting, &IC_74xx74_t::SignalQ1Updated, this, &CtrlRomCtrlModule_t::SignalQrUpdated, CNN_TYPE);
+    connect(resetting, &IC_74xx74_t::SignalQ1bUpdated, this, &CtrlRomCtrlModule_t::SignalQrbUpdated, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, this, &CtrlRomCtrlModule_t::SignalQcUpdated, CNN_TYPE);
+    connect(resetting, &IC_74xx74_t::SignalQ2bUpdated, this, &CtrlRomCtrlModule_t::SignalQcbUpdated, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY2Updated, this, &CtrlRomCtrlModule_t::ProcessQcb, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY4Updated, this, &CtrlRomCtrlModule_t::SignalQsUpdated, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY3Updated, this, &CtrlRomCtrlModule_t::SignalQsbUpdated, CNN_TYPE);
+    connect(and3, &IC_74xx08_t::SignalY1Updated, this, &CtrlRomCtrlModule_t::SignalShiftClockUpdated, CNN_TYPE);
+    connect(or1, &IC_74xx32_t::SignalY4Updated, this, &CtrlRomCtrlModule_t::SignalEepromCsUpdated, CNN_TYPE);
+    connect(shift, &IC_74xx165_t::SignalQHUpdated, this, &CtrlRomCtrlModule_t::SignalEepromCmdAddrUpdated, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, this, &CtrlRomCtrlModule_t::SignalSramOeUpdated, CNN_TYPE);
+    connect(nand2, &IC_74xx00_t::SignalY2Updated, this, &CtrlRomCtrlModule_t::SignalSramWeUpdated, CNN_TYPE);
+    connect(and3, &IC_74xx08_t::SignalY2Updated, this, &CtrlRomCtrlModule_t::SignalSramCeUpdated, CNN_TYPE);
 
 
 
@@ -776,21 +776,21 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // -- Connect up the outputs: Ctrl Logic Bus
     //    --------------------------------------
     HW_Bus_16_t *ctrlBus = HW_Computer_t::Get()->GetCtrlMidPlane()->GetCtrlBus();
-    connect(mux0, &IC_74xx157_t::SignalY1Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit0);
-    connect(mux0, &IC_74xx157_t::SignalY2Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit1);
-    connect(mux0, &IC_74xx157_t::SignalY3Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit2);
-    connect(mux0, &IC_74xx157_t::SignalY4Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit3);
-    connect(mux4, &IC_74xx157_t::SignalY1Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit4);
-    connect(mux4, &IC_74xx157_t::SignalY2Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit5);
-    connect(mux4, &IC_74xx157_t::SignalY3Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit6);
-    connect(mux4, &IC_74xx157_t::SignalY4Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit7);
-    connect(mux8, &IC_74xx157_t::SignalY1Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit8);
-    connect(mux8, &IC_74xx157_t::SignalY2Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit9);
-    connect(mux8, &IC_74xx157_t::SignalY3Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBitA);
-    connect(mux8, &IC_74xx157_t::SignalY4Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBitB);
-    connect(muxC, &IC_74xx157_t::SignalY1Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBitC);
-    connect(muxC, &IC_74xx157_t::SignalY2Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBitD);
-    connect(muxC, &IC_74xx157_t::SignalY3Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBitE);
+    connect(mux0, &IC_74xx157_t::SignalY1Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit0, CNN_TYPE);
+    connect(mux0, &IC_74xx157_t::SignalY2Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit1, CNN_TYPE);
+    connect(mux0, &IC_74xx157_t::SignalY3Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit2, CNN_TYPE);
+    connect(mux0, &IC_74xx157_t::SignalY4Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit3, CNN_TYPE);
+    connect(mux4, &IC_74xx157_t::SignalY1Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit4, CNN_TYPE);
+    connect(mux4, &IC_74xx157_t::SignalY2Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit5, CNN_TYPE);
+    connect(mux4, &IC_74xx157_t::SignalY3Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit6, CNN_TYPE);
+    connect(mux4, &IC_74xx157_t::SignalY4Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit7, CNN_TYPE);
+    connect(mux8, &IC_74xx157_t::SignalY1Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit8, CNN_TYPE);
+    connect(mux8, &IC_74xx157_t::SignalY2Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBit9, CNN_TYPE);
+    connect(mux8, &IC_74xx157_t::SignalY3Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBitA, CNN_TYPE);
+    connect(mux8, &IC_74xx157_t::SignalY4Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBitB, CNN_TYPE);
+    connect(muxC, &IC_74xx157_t::SignalY1Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBitC, CNN_TYPE);
+    connect(muxC, &IC_74xx157_t::SignalY2Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBitD, CNN_TYPE);
+    connect(muxC, &IC_74xx157_t::SignalY3Updated, ctrlBus, &HW_Bus_16_t::ProcessUpdateBitE, CNN_TYPE);
     ctrlBus->SignalBitFUpdated(LOW);
 
 
@@ -799,44 +799,48 @@ void CtrlRomCtrlModule_t::WireUp(void)
     // -- Connect up the outputs: Address Copy Bus
     //    ----------------------------------------
     HW_Bus_16_t *addrCopyBus = HW_Computer_t::GetAddrCopyBus();
-    connect(addr0, &IC_74xx193_t::SignalQaUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit0);
-    connect(addr0, &IC_74xx193_t::SignalQbUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit1);
-    connect(addr0, &IC_74xx193_t::SignalQcUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit2);
-    connect(addr0, &IC_74xx193_t::SignalQdUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit3);
-    connect(addr4, &IC_74xx193_t::SignalQaUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit4);
-    connect(addr4, &IC_74xx193_t::SignalQbUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit5);
-    connect(addr4, &IC_74xx193_t::SignalQcUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit6);
-    connect(addr4, &IC_74xx193_t::SignalQdUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit7);
-    connect(addr8, &IC_74xx193_t::SignalQaUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit8);
-    connect(addr8, &IC_74xx193_t::SignalQbUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit9);
-    connect(addr8, &IC_74xx193_t::SignalQcUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBitA);
-    connect(addr8, &IC_74xx193_t::SignalQdUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBitB);
-    connect(addrC, &IC_74xx193_t::SignalQaUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBitC);
-    connect(addrC, &IC_74xx193_t::SignalQbUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBitD);
-    connect(addrC, &IC_74xx193_t::SignalQdUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBitE);
+    connect(addr0, &IC_74xx193_t::SignalQaUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit0, CNN_TYPE);
+    connect(addr0, &IC_74xx193_t::SignalQbUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit1, CNN_TYPE);
+    connect(addr0, &IC_74xx193_t::SignalQcUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit2, CNN_TYPE);
+    connect(addr0, &IC_74xx193_t::SignalQdUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit3, CNN_TYPE);
+    connect(addr4, &IC_74xx193_t::SignalQaUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit4, CNN_TYPE);
+    connect(addr4, &IC_74xx193_t::SignalQbUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit5, CNN_TYPE);
+    connect(addr4, &IC_74xx193_t::SignalQcUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit6, CNN_TYPE);
+    connect(addr4, &IC_74xx193_t::SignalQdUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit7, CNN_TYPE);
+    connect(addr8, &IC_74xx193_t::SignalQaUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit8, CNN_TYPE);
+    connect(addr8, &IC_74xx193_t::SignalQbUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBit9, CNN_TYPE);
+    connect(addr8, &IC_74xx193_t::SignalQcUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBitA, CNN_TYPE);
+    connect(addr8, &IC_74xx193_t::SignalQdUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBitB, CNN_TYPE);
+    connect(addrC, &IC_74xx193_t::SignalQaUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBitC, CNN_TYPE);
+    connect(addrC, &IC_74xx193_t::SignalQbUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBitD, CNN_TYPE);
+    connect(addrC, &IC_74xx193_t::SignalQdUpdated, addrCopyBus, &HW_Bus_16_t::ProcessUpdateBitE, CNN_TYPE);
     addrCopyBus->ProcessUpdateBitF(LOW);
 }
 
 
 
 //
-// -- Start the clock when reset hits
-//    -------------------------------
+// -- Start the clock when reset hits; on a fast boot the copy is done in one step instead
+//    ------------------------------------------------------------------------------------
 inline void CtrlRomCtrlModule_t::ProcessResetUpdate(TriState_t state)
 {
-#if defined(PEDANTIC_COPY) && (PEDANTIC_COPY == 1)
-    // -- This is still an active low signal!!!
+    if (!HW_Computer_t::IsFastBoot()) {
+        // -- This is still an active low signal!!!
 
-    nand1->ProcessUpdateA1(state);          // SR Set
-    nand2->ProcessUpdateA4(state);          // #Reset
-    nand2->ProcessUpdateB4(state);          // #Reset
-    resetting->ProcessUpdatePre1(state);    // set the D-Latch
-    resetting->ProcessUpdatePre2(state);    // set the D-Latch
+        nand1->ProcessUpdateA1(state);          // SR Set
+        nand2->ProcessUpdateA4(state);          // #Reset
+        nand2->ProcessUpdateB4(state);          // #Reset
+        resetting->ProcessUpdatePre1(state);    // set the D-Latch
+        resetting->ProcessUpdatePre2(state);    // set the D-Latch
 
-    if (state == HIGH) {
-//        clock->StartTimer();
+        if (state == HIGH) {
+//            clock->StartTimer();
+        }
+
+        return;
     }
-#else
+
+
     if (state != HIGH) {
         HW_Bus_1_t *cpyHld = HW_Computer_t::GetCpyHldBus();
         cpyHld->ProcessUpdateBit0(LOW);
@@ -858,9 +862,13 @@ inline void CtrlRomCtrlModule_t::ProcessResetUpdate(TriState_t state)
 
         // -- keep an eye on this: it may change at inopportune times
         emit nand1->SignalY1Updated(LOW);
-    }
 
-#endif
+        // -- leave the address counters where the last carry of a real copy leaves them
+        addr0->PresetCount(0xf);
+        addr4->PresetCount(0xf);
+        addr8->PresetCount(0xf);
+        addrC->PresetCount(0xf);
+    }
 }
 
 
@@ -19,57 +19,87 @@
 //    ----------------------------------------
 GpRegisterModule_t::GpRegisterModule_t(const QString name) : QGroupBox(name)
 {
+    behavioral = (HW_Computer_t::GetFidelity(name) == HW_Computer_t::BEHAVIORAL);
+
+    // -- these match the power-on state of the gate-level module: #RESET is low so the counters are cleared
+    value = latched = q = mainIn = 0;
+    clk = incIn = decIn = loadIn = resetIn = false;
+    up = down = true;
+    swapOut = mainOut = aluAOut = aluBOut = addr1Out = addr2Out = false;
+
+    HW_Snapshot_t::Get()->Register(this);
+
     setFixedWidth(190);
     setFixedHeight(120);
 
     AllocateComponents();
-    BuildGui();
+    if (!headless) BuildGui();
     WireUp();
     TriggerFirstUpdate();
 }
 
 
+//
+// -- Save or restore the behavioral state; at gate level the ICs hold the state and save their own
+//    ---------------------------------------------------------------------------------------------
+void GpRegisterModule_t::Snapshot(HW_Snapshot_t::Stream_t &s)
+{
+    bool wasBehavioral = behavioral;
+
+    s & behavioral;
+    if (behavioral != wasBehavioral) {
+        behavioral = wasBehavioral;
+        s.Fail();
+        return;
+    }
+
+    if (!behavioral) return;
+
+    s & value & latched & q & mainIn & clk & incIn & decIn & loadIn & resetIn & up & down;
+    s & swapOut & mainOut & aluAOut & aluBOut & addr1Out & addr2Out;
+}
+
+
 //
 // -- allocate all the components needed for this module
 //    --------------------------------------------------
 void GpRegisterModule_t::AllocateComponents(void)
 {
-    counter0 = new IC_74xx193_t;
-    counter1 = new IC_74xx193_t;
-    counter2 = new IC_74xx193_t;
-    counter3 = new IC_74xx193_t;
-    aluA0 = new IC_74xx574_t;
-    aluA1 = new IC_74xx574_t;
-    aluB0 = new IC_74xx574_t;
-    aluB1 = new IC_74xx574_t;
-    addr10 = new IC_74xx574_t;
-    addr11 = new IC_74xx574_t;
-    addr20 = new IC_74xx574_t;
-    addr21 = new IC_74xx574_t;
-    main0 = new IC_74xx574_t;
-    main1 = new IC_74xx574_t;
-    swap0 = new IC_74xx574_t;
-    swap1 = new IC_74xx574_t;
-    led0 = new IC_74xx574_t;
-    led1 = new IC_74xx574_t;
-    nand1 = new IC_74xx00_t;
-    inv1 = new IC_74xx04_t;
-    bit0 = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bit1 = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bit2 = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bit3 = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bit4 = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bit5 = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bit6 = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bit7 = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bit8 = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bit9 = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bitA = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bitB = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bitC = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bitD = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bitE = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
-    bitF = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::red);
+    // -- the ICs are only needed at gate level
+    if (!behavioral) {
+        counter0 = new IC_74xx193_t;
+        counter1 = new IC_74xx193_t;
+        counter2 = new IC_74xx193_t;
+        counter3 = new IC_74xx193_t;
+        aluA0 = new IC_74xx574_t;
+        aluA1 = new IC_74xx574_t;
+        aluB0 = new IC_74xx574_t;
+        aluB1 = new IC_74xx574_t;
+        addr10 = new IC_74xx574_t;
+        addr11 = new IC_74xx574_t;
+        addr20 = new IC_74xx574_t;
+        addr21 = new IC_74xx574_t;
+        main0 = new IC_74xx574_t;
+        main1 = new IC_74xx574_t;
+        swap0 = new IC_74xx574_t;
+        swap1 = new IC_74xx574_t;
+        led0 = new IC_74xx574_t;
+        led1 = new IC_74xx574_t;
+        nand1 = new IC_74xx00_t;
+        inv1 = new IC_74xx04_t;
+        swapDriver = nullptr;
+    } else {
+        counter0 = counter1 = counter2 = counter3 = nullptr;
+        aluA0 = aluA1 = aluB0 = aluB1 = nullptr;
+        addr10 = addr11 = addr20 = addr21 = nullptr;
+        main0 = main1 = swap0 = swap1 = nullptr;
+        led0 = led1 = nullptr;
+        nand1 = nullptr;
+        inv1 = nullptr;
+        swapDriver = new GpRegisterSwap_t(this);
+    }
+
+    bits = new GUI_LedBank_t(16, Qt::red);
     load = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::blue);
     inc = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::blue);
     dec = new GUI_Led_t(GUI_Led_t::OnWhenHigh, Qt::blue);
@@ -152,25 +182,7 @@ void GpRegisterModule_t::BuildGui(void)
     contentsLayout->setContentsMargins(0, 0, 0, 0);
     contentsLayout->setSpacing(1);
 
-    contentsLayout->addWidget(bitF, Qt::AlignHCenter);
-    contentsLayout->addWidget(bitE, Qt::AlignHCenter);
-    contentsLayout->addWidget(bitD, Qt::AlignHCenter);
-    contentsLayout->addWidget(bitC, Qt::AlignHCenter);
-    contentsLayout->addSpacerItem(new QSpacerItem(4, 10));
-    contentsLayout->addWidget(bitB, Qt::AlignHCenter);
-    contentsLayout->addWidget(bitA, Qt::AlignHCenter);
-    contentsLayout->addWidget(bit9, Qt::AlignHCenter);
-    contentsLayout->addWidget(bit8, Qt::AlignHCenter);
-    contentsLayout->addSpacerItem(new QSpacerItem(4, 10));
-    contentsLayout->addWidget(bit7, Qt::AlignHCenter);
-    contentsLayout->addWidget(bit6, Qt::AlignHCenter);
-    contentsLayout->addWidget(bit5, Qt::AlignHCenter);
-    contentsLayout->addWidget(bit4, Qt::AlignHCenter);
-    contentsLayout->addSpacerItem(new QSpacerItem(4, 10));
-    contentsLayout->addWidget(bit3, Qt::AlignHCenter);
-    contentsLayout->addWidget(bit2, Qt::AlignHCenter);
-    contentsLayout->addWidget(bit1, Qt::AlignHCenter);
-    contentsLayout->addWidget(bit0, Qt::AlignHCenter);
+    contentsLayout->addWidget(bits, 0, Qt::AlignHCenter);
 
     contents->setLayout(contentsLayout);
     layout->addWidget(contents);
@@ -182,6 +194,12 @@ void GpRegisterModule_t::BuildGui(void)
 //    --------------------------------------
 void GpRegisterModule_t::TriggerFirstUpdate(void)
 {
+    if (behavioral) {
+        UpdateCounter();
+        UpdateOutputs();
+        return;
+    }
+
     counter0->TriggerFirstUpdate();
     counter1->TriggerFirstUpdate();
     counter2->TriggerFirstUpdate();
@@ -211,6 +229,11 @@ void GpRegisterModule_t::TriggerFirstUpdate(void)
 //    ------------------------------------
 void GpRegisterModule_t::WireUp(void)
 {
+    if (behavioral) {
+        WireUpBehavioral();
+        return;
+    }
+
     // -- start with the inputs to the 74xx00 NAND gate
     //    A1 -- CLK
     //    B1 -- INC
@@ -233,247 +256,233 @@ void GpRegisterModule_t::WireUp(void)
 
     // -- 74xx193 counter 0
     //    B -- bit 1
-    connect(nand1, &IC_74xx00_t::SignalY2Updated, counter0, &IC_74xx193_t::ProcessUpdateDown);
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, counter0, &IC_74xx193_t::ProcessUpdateUp);
+    connect(nand1, &IC_74xx00_t::SignalY2Updated, counter0, &IC_74xx193_t::ProcessUpdateDown, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, counter0, &IC_74xx193_t::ProcessUpdateUp, CNN_TYPE);
     //    D -- bit 3
     //    C -- bit 2
-    connect(nand1, &IC_74xx00_t::SignalY3Updated, counter0, &IC_74xx193_t::ProcessUpdateLoad);
-    connect(nand1, &IC_74xx00_t::SignalY4Updated, counter0, &IC_74xx193_t::ProcessUpdateClr);
+    connect(nand1, &IC_74xx00_t::SignalY3Updated, counter0, &IC_74xx193_t::ProcessUpdateLoad, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY4Updated, counter0, &IC_74xx193_t::ProcessUpdateClr, CNN_TYPE);
     //    A -- bit 0
 
 
     // -- 74xx193 counter 1
     //    B -- bit 5
-    connect(counter0, &IC_74xx193_t::SignalBoUpdated, counter1, &IC_74xx193_t::ProcessUpdateDown);
-    connect(counter0, &IC_74xx193_t::SignalCoUpdated, counter1, &IC_74xx193_t::ProcessUpdateUp);
+    connect(counter0, &IC_74xx193_t::SignalBoUpdated, counter1, &IC_74xx193_t::ProcessUpdateDown, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalCoUpdated, counter1, &IC_74xx193_t::ProcessUpdateUp, CNN_TYPE);
     //    D -- bit 7
     //    C -- bit 6
-    connect(nand1, &IC_74xx00_t::SignalY3Updated, counter1, &IC_74xx193_t::ProcessUpdateLoad);
-    connect(nand1, &IC_74xx00_t::SignalY4Updated, counter1, &IC_74xx193_t::ProcessUpdateClr);
+    connect(nand1, &IC_74xx00_t::SignalY3Updated, counter1, &IC_74xx193_t::ProcessUpdateLoad, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY4Updated, counter1, &IC_74xx193_t::ProcessUpdateClr, CNN_TYPE);
     //    A -- bit 4
 
 
     // -- 74xx193 counter 2
     //    B -- bit 5
-    connect(counter1, &IC_74xx193_t::SignalBoUpdated, counter2, &IC_74xx193_t::ProcessUpdateDown);
-    connect(counter1, &IC_74xx193_t::SignalCoUpdated, counter2, &IC_74xx193_t::ProcessUpdateUp);
+    connect(counter1, &IC_74xx193_t::SignalBoUpdated, counter2, &IC_74xx193_t::ProcessUpdateDown, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalCoUpdated, counter2, &IC_74xx193_t::ProcessUpdateUp, CNN_TYPE);
     //    D -- bit 7
     //    C -- bit 6
-    connect(nand1, &IC_74xx00_t::SignalY3Updated, counter2, &IC_74xx193_t::ProcessUpdateLoad);
-    connect(nand1, &IC_74xx00_t::SignalY4Updated, counter2, &IC_74xx193_t::ProcessUpdateClr);
+    connect(nand1, &IC_74xx00_t::SignalY3Updated, counter2, &IC_74xx193_t::ProcessUpdateLoad, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY4Updated, counter2, &IC_74xx193_t::ProcessUpdateClr, CNN_TYPE);
     //    A -- bit 4
 
 
     // -- 74xx193 counter 3
     //    B -- bit 5
-    connect(counter2, &IC_74xx193_t::SignalBoUpdated, counter3, &IC_74xx193_t::ProcessUpdateDown);
-    connect(counter2, &IC_74xx193_t::SignalCoUpdated, counter3, &IC_74xx193_t::ProcessUpdateUp);
+    connect(counter2, &IC_74xx193_t::SignalBoUpdated, counter3, &IC_74xx193_t::ProcessUpdateDown, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalCoUpdated, counter3, &IC_74xx193_t::ProcessUpdateUp, CNN_TYPE);
     //    D -- bit 7
     //    C -- bit 6
-    connect(nand1, &IC_74xx00_t::SignalY3Updated, counter3, &IC_74xx193_t::ProcessUpdateLoad);
-    connect(nand1, &IC_74xx00_t::SignalY4Updated, counter3, &IC_74xx193_t::ProcessUpdateClr);
+    connect(nand1, &IC_74xx00_t::SignalY3Updated, counter3, &IC_74xx193_t::ProcessUpdateLoad, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY4Updated, counter3, &IC_74xx193_t::ProcessUpdateClr, CNN_TYPE);
     //    A -- bit 4
 
 
     // -- swap Bus MSB
-    connect(inv1, &IC_74xx04_t::SignalY1Updated, swap1, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter0, &IC_74xx193_t::SignalQaUpdated, swap1, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter0, &IC_74xx193_t::SignalQbUpdated, swap1, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter0, &IC_74xx193_t::SignalQcUpdated, swap1, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter0, &IC_74xx193_t::SignalQdUpdated, swap1, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter1, &IC_74xx193_t::SignalQaUpdated, swap1, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter1, &IC_74xx193_t::SignalQbUpdated, swap1, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter1, &IC_74xx193_t::SignalQcUpdated, swap1, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter1, &IC_74xx193_t::SignalQdUpdated, swap1, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY1Updated, swap1, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQaUpdated, swap1, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter0, &IC_74xx193_t::SignalQbUpdated, swap1, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQcUpdated, swap1, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQdUpdated, swap1, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQaUpdated, swap1, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQbUpdated, swap1, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQcUpdated, swap1, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQdUpdated, swap1, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- swap Bus LSB
-    connect(inv1, &IC_74xx04_t::SignalY1Updated, swap0, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter2, &IC_74xx193_t::SignalQaUpdated, swap0, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter2, &IC_74xx193_t::SignalQbUpdated, swap0, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter2, &IC_74xx193_t::SignalQcUpdated, swap0, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter2, &IC_74xx193_t::SignalQdUpdated, swap0, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter3, &IC_74xx193_t::SignalQaUpdated, swap0, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter3, &IC_74xx193_t::SignalQbUpdated, swap0, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter3, &IC_74xx193_t::SignalQcUpdated, swap0, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter3, &IC_74xx193_t::SignalQdUpdated, swap0, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY1Updated, swap0, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQaUpdated, swap0, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter2, &IC_74xx193_t::SignalQbUpdated, swap0, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQcUpdated, swap0, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQdUpdated, swap0, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQaUpdated, swap0, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQbUpdated, swap0, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQcUpdated, swap0, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQdUpdated, swap0, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- main Bus MSB
-    connect(inv1, &IC_74xx04_t::SignalY2Updated, main1, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter2, &IC_74xx193_t::SignalQaUpdated, main1, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter2, &IC_74xx193_t::SignalQbUpdated, main1, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter2, &IC_74xx193_t::SignalQcUpdated, main1, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter2, &IC_74xx193_t::SignalQdUpdated, main1, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter3, &IC_74xx193_t::SignalQaUpdated, main1, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter3, &IC_74xx193_t::SignalQbUpdated, main1, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter3, &IC_74xx193_t::SignalQcUpdated, main1, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter3, &IC_74xx193_t::SignalQdUpdated, main1, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY2Updated, main1, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQaUpdated, main1, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter2, &IC_74xx193_t::SignalQbUpdated, main1, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQcUpdated, main1, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQdUpdated, main1, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQaUpdated, main1, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQbUpdated, main1, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQcUpdated, main1, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQdUpdated, main1, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- main Bus LSB
-    connect(inv1, &IC_74xx04_t::SignalY2Updated, main0, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter0, &IC_74xx193_t::SignalQaUpdated, main0, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter0, &IC_74xx193_t::SignalQbUpdated, main0, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter0, &IC_74xx193_t::SignalQcUpdated, main0, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter0, &IC_74xx193_t::SignalQdUpdated, main0, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter1, &IC_74xx193_t::SignalQaUpdated, main0, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter1, &IC_74xx193_t::SignalQbUpdated, main0, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter1, &IC_74xx193_t::SignalQcUpdated, main0, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter1, &IC_74xx193_t::SignalQdUpdated, main0, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY2Updated, main0, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQaUpdated, main0, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter0, &IC_74xx193_t::SignalQbUpdated, main0, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQcUpdated, main0, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQdUpdated, main0, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQaUpdated, main0, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQbUpdated, main0, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQcUpdated, main0, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQdUpdated, main0, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- ALU A MSB
-    connect(inv1, &IC_74xx04_t::SignalY3Updated, aluA1, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter2, &IC_74xx193_t::SignalQaUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter2, &IC_74xx193_t::SignalQbUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter2, &IC_74xx193_t::SignalQcUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter2, &IC_74xx193_t::SignalQdUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter3, &IC_74xx193_t::SignalQaUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter3, &IC_74xx193_t::SignalQbUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter3, &IC_74xx193_t::SignalQcUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter3, &IC_74xx193_t::SignalQdUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY3Updated, aluA1, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQaUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter2, &IC_74xx193_t::SignalQbUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQcUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQdUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQaUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQbUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQcUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQdUpdated, aluA1, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- ALU A LSB
-    connect(inv1, &IC_74xx04_t::SignalY3Updated, aluA0, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter0, &IC_74xx193_t::SignalQaUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter0, &IC_74xx193_t::SignalQbUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter0, &IC_74xx193_t::SignalQcUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter0, &IC_74xx193_t::SignalQdUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter1, &IC_74xx193_t::SignalQaUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter1, &IC_74xx193_t::SignalQbUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter1, &IC_74xx193_t::SignalQcUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter1, &IC_74xx193_t::SignalQdUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY3Updated, aluA0, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQaUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter0, &IC_74xx193_t::SignalQbUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQcUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQdUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQaUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQbUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQcUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQdUpdated, aluA0, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- ALU B MSB
-    connect(inv1, &IC_74xx04_t::SignalY4Updated, aluB1, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter2, &IC_74xx193_t::SignalQaUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter2, &IC_74xx193_t::SignalQbUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter2, &IC_74xx193_t::SignalQcUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter2, &IC_74xx193_t::SignalQdUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter3, &IC_74xx193_t::SignalQaUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter3, &IC_74xx193_t::SignalQbUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter3, &IC_74xx193_t::SignalQcUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter3, &IC_74xx193_t::SignalQdUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY4Updated, aluB1, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQaUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter2, &IC_74xx193_t::SignalQbUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQcUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQdUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQaUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQbUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQcUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQdUpdated, aluB1, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- ALU B LSB
-    connect(inv1, &IC_74xx04_t::SignalY4Updated, aluB0, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter0, &IC_74xx193_t::SignalQaUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter0, &IC_74xx193_t::SignalQbUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter0, &IC_74xx193_t::SignalQcUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter0, &IC_74xx193_t::SignalQdUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter1, &IC_74xx193_t::SignalQaUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter1, &IC_74xx193_t::SignalQbUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter1, &IC_74xx193_t::SignalQcUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter1, &IC_74xx193_t::SignalQdUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY4Updated, aluB0, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQaUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter0, &IC_74xx193_t::SignalQbUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQcUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQdUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQaUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQbUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQcUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQdUpdated, aluB0, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- Addr1 MSB
-    connect(inv1, &IC_74xx04_t::SignalY5Updated, addr11, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter2, &IC_74xx193_t::SignalQaUpdated, addr11, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter2, &IC_74xx193_t::SignalQbUpdated, addr11, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter2, &IC_74xx193_t::SignalQcUpdated, addr11, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter2, &IC_74xx193_t::SignalQdUpdated, addr11, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter3, &IC_74xx193_t::SignalQaUpdated, addr11, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter3, &IC_74xx193_t::SignalQbUpdated, addr11, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter3, &IC_74xx193_t::SignalQcUpdated, addr11, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter3, &IC_74xx193_t::SignalQdUpdated, addr11, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY5Updated, addr11, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQaUpdated, addr11, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter2, &IC_74xx193_t::SignalQbUpdated, addr11, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQcUpdated, addr11, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQdUpdated, addr11, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQaUpdated, addr11, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQbUpdated, addr11, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQcUpdated, addr11, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQdUpdated, addr11, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- Addr1 LSB
-    connect(inv1, &IC_74xx04_t::SignalY5Updated, addr10, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter0, &IC_74xx193_t::SignalQaUpdated, addr10, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter0, &IC_74xx193_t::SignalQbUpdated, addr10, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter0, &IC_74xx193_t::SignalQcUpdated, addr10, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter0, &IC_74xx193_t::SignalQdUpdated, addr10, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter1, &IC_74xx193_t::SignalQaUpdated, addr10, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter1, &IC_74xx193_t::SignalQbUpdated, addr10, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter1, &IC_74xx193_t::SignalQcUpdated, addr10, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter1, &IC_74xx193_t::SignalQdUpdated, addr10, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY5Updated, addr10, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQaUpdated, addr10, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter0, &IC_74xx193_t::SignalQbUpdated, addr10, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQcUpdated, addr10, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQdUpdated, addr10, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQaUpdated, addr10, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQbUpdated, addr10, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQcUpdated, addr10, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQdUpdated, addr10, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- Addr2 MSB
-    connect(inv1, &IC_74xx04_t::SignalY6Updated, addr21, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter2, &IC_74xx193_t::SignalQaUpdated, addr21, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter2, &IC_74xx193_t::SignalQbUpdated, addr21, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter2, &IC_74xx193_t::SignalQcUpdated, addr21, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter2, &IC_74xx193_t::SignalQdUpdated, addr21, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter3, &IC_74xx193_t::SignalQaUpdated, addr21, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter3, &IC_74xx193_t::SignalQbUpdated, addr21, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter3, &IC_74xx193_t::SignalQcUpdated, addr21, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter3, &IC_74xx193_t::SignalQdUpdated, addr21, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY6Updated, addr21, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQaUpdated, addr21, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter2, &IC_74xx193_t::SignalQbUpdated, addr21, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQcUpdated, addr21, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQdUpdated, addr21, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQaUpdated, addr21, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQbUpdated, addr21, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQcUpdated, addr21, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQdUpdated, addr21, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- Addr2 LSB
-    connect(inv1, &IC_74xx04_t::SignalY6Updated, addr20, &IC_74xx574_t::ProcessUpdateOE);
-    connect(counter0, &IC_74xx193_t::SignalQaUpdated, addr20, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter0, &IC_74xx193_t::SignalQbUpdated, addr20, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter0, &IC_74xx193_t::SignalQcUpdated, addr20, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter0, &IC_74xx193_t::SignalQdUpdated, addr20, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter1, &IC_74xx193_t::SignalQaUpdated, addr20, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter1, &IC_74xx193_t::SignalQbUpdated, addr20, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter1, &IC_74xx193_t::SignalQcUpdated, addr20, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter1, &IC_74xx193_t::SignalQdUpdated, addr20, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(inv1, &IC_74xx04_t::SignalY6Updated, addr20, &IC_74xx574_t::ProcessUpdateOE, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQaUpdated, addr20, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter0, &IC_74xx193_t::SignalQbUpdated, addr20, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQcUpdated, addr20, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQdUpdated, addr20, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQaUpdated, addr20, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQbUpdated, addr20, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQcUpdated, addr20, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQdUpdated, addr20, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- Led MSB
     led1->ProcessUpdateOE(LOW);
-    connect(counter2, &IC_74xx193_t::SignalQaUpdated, led1, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter2, &IC_74xx193_t::SignalQbUpdated, led1, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter2, &IC_74xx193_t::SignalQcUpdated, led1, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter2, &IC_74xx193_t::SignalQdUpdated, led1, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter3, &IC_74xx193_t::SignalQaUpdated, led1, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter3, &IC_74xx193_t::SignalQbUpdated, led1, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter3, &IC_74xx193_t::SignalQcUpdated, led1, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter3, &IC_74xx193_t::SignalQdUpdated, led1, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(counter2, &IC_74xx193_t::SignalQaUpdated, led1, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter2, &IC_74xx193_t::SignalQbUpdated, led1, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQcUpdated, led1, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter2, &IC_74xx193_t::SignalQdUpdated, led1, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQaUpdated, led1, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQbUpdated, led1, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQcUpdated, led1, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter3, &IC_74xx193_t::SignalQdUpdated, led1, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- Led LSB
     led0->ProcessUpdateOE(LOW);
-    connect(counter0, &IC_74xx193_t::SignalQaUpdated, led0, &IC_74xx574_t::ProcessUpdateD8);   // lsb
-    connect(counter0, &IC_74xx193_t::SignalQbUpdated, led0, &IC_74xx574_t::ProcessUpdateD7);
-    connect(counter0, &IC_74xx193_t::SignalQcUpdated, led0, &IC_74xx574_t::ProcessUpdateD6);
-    connect(counter0, &IC_74xx193_t::SignalQdUpdated, led0, &IC_74xx574_t::ProcessUpdateD5);
-    connect(counter1, &IC_74xx193_t::SignalQaUpdated, led0, &IC_74xx574_t::ProcessUpdateD4);
-    connect(counter1, &IC_74xx193_t::SignalQbUpdated, led0, &IC_74xx574_t::ProcessUpdateD3);
-    connect(counter1, &IC_74xx193_t::SignalQcUpdated, led0, &IC_74xx574_t::ProcessUpdateD2);
-    connect(counter1, &IC_74xx193_t::SignalQdUpdated, led0, &IC_74xx574_t::ProcessUpdateD1);   // msb
+    connect(counter0, &IC_74xx193_t::SignalQaUpdated, led0, &IC_74xx574_t::ProcessUpdateD8, CNN_TYPE);   // lsb
+    connect(counter0, &IC_74xx193_t::SignalQbUpdated, led0, &IC_74xx574_t::ProcessUpdateD7, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQcUpdated, led0, &IC_74xx574_t::ProcessUpdateD6, CNN_TYPE);
+    connect(counter0, &IC_74xx193_t::SignalQdUpdated, led0, &IC_74xx574_t::ProcessUpdateD5, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQaUpdated, led0, &IC_74xx574_t::ProcessUpdateD4, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQbUpdated, led0, &IC_74xx574_t::ProcessUpdateD3, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQcUpdated, led0, &IC_74xx574_t::ProcessUpdateD2, CNN_TYPE);
+    connect(counter1, &IC_74xx193_t::SignalQdUpdated, led0, &IC_74xx574_t::ProcessUpdateD1, CNN_TYPE);   // msb
     // -- Clock from below
 
 
     // -- connect contents the LED inputs
-    connect(led0, &IC_74xx574_t::SignalQ8Updated, bit0, &GUI_Led_t::ProcessStateChange);
-    connect(led0, &IC_74xx574_t::SignalQ7Updated, bit1, &GUI_Led_t::ProcessStateChange);
-    connect(led0, &IC_74xx574_t::SignalQ6Updated, bit2, &GUI_Led_t::ProcessStateChange);
-    connect(led0, &IC_74xx574_t::SignalQ5Updated, bit3, &GUI_Led_t::ProcessStateChange);
-    connect(led0, &IC_74xx574_t::SignalQ4Updated, bit4, &GUI_Led_t::ProcessStateChange);
-    connect(led0, &IC_74xx574_t::SignalQ3Updated, bit5, &GUI_Led_t::ProcessStateChange);
-    connect(led0, &IC_74xx574_t::SignalQ2Updated, bit6, &GUI_Led_t::ProcessStateChange);
-    connect(led0, &IC_74xx574_t::SignalQ1Updated, bit7, &GUI_Led_t::ProcessStateChange);
-    connect(led1, &IC_74xx574_t::SignalQ8Updated, bit8, &GUI_Led_t::ProcessStateChange);
-    connect(led1, &IC_74xx574_t::SignalQ7Updated, bit9, &GUI_Led_t::ProcessStateChange);
-    connect(led1, &IC_74xx574_t::SignalQ6Updated, bitA, &GUI_Led_t::ProcessStateChange);
-    connect(led1, &IC_74xx574_t::SignalQ5Updated, bitB, &GUI_Led_t::ProcessStateChange);
-    connect(led1, &IC_74xx574_t::SignalQ4Updated, bitC, &GUI_Led_t::ProcessStateChange);
-    connect(led1, &IC_74xx574_t::SignalQ3Updated, bitD, &GUI_Led_t::ProcessStateChange);
-    connect(led1, &IC_74xx574_t::SignalQ2Updated, bitE, &GUI_Led_t::ProcessStateChange);
-    connect(led1, &IC_74xx574_t::SignalQ1Updated, bitF, &GUI_Led_t::ProcessStateChange);
+    connect(led0, &IC_74xx574_t::SignalQWordUpdated, bits, &GUI_LedBank_t::ProcessUpdateLsb, CNN_TYPE);
+    connect(led1, &IC_74xx574_t::SignalQWordUpdated, bits, &GUI_LedBank_t::ProcessUpdateMsb, CNN_TYPE);
 
 
     // -- Control LED inputs are handled below
@@ -481,140 +490,164 @@ void GpRegisterModule_t::WireUp(void)
 
     // -- connect the module to accept inputs from the main bus
     HW_Bus_16_t *mainBus = HW_Computer_t::Get()->GetMainBus();
-    connect(mainBus, &HW_Bus_16_t::SignalBit0Updated, this, &GpRegisterModule_t::ProcessUpdateMainBit0);
-    connect(mainBus, &HW_Bus_16_t::SignalBit1Updated, this, &GpRegisterModule_t::ProcessUpdateMainBit1);
-    connect(mainBus, &HW_Bus_16_t::SignalBit2Updated, this, &GpRegisterModule_t::ProcessUpdateMainBit2);
-    connect(mainBus, &HW_Bus_16_t::SignalBit3Updated, this, &GpRegisterModule_t::ProcessUpdateMainBit3);
-    connect(mainBus, &HW_Bus_16_t::SignalBit4Updated, this, &GpRegisterModule_t::ProcessUpdateMainBit4);
-    connect(mainBus, &HW_Bus_16_t::SignalBit5Updated, this, &GpRegisterModule_t::ProcessUpdateMainBit5);
-    connect(mainBus, &HW_Bus_16_t::SignalBit6Updated, this, &GpRegisterModule_t::ProcessUpdateMainBit6);
-    connect(mainBus, &HW_Bus_16_t::SignalBit7Updated, this, &GpRegisterModule_t::ProcessUpdateMainBit7);
-    connect(mainBus, &HW_Bus_16_t::SignalBit8Updated, this, &GpRegisterModule_t::ProcessUpdateMainBit8);
-    connect(mainBus, &HW_Bus_16_t::SignalBit9Updated, this, &GpRegisterModule_t::ProcessUpdateMainBit9);
-    connect(mainBus, &HW_Bus_16_t::SignalBitAUpdated, this, &GpRegisterModule_t::ProcessUpdateMainBitA);
-    connect(mainBus, &HW_Bus_16_t::SignalBitBUpdated, this, &GpRegisterModule_t::ProcessUpdateMainBitB);
-    connect(mainBus, &HW_Bus_16_t::SignalBitCUpdated, this, &GpRegisterModule_t::ProcessUpdateMainBitC);
-    connect(mainBus, &HW_Bus_16_t::SignalBitDUpdated, this, &GpRegisterModule_t::ProcessUpdateMainBitD);
-    connect(mainBus, &HW_Bus_16_t::SignalBitEUpdated, this, &GpRegisterModule_t::ProcessUpdateMainBitE);
-    connect(mainBus, &HW_Bus_16_t::SignalBitFUpdated, this, &GpRegisterModule_t::ProcessUpdateMainBitF);
+    connect(mainBus, &HW_Bus_16_t::SignalWordUpdated, this, &GpRegisterModule_t::ProcessUpdateMainWord, CNN_TYPE);
 
 
     // -- Connect up to the Main Bus with the main bus assert
-    connect(main0, &IC_74xx574_t::SignalQ8Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit0);
-    connect(main0, &IC_74xx574_t::SignalQ7Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit1);
-    connect(main0, &IC_74xx574_t::SignalQ6Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit2);
-    connect(main0, &IC_74xx574_t::SignalQ5Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit3);
-    connect(main0, &IC_74xx574_t::SignalQ4Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit4);
-    connect(main0, &IC_74xx574_t::SignalQ3Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit5);
-    connect(main0, &IC_74xx574_t::SignalQ2Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit6);
-    connect(main0, &IC_74xx574_t::SignalQ1Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit7);
-    connect(main1, &IC_74xx574_t::SignalQ8Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit8);
-    connect(main1, &IC_74xx574_t::SignalQ7Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit9);
-    connect(main1, &IC_74xx574_t::SignalQ6Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitA);
-    connect(main1, &IC_74xx574_t::SignalQ5Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitB);
-    connect(main1, &IC_74xx574_t::SignalQ4Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitC);
-    connect(main1, &IC_74xx574_t::SignalQ3Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitD);
-    connect(main1, &IC_74xx574_t::SignalQ2Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitE);
-    connect(main1, &IC_74xx574_t::SignalQ1Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitF);
+    connect(main0, &IC_74xx574_t::SignalQWordUpdated, mainBus, &HW_Bus_16_t::ProcessUpdateLsb, CNN_TYPE);
+    connect(main1, &IC_74xx574_t::SignalQWordUpdated, mainBus, &HW_Bus_16_t::ProcessUpdateMsb, CNN_TYPE);
 
 
     // -- Connect up to the Main Bus with the swap bus assert (already swapped)
-    connect(swap0, &IC_74xx574_t::SignalQ8Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit0);
-    connect(swap0, &IC_74xx574_t::SignalQ7Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit1);
-    connect(swap0, &IC_74xx574_t::SignalQ6Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit2);
-    connect(swap0, &IC_74xx574_t::SignalQ5Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit3);
-    connect(swap0, &IC_74xx574_t::SignalQ4Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit4);
-    connect(swap0, &IC_74xx574_t::SignalQ3Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit5);
-    connect(swap0, &IC_74xx574_t::SignalQ2Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit6);
-    connect(swap0, &IC_74xx574_t::SignalQ1Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit7);
-    connect(swap1, &IC_74xx574_t::SignalQ8Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit8);
-    connect(swap1, &IC_74xx574_t::SignalQ7Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBit9);
-    connect(swap1, &IC_74xx574_t::SignalQ6Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitA);
-    connect(swap1, &IC_74xx574_t::SignalQ5Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitB);
-    connect(swap1, &IC_74xx574_t::SignalQ4Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitC);
-    connect(swap1, &IC_74xx574_t::SignalQ3Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitD);
-    connect(swap1, &IC_74xx574_t::SignalQ2Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitE);
-    connect(swap1, &IC_74xx574_t::SignalQ1Updated, mainBus, &HW_Bus_16_t::ProcessUpdateBitF);
+    connect(swap0, &IC_74xx574_t::SignalQWordUpdated, mainBus, &HW_Bus_16_t::ProcessUpdateLsb, CNN_TYPE);
+    connect(swap1, &IC_74xx574_t::SignalQWordUpdated, mainBus, &HW_Bus_16_t::ProcessUpdateMsb, CNN_TYPE);
 
 
     // -- Connect up to the ALU A Bus
     HW_Bus_16_t *aluABus = HW_Computer_t::Get()->GetAluABus();
-    connect(aluA0, &IC_74xx574_t::SignalQ8Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBit0);
-    connect(aluA0, &IC_74xx574_t::SignalQ7Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBit1);
-    connect(aluA0, &IC_74xx574_t::SignalQ6Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBit2);
-    connect(aluA0, &IC_74xx574_t::SignalQ5Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBit3);
-    connect(aluA0, &IC_74xx574_t::SignalQ4Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBit4);
-    connect(aluA0, &IC_74xx574_t::SignalQ3Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBit5);
-    connect(aluA0, &IC_74xx574_t::SignalQ2Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBit6);
-    connect(aluA0, &IC_74xx574_t::SignalQ1Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBit7);
-    connect(aluA1, &IC_74xx574_t::SignalQ8Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBit8);
-    connect(aluA1, &IC_74xx574_t::SignalQ7Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBit9);
-    connect(aluA1, &IC_74xx574_t::SignalQ6Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBitA);
-    connect(aluA1, &IC_74xx574_t::SignalQ5Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBitB);
-    connect(aluA1, &IC_74xx574_t::SignalQ4Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBitC);
-    connect(aluA1, &IC_74xx574_t::SignalQ3Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBitD);
-    connect(aluA1, &IC_74xx574_t::SignalQ2Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBitE);
-    connect(aluA1, &IC_74xx574_t::SignalQ1Updated, aluABus, &HW_Bus_16_t::ProcessUpdateBitF);
+    connect(aluA0, &IC_74xx574_t::SignalQWordUpdated, aluABus, &HW_Bus_16_t::ProcessUpdateLsb, CNN_TYPE);
+    connect(aluA1, &IC_74xx574_t::SignalQWordUpdated, aluABus, &HW_Bus_16_t::ProcessUpdateMsb, CNN_TYPE);
 
 
     // -- Connect up to the ALU B Bus
     HW_Bus_16_t *aluBBus = HW_Computer_t::Get()->GetAluBBus();
-    connect(aluB0, &IC_74xx574_t::SignalQ8Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBit0);
-    connect(aluB0, &IC_74xx574_t::SignalQ7Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBit1);
-    connect(aluB0, &IC_74xx574_t::SignalQ6Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBit2);
-    connect(aluB0, &IC_74xx574_t::SignalQ5Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBit3);
-    connect(aluB0, &IC_74xx574_t::SignalQ4Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBit4);
-    connect(aluB0, &IC_74xx574_t::SignalQ3Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBit5);
-    connect(aluB0, &IC_74xx574_t::SignalQ2Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBit6);
-    connect(aluB0, &IC_74xx574_t::SignalQ1Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBit7);
-    connect(aluB1, &IC_74xx574_t::SignalQ8Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBit8);
-    connect(aluB1, &IC_74xx574_t::SignalQ7Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBit9);
-    connect(aluB1, &IC_74xx574_t::SignalQ6Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBitA);
-    connect(aluB1, &IC_74xx574_t::SignalQ5Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBitB);
-    connect(aluB1, &IC_74xx574_t::SignalQ4Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBitC);
-    connect(aluB1, &IC_74xx574_t::SignalQ3Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBitD);
-    connect(aluB1, &IC_74xx574_t::SignalQ2Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBitE);
-    connect(aluB1, &IC_74xx574_t::SignalQ1Updated, aluBBus, &HW_Bus_16_t::ProcessUpdateBitF);
+    connect(aluB0, &IC_74xx574_t::SignalQWordUpdated, aluBBus, &HW_Bus_16_t::ProcessUpdateLsb, CNN_TYPE);
+    connect(aluB1, &IC_74xx574_t::SignalQWordUpdated, aluBBus, &HW_Bus_16_t::ProcessUpdateMsb, CNN_TYPE);
 
 
     // -- Connect up to the Addr1 Bus
     HW_Bus_16_t *addr1Bus = HW_Computer_t::Get()->GetAddr1Bus();
-    connect(addr10, &IC_74xx574_t::SignalQ8Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBit0);
-    connect(addr10, &IC_74xx574_t::SignalQ7Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBit1);
-    connect(addr10, &IC_74xx574_t::SignalQ6Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBit2);
-    connect(addr10, &IC_74xx574_t::SignalQ5Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBit3);
-    connect(addr10, &IC_74xx574_t::SignalQ4Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBit4);
-    connect(addr10, &IC_74xx574_t::SignalQ3Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBit5);
-    connect(addr10, &IC_74xx574_t::SignalQ2Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBit6);
-    connect(addr10, &IC_74xx574_t::SignalQ1Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBit7);
-    connect(addr11, &IC_74xx574_t::SignalQ8Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBit8);
-    connect(addr11, &IC_74xx574_t::SignalQ7Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBit9);
-    connect(addr11, &IC_74xx574_t::SignalQ6Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBitA);
-    connect(addr11, &IC_74xx574_t::SignalQ5Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBitB);
-    connect(addr11, &IC_74xx574_t::SignalQ4Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBitC);
-    connect(addr11, &IC_74xx574_t::SignalQ3Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBitD);
-    connect(addr11, &IC_74xx574_t::SignalQ2Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBitE);
-    connect(addr11, &IC_74xx574_t::SignalQ1Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateBitF);
+    connect(addr10, &IC_74xx574_t::SignalQWordUpdated, addr1Bus, &HW_Bus_16_t::ProcessUpdateLsb, CNN_TYPE);
+    connect(addr11, &IC_74xx574_t::SignalQWordUpdated, addr1Bus, &HW_Bus_16_t::ProcessUpdateMsb, CNN_TYPE);
 
 
     // -- Connect up to the Addr1 Bus
     HW_Bus_16_t *addr2Bus = HW_Computer_t::Get()->GetAddr2Bus();
-    connect(addr20, &IC_74xx574_t::SignalQ8Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBit0);
-    connect(addr20, &IC_74xx574_t::SignalQ7Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBit1);
-    connect(addr20, &IC_74xx574_t::SignalQ6Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBit2);
-    connect(addr20, &IC_74xx574_t::SignalQ5Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBit3);
-    connect(addr20, &IC_74xx574_t::SignalQ4Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBit4);
-    connect(addr20, &IC_74xx574_t::SignalQ3Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBit5);
-    connect(addr20, &IC_74xx574_t::SignalQ2Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBit6);
-    connect(addr20, &IC_74xx574_t::SignalQ1Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBit7);
-    connect(addr21, &IC_74xx574_t::SignalQ8Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBit8);
-    connect(addr21, &IC_74xx574_t::SignalQ7Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBit9);
-    connect(addr21, &IC_74xx574_t::SignalQ6Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBitA);
-    connect(addr21, &IC_74xx574_t::SignalQ5Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBitB);
-    connect(addr21, &IC_74xx574_t::SignalQ4Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBitC);
-    connect(addr21, &IC_74xx574_t::SignalQ3Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBitD);
-    connect(addr21, &IC_74xx574_t::SignalQ2Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBitE);
-    connect(addr21, &IC_74xx574_t::SignalQ1Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateBitF);
+    connect(addr20, &IC_74xx574_t::SignalQWordUpdated, addr2Bus, &HW_Bus_16_t::ProcessUpdateLsb, CNN_TYPE);
+    connect(addr21, &IC_74xx574_t::SignalQWordUpdated, addr2Bus, &HW_Bus_16_t::ProcessUpdateMsb, CNN_TYPE);
+}
+
+
+//
+// -- connect the behavioral model to the buses; the 574s would have done this at gate level
+//    --------------------------------------------------------------------------------------
+void GpRegisterModule_t::WireUpBehavioral(void)
+{
+    HW_Bus_16_t *mainBus = HW_Computer_t::Get()->GetMainBus();
+    connect(mainBus, &HW_Bus_16_t::SignalWordUpdated, this, &GpRegisterModule_t::ProcessUpdateMainWord, CNN_TYPE);
+    connect(this, &GpRegisterModule_t::SignalMainUpdated, mainBus, &HW_Bus_16_t::ProcessUpdateWord, CNN_TYPE);
+    connect(swapDriver, &GpRegisterSwap_t::SignalUpdated, mainBus, &HW_Bus_16_t::ProcessUpdateWord, CNN_TYPE);
+
+    HW_Bus_16_t *aluABus = HW_Computer_t::Get()->GetAluABus();
+    connect(this, &GpRegisterModule_t::SignalAluAUpdated, aluABus, &HW_Bus_16_t::ProcessUpdateWord, CNN_TYPE);
+
+    HW_Bus_16_t *aluBBus = HW_Computer_t::Get()->GetAluBBus();
+    connect(this, &GpRegisterModule_t::SignalAluBUpdated, aluBBus, &HW_Bus_16_t::ProcessUpdateWord, CNN_TYPE);
+
+    HW_Bus_16_t *addr1Bus = HW_Computer_t::Get()->GetAddr1Bus();
+    connect(this, &GpRegisterModule_t::SignalAddr1Updated, addr1Bus, &HW_Bus_16_t::ProcessUpdateWord, CNN_TYPE);
+
+    HW_Bus_16_t *addr2Bus = HW_Computer_t::Get()->GetAddr2Bus();
+    connect(this, &GpRegisterModule_t::SignalAddr2Updated, addr2Bus, &HW_Bus_16_t::ProcessUpdateWord, CNN_TYPE);
+}
+
+
+//
+// -- Behavioral: settle the counter after any of its inputs change
+//
+//    This follows the 74xx193s: CLR wins, then a low LOAD is a transparent load, and otherwise the count
+//    moves on the rising edge of UP or DOWN.  Those are NAND(CLK, INC) and NAND(CLK, DEC), so the count moves
+//    when the clock falls with INC/DEC high (or INC/DEC falls with the clock high).  The ripple through the
+//    CO/BO outputs of the 4 counters is just 16-bit arithmetic here.
+//    --------------------------------------------------------------------------------------------------------
+void GpRegisterModule_t::UpdateCounter(void)
+{
+    bool newUp = !(clk && incIn);
+    bool newDown = !(clk && decIn);
+
+    if (!resetIn) value = 0;
+    else if (clk && loadIn) value = mainIn;
+    else {
+        if (!up && newUp) value ++;
+        if (!down && newDown) value --;
+    }
+
+    up = newUp;
+    down = newDown;
+}
+
+
+//
+// -- Behavioral: drive the buses from the 574 outputs
+//
+//    Main and Swap are separate drivers on the main bus, as they are at gate level, so asserting both shows up
+//    as contention on the bus rather than being hidden in one word.
+//    ----------------------------------------------------------------------------------------------------------
+void GpRegisterModule_t::UpdateOutputs(void)
+{
+    uint16_t swapped = (uint16_t)((q << 8) | (q >> 8));
+
+    emit SignalMainUpdated(q, mainOut ? 0xffff : 0);
+    emit swapDriver->SignalUpdated(swapped, swapOut ? 0xffff : 0);
+    emit SignalAluAUpdated(q, aluAOut ? 0xffff : 0);
+    emit SignalAluBUpdated(q, aluBOut ? 0xffff : 0);
+    emit SignalAddr1Updated(q, addr1Out ? 0xffff : 0);
+    emit SignalAddr2Updated(q, addr2Out ? 0xffff : 0);
+}
+
+
+//
+// -- Handle a single bit from the main bus
+//    -------------------------------------
+void GpRegisterModule_t::UpdateMainBit(int bit, TriState_t state)
+{
+    if (behavioral) {
+        if (state == HIGH) mainIn |= (1 << bit);
+        else mainIn &= ~(1 << bit);
+
+        UpdateCounter();
+        return;
+    }
+
+    IC_74xx193_t *counters[4] = { counter0, counter1, counter2, counter3 };
+    IC_74xx193_t *counter = counters[bit >> 2];
+
+    switch (bit & 3) {
+        case 0: counter->ProcessUpdateA(state); break;
+        case 1: counter->ProcessUpdateB(state); break;
+        case 2: counter->ProcessUpdateC(state); break;
+        case 3: counter->ProcessUpdateD(state); break;
+    }
+}
+
+
+//
+// -- Handle an update from the main bus
+//    ----------------------------------
+void GpRegisterModule_t::ProcessUpdateMainWord(uint16_t val)
+{
+    if (behavioral) {
+        mainIn = val;
+        UpdateCounter();
+        return;
+    }
+
+    counter0->ProcessUpdateA((val & (1 <<  0)) ? HIGH : LOW);
+    counter0->ProcessUpdateB((val & (1 <<  1)) ? HIGH : LOW);
+    counter0->ProcessUpdateC((val & (1 <<  2)) ? HIGH : LOW);
+    counter0->ProcessUpdateD((val & (1 <<  3)) ? HIGH : LOW);
+    counter1->ProcessUpdateA((val & (1 <<  4)) ? HIGH : LOW);
+    counter1->ProcessUpdateB((val & (1 <<  5)) ? HIGH : LOW);
+    counter1->ProcessUpdateC((val & (1 <<  6)) ? HIGH : LOW);
+    counter1->ProcessUpdateD((val & (1 <<  7)) ? HIGH : LOW);
+    counter2->ProcessUpdateA((val & (1 <<  8)) ? HIGH : LOW);
+    counter2->ProcessUpdateB((val & (1 <<  9)) ? HIGH : LOW);
+    counter2->ProcessUpdateC((val & (1 << 10)) ? HIGH : LOW);
+    counter2->ProcessUpdateD((val & (1 << 11)) ? HIGH : LOW);
+    counter3->ProcessUpdateA((val & (1 << 12)) ? HIGH : LOW);
+    counter3->ProcessUpdateB((val & (1 << 13)) ? HIGH : LOW);
+    counter3->ProcessUpdateC((val & (1 << 14)) ? HIGH : LOW);
+    counter3->ProcessUpdateD((val & (1 << 15)) ? HIGH : LOW);
 }
 
 
@@ -623,6 +656,12 @@ void GpRegisterModule_t::WireUp(void)
 //    ---------------------
 void GpRegisterModule_t::ProcessReset(TriState_t state)
 {
+    if (behavioral) {
+        resetIn = (state == HIGH);
+        UpdateCounter();
+        return;
+    }
+
     nand1->ProcessUpdateA4(state);
     nand1->ProcessUpdateB4(state);
 }
@@ -635,6 +674,11 @@ void GpRegisterModule_t::ProcessClockLatch(TriState_t state)
 {
     static int iter = 0;
 
+    if (behavioral) {
+        if (state == HIGH) latched = value;
+        return;
+    }
+
     aluA0->ProcessUpdateClockLatch(state);
     aluA1->ProcessUpdateClockLatch(state);
     aluB0->ProcessUpdateClockLatch(state);
@@ -657,6 +701,19 @@ void GpRegisterModule_t::ProcessClockLatch(TriState_t state)
 //    ---------------------
 void GpRegisterModule_t::ProcessClockOutput(TriState_t state)
 {
+    if (behavioral) {
+        clk = (state == HIGH);
+        UpdateCounter();
+
+        if (clk && q != latched) {
+            q = latched;
+            UpdateOutputs();
+            bits->SetValue(q);
+        }
+
+        return;
+    }
+
     nand1->ProcessUpdateA1(state);
     nand1->ProcessUpdateA2(state);
 nand1->ProcessUpdateA3(state);
@@ -683,6 +740,13 @@ nand1->ProcessUpdateA3(state);
 void GpRegisterModule_t::ProcessLoad(TriState_t state)
 {
     load->ProcessStateChange(state);
+
+    if (behavioral) {
+        loadIn = (state == HIGH);
+        UpdateCounter();
+        return;
+    }
+
 //    nand1->ProcessUpdateA3(state);
     nand1->ProcessUpdateB3(state);
 }
@@ -694,6 +758,13 @@ void GpRegisterModule_t::ProcessLoad(TriState_t state)
 void GpRegisterModule_t::ProcessInc(TriState_t state)
 {
     inc->ProcessStateChange(state);
+
+    if (behavioral) {
+        incIn = (state == HIGH);
+        UpdateCounter();
+        return;
+    }
+
     nand1->ProcessUpdateB1(state);
 }
 
@@ -704,6 +775,13 @@ void GpRegisterModule_t::ProcessInc(TriState_t state)
 void GpRegisterModule_t::ProcessDec(TriState_t state)
 {
     dec->ProcessStateChange(state);
+
+    if (behavioral) {
+        decIn = (state == HIGH);
+        UpdateCounter();
+        return;
+    }
+
     nand1->ProcessUpdateB2(state);
 }
 
@@ -714,6 +792,13 @@ void GpRegisterModule_t::ProcessDec(TriState_t state)
 void GpRegisterModule_t::ProcessAssertSwap(TriState_t state)
 {
     assertSwap->ProcessStateChange(state);
+
+    if (behavioral) {
+        swapOut = (state == HIGH);
+        UpdateOutputs();
+        return;
+    }
+
     inv1->ProcessUpdateA1(state);
 }
 
@@ -724,6 +809,13 @@ void GpRegisterModule_t::ProcessAssertSwap(TriState_t state)
 void GpRegisterModule_t::ProcessAssertMain(TriState_t state)
 {
     assertMain->ProcessStateChange(state);
+
+    if (behavioral) {
+        mainOut = (state == HIGH);
+        UpdateOutputs();
+        return;
+    }
+
     inv1->ProcessUpdateA2(state);
 }
 
@@ -734,6 +826,13 @@ void GpRegisterModule_t::ProcessAssertMain(TriState_t state)
 void GpRegisterModule_t::ProcessAssertAluA(TriState_t state)
 {
     assertAluA->ProcessStateChange(state);
+
+    if (behavioral) {
+        aluAOut = (state == HIGH);
+        UpdateOutputs();
+        return;
+    }
+
     inv1->ProcessUpdateA3(state);
 }
 
@@ -744,6 +843,13 @@ void GpRegisterModule_t::ProcessAssertAluA(TriState_t state)
 void GpRegisterModule_t::ProcessAssertAluB(TriState_t state)
 {
     assertAluB->ProcessStateChange(state);
+
+    if (behavioral) {
+        aluBOut = (state == HIGH);
+        UpdateOutputs();
+        return;
+    }
+
     inv1->ProcessUpdateA4(state);
 }
 
@@ -754,6 +860,13 @@ void GpRegisterModule_t::ProcessAssertAluB(TriState_t state)
 void GpRegisterModule_t::ProcessAssertAddr1(TriState_t state)
 {
     assertAddr1->ProcessStateChange(state);
+
+    if (behavioral) {
+        addr1Out = (state == HIGH);
+        UpdateOutputs();
+        return;
+    }
+
     inv1->ProcessUpdateA5(state);
 }
 
@@ -764,6 +877,13 @@ void GpRegisterModule_t::ProcessAssertAddr1(TriState_t state)
 void GpRegisterModule_t::ProcessAssertAddr2(TriState_t state)
 {
     assertAddr2->ProcessStateChange(state);
+
+    if (behavioral) {
+        addr2Out = (state == HIGH);
+        UpdateOutputs();
+        return;
+    }
+
     inv1->ProcessUpdateA6(state);
 }
 
@@ -25,7 +25,7 @@ ResetModule_t::ResetModule_t(void) : QGroupBox("Reset")
     setAlignment(Qt::AlignCenter);
 
     AllocateComponents();
-    BuildGui();
+    if (!headless) BuildGui();
     WireUp();
     SetDebug();
     TriggerFirstUpdate();
@@ -119,39 +119,39 @@ void ResetModule_t::TriggerFirstUpdate(void)
 void ResetModule_t::WireUp(void)
 {
     // -- inputs into nand1; gate 1
-    connect(reset, &GUI_MomentarySwitch_t::SignalSwitchChanged, nand1, &IC_74xx00_t::ProcessUpdateA1);
-    connect(nand1, &IC_74xx00_t::SignalY2Updated, nand1, &IC_74xx00_t::ProcessUpdateB1);
+    connect(reset, &GUI_MomentarySwitch_t::SignalSwitchChanged, nand1, &IC_74xx00_t::ProcessUpdateA1, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY2Updated, nand1, &IC_74xx00_t::ProcessUpdateB1, CNN_TYPE);
 
     // -- inputs into nand1; gate 2
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, nand1, &IC_74xx00_t::ProcessUpdateA2);
-    connect(nand1, &IC_74xx00_t::SignalY3Updated, nand1, &IC_74xx00_t::ProcessUpdateB2);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, nand1, &IC_74xx00_t::ProcessUpdateA2, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY3Updated, nand1, &IC_74xx00_t::ProcessUpdateB2, CNN_TYPE);
 
     // -- inputs into nand1; gate 3
     HW_Bus_1_t *copyHold = HW_Computer_t::GetCpyHldBus();
-    connect(copyHold, &HW_Bus_1_t::SignalBit0Updated, nand1, &IC_74xx00_t::ProcessUpdateA3);
-    connect(nand1, &IC_74xx00_t::SignalY4Updated, nand1, &IC_74xx00_t::ProcessUpdateB3);
+    connect(copyHold, &HW_Bus_1_t::SignalBit0Updated, nand1, &IC_74xx00_t::ProcessUpdateA3, CNN_TYPE);
+    connect(nand1, &IC_74xx00_t::SignalY4Updated, nand1, &IC_74xx00_t::ProcessUpdateB3, CNN_TYPE);
 
     // -- inputs into nand1; gate 4
-    connect(nand1, &IC_74xx00_t::SignalY3Updated, nand1, &IC_74xx00_t::ProcessUpdateA4);
-    connect(counter, &IC_74xx193_t::SignalBoUpdated, nand1, &IC_74xx00_t::ProcessUpdateB4);
+    connect(nand1, &IC_74xx00_t::SignalY3Updated, nand1, &IC_74xx00_t::ProcessUpdateA4, CNN_TYPE);
+    connect(counter, &IC_74xx193_t::SignalBoUpdated, nand1, &IC_74xx00_t::ProcessUpdateB4, CNN_TYPE);
 
 
 
     // -- inputs into nand2; gate 1
-    connect(reset, &GUI_MomentarySwitch_t::SignalSwitchChanged, nand2, &IC_74xx00_t::ProcessUpdateA1);
-    connect(nand2, &IC_74xx00_t::SignalY2Updated, nand2, &IC_74xx00_t::ProcessUpdateB1);
+    connect(reset, &GUI_MomentarySwitch_t::SignalSwitchChanged, nand2, &IC_74xx00_t::ProcessUpdateA1, CNN_TYPE);
+    connect(nand2, &IC_74xx00_t::SignalY2Updated, nand2, &IC_74xx00_t::ProcessUpdateB1, CNN_TYPE);
 
     // -- inputs into nand2; gate 2
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, nand2, &IC_74xx00_t::ProcessUpdateA2);
-    connect(nor1, &IC_74xx02_t::SignalY1Updated, nand2, &IC_74xx00_t::ProcessUpdateB2);
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, nand2, &IC_74xx00_t::ProcessUpdateA2, CNN_TYPE);
+    connect(nor1, &IC_74xx02_t::SignalY1Updated, nand2, &IC_74xx00_t::ProcessUpdateB2, CNN_TYPE);
 
     // -- inputs into nand2; gate 3
-    connect(reset, &GUI_MomentarySwitch_t::SignalSwitchChanged, nand2, &IC_74xx00_t::ProcessUpdateA3);
-    connect(vib1, &IC_74xx123_t::SignalQ1Updated, nand2, &IC_74xx00_t::ProcessUpdateB3);
+    connect(reset, &GUI_MomentarySwitch_t::SignalSwitchChanged, nand2, &IC_74xx00_t::ProcessUpdateA3, CNN_TYPE);
+    connect(vib1, &IC_74xx123_t::SignalQ1Updated, nand2, &IC_74xx00_t::ProcessUpdateB3, CNN_TYPE);
 
     // -- inputs into nand2; gate 4
-    connect(reset, &GUI_MomentarySwitch_t::SignalSwitchChanged, nand2, &IC_74xx00_t::ProcessUpdateA4);
-    connect(vib1, &IC_74xx123_t::SignalQ2Updated, nand2, &IC_74xx00_t::ProcessUpdateB4);
+    connect(reset, &GUI_MomentarySwitch_t::SignalSwitchChanged, nand2, &IC_74xx00_t::ProcessUpdateA4, CNN_TYPE);
+    connect(vib1, &IC_74xx123_t::SignalQ2Updated, nand2, &IC_74xx00_t::ProcessUpdateB4, CNN_TYPE);
 
 
 
@@ -165,10 +165,10 @@ void ResetModule_t::WireUp(void)
 
     // -- inputs into and1; gate 3
     // -- A3 below
-    connect(nand1, &IC_74xx00_t::SignalY1Updated, and1, &IC_74xx08_t::ProcessUpdateB3);
+    connect(nand1, &IC_74xx00_t::SignalY1Updated, and1, &IC_74xx08_t::ProcessUpdateB3, CNN_TYPE);
 
     // -- inputs into and1; gate 4
-    connect(nand1, &IC_74xx00_t::SignalY2Updated, and1, &IC_74xx08_t::ProcessUpdateA4);
+    connect(nand1, &IC_74xx00_t::SignalY2Updated, and1, &IC_74xx08_t::ProcessUpdateA4, CNN_TYPE);
     // -- B2 below
 
 
@@ -182,19 +182,19 @@ void ResetModule_t::WireUp(void)
     or1->ProcessB2Low();
 
     // -- inputs into or1; gate 3
-    connect(nand3, &IC_74xx00_t::SignalY3Updated, or1, &IC_74xx32_t::ProcessUpdateA3);
-    connect(nand3, &IC_74xx00_t::SignalY3Updated, or1, &IC_74xx32_t::ProcessUpdateB3);
+    connect(nand3, &IC_74xx00_t::SignalY3Updated, or1, &IC_74xx32_t::ProcessUpdateA3, CNN_TYPE);
+    connect(nand3, &IC_74xx00_t::SignalY3Updated, or1, &IC_74xx32_t::ProcessUpdateB3, CNN_TYPE);
 
     // -- inputs into or1; gate 4
-    connect(and1, &IC_74xx08_t::SignalY3Updated, or1, &IC_74xx32_t::ProcessUpdateA4);
-    connect(and1, &IC_74xx08_t::SignalY4Updated, or1, &IC_74xx32_t::ProcessUpdateB4);
+    connect(and1, &IC_74xx08_t::SignalY3Updated, or1, &IC_74xx32_t::ProcessUpdateA4, CNN_TYPE);
+    connect(and1, &IC_74xx08_t::SignalY4Updated, or1, &IC_74xx32_t::ProcessUpdateB4, CNN_TYPE);
 
 
 
     // -- inputs into latch
     // -- latch 1
     latch->ProcessUpdateClr1(HIGH);
-    connect(nand1, &IC_74xx00_t::SignalY3Updated, latch, &IC_74xx74_t::ProcessUpdateD1);
+    connect(nand1, &IC_74xx00_t::SignalY3Updated, latch, &IC_74xx74_t::ProcessUpdateD1, CNN_TYPE);
     // -- clock below
     latch->ProcessUpdatePre1(HIGH);
 
@@ -208,55 +208,55 @@ void ResetModule_t::WireUp(void)
 
 
     // -- inputs into the counter
-    connect(bitA, &GUI_DipSwitch_t::SignalSwitchChanged, counter, &IC_74xx193_t::ProcessUpdateA);
-    connect(bitB, &GUI_DipSwitch_t::SignalSwitchChanged, counter, &IC_74xx193_t::ProcessUpdateB);
-    connect(bitC, &GUI_DipSwitch_t::SignalSwitchChanged, counter, &IC_74xx193_t::ProcessUpdateC);
-    connect(bitD, &GUI_DipSwitch_t::SignalSwitchChanged, counter, &IC_74xx193_t::ProcessUpdateD);
-    connect(copyHold, &HW_Bus_1_t::SignalBit0Updated, counter, &IC_74xx193_t::ProcessUpdateLoad);
+    connect(bitA, &GUI_DipSwitch_t::SignalSwitchChanged, counter, &IC_74xx193_t::ProcessUpdateA, CNN_TYPE);
+    connect(bitB, &GUI_DipSwitch_t::SignalSwitchChanged, counter, &IC_74xx193_t::ProcessUpdateB, CNN_TYPE);
+    connect(bitC, &GUI_DipSwitch_t::SignalSwitchChanged, counter, &IC_74xx193_t::ProcessUpdateC, CNN_TYPE);
+    connect(bitD, &GUI_DipSwitch_t::SignalSwitchChanged, counter, &IC_74xx193_t::ProcessUpdateD, CNN_TYPE);
+    connect(copyHold, &HW_Bus_1_t::SignalBit0Updated, counter, &IC_74xx193_t::ProcessUpdateLoad, CNN_TYPE);
     counter->ProcessUpdateUp(HIGH);
     counter->ProcessUpdateClr(LOW);
 
 
 
     // -- inputs into nand IC 3; gate 1
-    connect(nand2, &IC_74xx00_t::SignalY3Updated, nand3, &IC_74xx00_t::ProcessUpdateA1);
-    connect(nand3, &IC_74xx00_t::SignalY2Updated, nand3, &IC_74xx00_t::ProcessUpdateB1);
+    connect(nand2, &IC_74xx00_t::SignalY3Updated, nand3, &IC_74xx00_t::ProcessUpdateA1, CNN_TYPE);
+    connect(nand3, &IC_74xx00_t::SignalY2Updated, nand3, &IC_74xx00_t::ProcessUpdateB1, CNN_TYPE);
 
     // -- inputs into nand3; gate 2
-    connect(nand3, &IC_74xx00_t::SignalY1Updated, nand3, &IC_74xx00_t::ProcessUpdateA2);
-    connect(nor1, &IC_74xx02_t::SignalY2Updated, nand3, &IC_74xx00_t::ProcessUpdateB2);
+    connect(nand3, &IC_74xx00_t::SignalY1Updated, nand3, &IC_74xx00_t::ProcessUpdateA2, CNN_TYPE);
+    connect(nor1, &IC_74xx02_t::SignalY2Updated, nand3, &IC_74xx00_t::ProcessUpdateB2, CNN_TYPE);
 
     // -- inputs into nand3; gate 3
-    connect(nand2, &IC_74xx00_t::SignalY4Updated, nand3, &IC_74xx00_t::ProcessUpdateA3);
-    connect(nand3, &IC_74xx00_t::SignalY4Updated, nand3, &IC_74xx00_t::ProcessUpdateB3);
+    connect(nand2, &IC_74xx00_t::SignalY4Updated, nand3, &IC_74xx00_t::ProcessUpdateA3, CNN_TYPE);
+    connect(nand3, &IC_74xx00_t::SignalY4Updated, nand3, &IC_74xx00_t::ProcessUpdateB3, CNN_TYPE);
 
     // -- inputs into nand3; gate 4
-    connect(nand3, &IC_74xx00_t::SignalY3Updated, nand3, &IC_74xx00_t::ProcessUpdateA4);
-    connect(nor1, &IC_74xx02_t::SignalY3Updated, nand3, &IC_74xx00_t::ProcessUpdateB4);
+    connect(nand3, &IC_74xx00_t::SignalY3Updated, nand3, &IC_74xx00_t::ProcessUpdateA4, CNN_TYPE);
+    connect(nor1, &IC_74xx02_t::SignalY3Updated, nand3, &IC_74xx00_t::ProcessUpdateB4, CNN_TYPE);
 
 
 
     // -- inputs for nor1; gate 1
-    connect(nand3, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA1);
-    connect(nand3, &IC_74xx00_t::SignalY3Updated, nor1, &IC_74xx02_t::ProcessUpdateB1);
+    connect(nand3, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA1, CNN_TYPE);
+    connect(nand3, &IC_74xx00_t::SignalY3Updated, nor1, &IC_74xx02_t::ProcessUpdateB1, CNN_TYPE);
 
     // -- inputs for nor1; gate 2
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA2);
-    connect(nand3, &IC_74xx00_t::SignalY3Updated, nor1, &IC_74xx02_t::ProcessUpdateB2);
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA2, CNN_TYPE);
+    connect(nand3, &IC_74xx00_t::SignalY3Updated, nor1, &IC_74xx02_t::ProcessUpdateB2, CNN_TYPE);
 
     // -- inputs for nor1; gate 3
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA3);
-    connect(nand3, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateB3);
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateA3, CNN_TYPE);
+    connect(nand3, &IC_74xx00_t::SignalY1Updated, nor1, &IC_74xx02_t::ProcessUpdateB3, CNN_TYPE);
 
     // -- inputs for nor1; gate 4
-    connect(copyHold, &HW_Bus_1_t::SignalBit0Updated, nor1, &IC_74xx02_t::ProcessUpdateA4);
-    connect(copyHold, &HW_Bus_1_t::SignalBit0Updated, nor1, &IC_74xx02_t::ProcessUpdateB4);
+    connect(copyHold, &HW_Bus_1_t::SignalBit0Updated, nor1, &IC_74xx02_t::ProcessUpdateA4, CNN_TYPE);
+    connect(copyHold, &HW_Bus_1_t::SignalBit0Updated, nor1, &IC_74xx02_t::ProcessUpdateB4, CNN_TYPE);
 
 
 
     // -- inputs for oNand1; gate 1
-    connect(nand3, &IC_74xx00_t::SignalY4Updated, oNand1, &IC_74xx03_t::ProcessUpdateA1);
-    connect(nand3, &IC_74xx00_t::SignalY4Updated, oNand1, &IC_74xx03_t::ProcessUpdateB1);
+    connect(nand3, &IC_74xx00_t::SignalY4Updated, oNand1, &IC_74xx03_t::ProcessUpdateA1, CNN_TYPE);
+    connect(nand3, &IC_74xx00_t::SignalY4Updated, oNand1, &IC_74xx03_t::ProcessUpdateB1, CNN_TYPE);
 
     // -- inputs for oNand1; gate 2
     oNand1->ProcessA2Low();
@@ -275,33 +275,33 @@ void ResetModule_t::WireUp(void)
     // -- inputs for the vibrator
     vib1->ProcessUpdateA1b(LOW);
     vib1->ProcessUpdateRD1b(HIGH);
-    connect(copyHold, &HW_Bus_1_t::SignalBit0Updated, vib1, &IC_74xx123_t::ProcessUpdateRD1b);
+    connect(copyHold, &HW_Bus_1_t::SignalBit0Updated, vib1, &IC_74xx123_t::ProcessUpdateRD1b, CNN_TYPE);
 
     vib1->ProcessUpdateA2b(LOW);
-    connect(latch, &IC_74xx74_t::SignalQ1bUpdated, vib1, &IC_74xx123_t::ProcessUpdateB2);
+    connect(latch, &IC_74xx74_t::SignalQ1bUpdated, vib1, &IC_74xx123_t::ProcessUpdateB2, CNN_TYPE);
     vib1->ProcessUpdateRD2b(HIGH);
 
 
 
     // -- connect the LED
-    connect(or1, &IC_74xx32_t::SignalY3Updated, resetting, &GUI_Led_t::ProcessStateChange);
+    connect(or1, &IC_74xx32_t::SignalY3Updated, resetting, &GUI_Led_t::ProcessStateChange, CNN_TYPE);
 
 
     // -- connect the outputs
-    connect(or1, &IC_74xx32_t::SignalY4Updated, this, &ResetModule_t::SignalSystemClock);
-    connect(reset, &GUI_MomentarySwitch_t::SignalSwitchChanged, this, &ResetModule_t::SignalReset);
-    connect(nand2, &IC_74xx00_t::SignalY1Updated, this, &ResetModule_t::SignalResetting);
-    connect(nand3, &IC_74xx00_t::SignalY1Updated, this, &ResetModule_t::SignalClocking);
-    connect(nand3, &IC_74xx00_t::SignalY3Updated, this, &ResetModule_t::SignalRunning);
+    connect(or1, &IC_74xx32_t::SignalY4Updated, this, &ResetModule_t::SignalSystemClock, CNN_TYPE);
+    connect(reset, &GUI_MomentarySwitch_t::SignalSwitchChanged, this, &ResetModule_t::SignalReset, CNN_TYPE);
+    connect(nand2, &IC_74xx00_t::SignalY1Updated, this, &ResetModule_t::SignalResetting, CNN_TYPE);
+    connect(nand3, &IC_74xx00_t::SignalY1Updated, this, &ResetModule_t::SignalClocking, CNN_TYPE);
+    connect(nand3, &IC_74xx00_t::SignalY3Updated, this, &ResetModule_t::SignalRunning, CNN_TYPE);
     oNand1->setObjectName("Reset:oNand1");
-    connect(oNand1, &IC_74xx03_t::SignalY1Updated, HW_Computer_t::GetRHldBus(), &HW_Bus_1_t::ProcessUpdateBit0);
+    connect(oNand1, &IC_74xx03_t::SignalY1Updated, HW_Computer_t::GetRHldBus(), &HW_Bus_1_t::ProcessUpdateBit0, CNN_TYPE);
 
 
 
-    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalCpuClockLatch, this, &ResetModule_t::ProcessCpuClockLatch);
-    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalHighSpeedClockLatch, this, &ResetModule_t::ProcessHighSpeedClockLatch);
-    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalCpuClockOutput, this, &ResetModule_t::ProcessCpuClockOutput);
-    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalHighSpeedClockOutput, this, &ResetModule_t::ProcessHighSpeedClockOutput);
+    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalCpuClockLatch, this, &ResetModule_t::ProcessCpuClockLatch, CNN_TYPE);
+    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalHighSpeedClockLatch, this, &ResetModule_t::ProcessHighSpeedClockLatch, CNN_TYPE);
+    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalCpuClockOutput, this, &ResetModule_t::ProcessCpuClockOutput, CNN_TYPE);
+    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalHighSpeedClockOutput, this, &ResetModule_t::ProcessHighSpeedClockOutput, CNN_TYPE);
 }
 
 
@@ -59,13 +59,28 @@ HW_Bus_16_t *ControlLogic_MidPlane_t::ctrlBus = nullptr;
 ControlLogic_MidPlane_t::ControlLogic_MidPlane_t(void) : QGroupBox("Control ROM Mid-Plane")
 {
     AllocateComponents();
-    BuildGui();
+    if (!headless) BuildGui();
     WireUp();
     TriggerFirstUpdate();
 }
 
 
 
+//
+// -- Get one of the control ROMs, `ctrl0` through `ctrlf`
+//    ----------------------------------------------------
+CtrlRomModule_t *ControlLogic_MidPlane_t::GetCtrlRom(int i)
+{
+    CtrlRomModule_t *roms[CTRL_ROM_CNT] = {
+        ctrl0, ctrl1, ctrl2, ctrl3, ctrl4, ctrl5, ctrl6, ctrl7, ctrl8, ctrl9, ctrla, ctrlb, ctrlc, ctrld, ctrle, ctrlf,
+    };
+
+    if (i < 0 || i >= CTRL_ROM_CNT) return nullptr;
+    return roms[i];
+}
+
+
+
 //
 // -- Allocate all of the modules supported by this mid-plane
 //    -------------------------------------------------------
@@ -176,23 +191,26 @@ void ControlLogic_MidPlane_t::TriggerFirstUpdate(void)
 inline void ControlLogic_MidPlane_t::ProcessReset(TriState_t state)
 {
     ctrlCtrl->ProcessResetUpdate(state);
+}
+
+
 
-    ctrl0->ProcessCopyEeprom();
-    ctrl1->ProcessCopyEeprom();
-    ctrl2->ProcessCopyEeprom();
-    ctrl3->ProcessCopyEeprom();
-    ctrl4->ProcessCopyEeprom();
-    ctrl5->ProcessCopyEeprom();
-    ctrl6->ProcessCopyEeprom();
-    ctrl7->ProcessCopyEeprom();
-    ctrl8->ProcessCopyEeprom();
-    ctrl9->ProcessCopyEeprom();
-    ctrla->ProcessCopyEeprom();
-    ctrlb->ProcessCopyEeprom();
-    ctrlc->ProcessCopyEeprom();
-    ctrld->ProcessCopyEeprom();
-    ctrle->ProcessCopyEeprom();
-    ctrlf->ProcessCopyEeprom();
+//
+// -- Fast boot: copy every EEPROM into its SRAM in one step while #CPYHLD is held, checking each copy
+//    ------------------------------------------------------------------------------------------------
+void ControlLogic_MidPlane_t::ProcessFastBoot(void)
+{
+    CtrlRomModule_t *roms[] = {
+        ctrl0, ctrl1, ctrl2, ctrl3, ctrl4, ctrl5, ctrl6, ctrl7,
+        ctrl8, ctrl9, ctrla, ctrlb, ctrlc, ctrld, ctrle, ctrlf,
+    };
+
+    for (CtrlRomModule_t *rom : roms) {
+        if (!rom->ProcessCopyEeprom()) {
+            qDebug() << "ERROR!!!  " << rom->objectName() << "RAM checksum does not match the EEPROM after the fast boot copy!!!";
+            exit(EXIT_FAILURE);
+        }
+    }
 }
 
 
@@ -293,16 +311,16 @@ void ControlLogic_MidPlane_t::ProcessSanityCheck(TriState_t state)
 //    ----------------------------------------------------
 void ControlLogic_MidPlane_t::WireUpControlROM(CtrlRomModule_t *rom, CtrlRomCtrlModule_t *ctrl)
 {
-    connect(ctrl, &CtrlRomCtrlModule_t::SignalEepromCsUpdated, rom, &CtrlRomModule_t::ProcessUpdateChipSelect);
-    connect(ctrl, &CtrlRomCtrlModule_t::SignalEepromCmdAddrUpdated, rom, &CtrlRomModule_t::ProcessUpdateCmdAddr);
-    connect(ctrl, &CtrlRomCtrlModule_t::SignalQcUpdated, rom, &CtrlRomModule_t::ProcessUpdateLatchOe);
-    connect(ctrl, &CtrlRomCtrlModule_t::SignalQcbUpdated, rom, &CtrlRomModule_t::ProcessUpdateDriverOe);
-    connect(ctrl, &CtrlRomCtrlModule_t::SignalQrbUpdated, rom, &CtrlRomModule_t::ProcessUpdateClear);
-    connect(ctrl, &CtrlRomCtrlModule_t::SignalShiftClockUpdated, rom, &CtrlRomModule_t::ProcessUpdateShiftClk);
+    connect(ctrl, &CtrlRomCtrlModule_t::SignalEepromCsUpdated, rom, &CtrlRomModule_t::ProcessUpdateChipSelect, CNN_TYPE);
+    connect(ctrl, &CtrlRomCtrlModule_t::SignalEepromCmdAddrUpdated, rom, &CtrlRomModule_t::ProcessUpdateCmdAddr, CNN_TYPE);
+    connect(ctrl, &CtrlRomCtrlModule_t::SignalQcUpdated, rom, &CtrlRomModule_t::ProcessUpdateLatchOe, CNN_TYPE);
+    connect(ctrl, &CtrlRomCtrlModule_t::SignalQcbUpdated, rom, &CtrlRomModule_t::ProcessUpdateDriverOe, CNN_TYPE);
+    connect(ctrl, &CtrlRomCtrlModule_t::SignalQrbUpdated, rom, &CtrlRomModule_t::ProcessUpdateClear, CNN_TYPE);
+    connect(ctrl, &CtrlRomCtrlModule_t::SignalShiftClockUpdated, rom, &CtrlRomModule_t::ProcessUpdateShiftClk, CNN_TYPE);
     // cpu clock above
-    connect(ctrl, &CtrlRomCtrlModule_t::SignalSramWeUpdated, rom, &CtrlRomModule_t::ProcessUpdateWriteEnable);
-    connect(ctrl, &CtrlRomCtrlModule_t::SignalSramOeUpdated, rom, &CtrlRomModule_t::ProcessUpdateOutputEnable);
-    connect(ctrl, &CtrlRomCtrlModule_t::SignalSramCeUpdated, rom, &CtrlRomModule_t::ProcessUpdateChipEnable);
+    connect(ctrl, &CtrlRomCtrlModule_t::SignalSramWeUpdated, rom, &CtrlRomModule_t::ProcessUpdateWriteEnable, CNN_TYPE);
+    connect(ctrl, &CtrlRomCtrlModule_t::SignalSramOeUpdated, rom, &CtrlRomModule_t::ProcessUpdateOutputEnable, CNN_TYPE);
+    connect(ctrl, &CtrlRomCtrlModule_t::SignalSramCeUpdated, rom, &CtrlRomModule_t::ProcessUpdateChipEnable, CNN_TYPE);
 }
 
 
@@ -314,6 +332,7 @@ void ControlLogic_MidPlane_t::WireUp(void)
     // -- Control ROM Control Module inputs
     // Raw System Clock (above)
     // Reset (above)
+    connect(ctrlCtrl, &CtrlRomCtrlModule_t::CopyEeprom, this, &ControlLogic_MidPlane_t::ProcessFastBoot, CNN_TYPE);
 
 
     // -- Control ROM Modules
@@ -336,342 +355,342 @@ void ControlLogic_MidPlane_t::WireUp(void)
 
 
     // -- Demux sub-modules; ctrl0
-    connect(ctrl0, &CtrlRomModule_t::SignalBit0Updated, addr1Demux, &SubDemux3_t::ProcessUpdateA);
-    connect(ctrl0, &CtrlRomModule_t::SignalBit1Updated, addr1Demux, &SubDemux3_t::ProcessUpdateB);
+    connect(ctrl0, &CtrlRomModule_t::SignalBit0Updated, addr1Demux, &SubDemux3_t::ProcessUpdateA, CNN_TYPE);
+    connect(ctrl0, &CtrlRomModule_t::SignalBit1Updated, addr1Demux, &SubDemux3_t::ProcessUpdateB, CNN_TYPE);
     addr1Demux->ProcessUpdateC(LOW);
 
     // -- ctrl1
-    connect(ctrl1, &CtrlRomModule_t::SignalBit0Updated, addr2Demux, &SubDemux4_t::ProcessUpdateA);
-    connect(ctrl1, &CtrlRomModule_t::SignalBit1Updated, addr2Demux, &SubDemux4_t::ProcessUpdateB);
-    connect(ctrl1, &CtrlRomModule_t::SignalBit2Updated, addr2Demux, &SubDemux4_t::ProcessUpdateC);
-    connect(ctrl1, &CtrlRomModule_t::SignalBit3Updated, addr2Demux, &SubDemux4_t::ProcessUpdateD);
+    connect(ctrl1, &CtrlRomModule_t::SignalBit0Updated, addr2Demux, &SubDemux4_t::ProcessUpdateA, CNN_TYPE);
+    connect(ctrl1, &CtrlRomModule_t::SignalBit1Updated, addr2Demux, &SubDemux4_t::ProcessUpdateB, CNN_TYPE);
+    connect(ctrl1, &CtrlRomModule_t::SignalBit2Updated, addr2Demux, &SubDemux4_t::ProcessUpdateC, CNN_TYPE);
+    connect(ctrl1, &CtrlRomModule_t::SignalBit3Updated, addr2Demux, &SubDemux4_t::ProcessUpdateD, CNN_TYPE);
 
     // -- ctrl2
-    connect(ctrl2, &CtrlRomModule_t::SignalBit0Updated, aluADemux, &SubDemux4_t::ProcessUpdateA);
-    connect(ctrl2, &CtrlRomModule_t::SignalBit1Updated, aluADemux, &SubDemux4_t::ProcessUpdateB);
-    connect(ctrl2, &CtrlRomModule_t::SignalBit2Updated, aluADemux, &SubDemux4_t::ProcessUpdateC);
-    connect(ctrl2, &CtrlRomModule_t::SignalBit3Updated, aluADemux, &SubDemux4_t::ProcessUpdateD);
+    connect(ctrl2, &CtrlRomModule_t::SignalBit0Updated, aluADemux, &SubDemux4_t::ProcessUpdateA, CNN_TYPE);
+    connect(ctrl2, &CtrlRomModule_t::SignalBit1Updated, aluADemux, &SubDemux4_t::ProcessUpdateB, CNN_TYPE);
+    connect(ctrl2, &CtrlRomModule_t::SignalBit2Updated, aluADemux, &SubDemux4_t::ProcessUpdateC, CNN_TYPE);
+    connect(ctrl2, &CtrlRomModule_t::SignalBit3Updated, aluADemux, &SubDemux4_t::ProcessUpdateD, CNN_TYPE);
 
     // -- ctrl3
-    connect(ctrl3, &CtrlRomModule_t::SignalBit0Updated, aluBDemux, &SubDemux4_t::ProcessUpdateA);
-    connect(ctrl3, &CtrlRomModule_t::SignalBit1Updated, aluBDemux, &SubDemux4_t::ProcessUpdateB);
-    connect(ctrl3, &CtrlRomModule_t::SignalBit2Updated, aluBDemux, &SubDemux4_t::ProcessUpdateC);
-    connect(ctrl3, &CtrlRomModule_t::SignalBit3Updated, aluBDemux, &SubDemux4_t::ProcessUpdateD);
+    connect(ctrl3, &CtrlRomModule_t::SignalBit0Updated, aluBDemux, &SubDemux4_t::ProcessUpdateA, CNN_TYPE);
+    connect(ctrl3, &CtrlRomModule_t::SignalBit1Updated, aluBDemux, &SubDemux4_t::ProcessUpdateB, CNN_TYPE);
+    connect(ctrl3, &CtrlRomModule_t::SignalBit2Updated, aluBDemux, &SubDemux4_t::ProcessUpdateC, CNN_TYPE);
+    connect(ctrl3, &CtrlRomModule_t::SignalBit3Updated, aluBDemux, &SubDemux4_t::ProcessUpdateD, CNN_TYPE);
 
     // -- ctrl4
-    connect(ctrl4, &CtrlRomModule_t::SignalBit0Updated, mainDemux, &SubDemux7_t::ProcessUpdateA);
-    connect(ctrl4, &CtrlRomModule_t::SignalBit1Updated, mainDemux, &SubDemux7_t::ProcessUpdateB);
-    connect(ctrl4, &CtrlRomModule_t::SignalBit2Updated, mainDemux, &SubDemux7_t::ProcessUpdateC);
-    connect(ctrl4, &CtrlRomModule_t::SignalBit3Updated, mainDemux, &SubDemux7_t::ProcessUpdateD);
-    connect(ctrl4, &CtrlRomModule_t::SignalBit4Updated, mainDemux, &SubDemux7_t::ProcessUpdateE);
-    connect(ctrl4, &CtrlRomModule_t::SignalBit5Updated, mainDemux, &SubDemux7_t::ProcessUpdateF);
-    connect(ctrl4, &CtrlRomModule_t::SignalBit6Updated, mainDemux, &SubDemux7_t::ProcessUpdateG);
+    connect(ctrl4, &CtrlRomModule_t::SignalBit0Updated, mainDemux, &SubDemux7_t::ProcessUpdateA, CNN_TYPE);
+    connect(ctrl4, &CtrlRomModule_t::SignalBit1Updated, mainDemux, &SubDemux7_t::ProcessUpdateB, CNN_TYPE);
+    connect(ctrl4, &CtrlRomModule_t::SignalBit2Updated, mainDemux, &SubDemux7_t::ProcessUpdateC, CNN_TYPE);
+    connect(ctrl4, &CtrlRomModule_t::SignalBit3Updated, mainDemux, &SubDemux7_t::ProcessUpdateD, CNN_TYPE);
+    connect(ctrl4, &CtrlRomModule_t::SignalBit4Updated, mainDemux, &SubDemux7_t::ProcessUpdateE, CNN_TYPE);
+    connect(ctrl4, &CtrlRomModule_t::SignalBit5Updated, mainDemux, &SubDemux7_t::ProcessUpdateF, CNN_TYPE);
+    connect(ctrl4, &CtrlRomModule_t::SignalBit6Updated, mainDemux, &SubDemux7_t::ProcessUpdateG, CNN_TYPE);
 
     // -- ctrl5
-    connect(ctrl5, &CtrlRomModule_t::SignalBit0Updated, carrySelectDemux, &SubDemux3_t::ProcessUpdateA);
-    connect(ctrl5, &CtrlRomModule_t::SignalBit1Updated, carrySelectDemux, &SubDemux3_t::ProcessUpdateB);
+    connect(ctrl5, &CtrlRomModule_t::SignalBit0Updated, carrySelectDemux, &SubDemux3_t::ProcessUpdateA, CNN_TYPE);
+    connect(ctrl5, &CtrlRomModule_t::SignalBit1Updated, carrySelectDemux, &SubDemux3_t::ProcessUpdateB, CNN_TYPE);
     carrySelectDemux->ProcessUpdateC(LOW);
 
     // -- ctrl6
-    connect(ctrl6, &CtrlRomModule_t::SignalBit0Updated, shiftDemux, &SubDemux3_t::ProcessUpdateA);
-    connect(ctrl6, &CtrlRomModule_t::SignalBit1Updated, shiftDemux, &SubDemux3_t::ProcessUpdateB);
-    connect(ctrl6, &CtrlRomModule_t::SignalBit2Updated, shiftDemux, &SubDemux3_t::ProcessUpdateC);
+    connect(ctrl6, &CtrlRomModule_t::SignalBit0Updated, shiftDemux, &SubDemux3_t::ProcessUpdateA, CNN_TYPE);
+    connect(ctrl6, &CtrlRomModule_t::SignalBit1Updated, shiftDemux, &SubDemux3_t::ProcessUpdateB, CNN_TYPE);
+    connect(ctrl6, &CtrlRomModule_t::SignalBit2Updated, shiftDemux, &SubDemux3_t::ProcessUpdateC, CNN_TYPE);
 
 
 
     // -- Wire up all the signal outputs for each control rom; ctrl0
-    connect(ctrl0, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalUpdateCLC);
-    connect(ctrl0, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalUpdateSTC);
-    connect(ctrl0, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalUpdatePgmZLatch);
-    connect(ctrl0, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalUpdateIntZLatch);
-    connect(ctrl0, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalUpdatePgmCLatch);
-    connect(ctrl0, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalUpdateIntCLatch);
-    connect(addr1Demux, &SubDemux3_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus1AssertPgmPC);
-    connect(addr1Demux, &SubDemux3_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus1AssertPgmRA);
-    connect(addr1Demux, &SubDemux3_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus1AssertIntPC);
-    connect(addr1Demux, &SubDemux3_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus1AssertIntRA);
+    connect(ctrl0, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalUpdateCLC, CNN_TYPE);
+    connect(ctrl0, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalUpdateSTC, CNN_TYPE);
+    connect(ctrl0, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalUpdatePgmZLatch, CNN_TYPE);
+    connect(ctrl0, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalUpdateIntZLatch, CNN_TYPE);
+    connect(ctrl0, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalUpdatePgmCLatch, CNN_TYPE);
+    connect(ctrl0, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalUpdateIntCLatch, CNN_TYPE);
+    connect(addr1Demux, &SubDemux3_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus1AssertPgmPC, CNN_TYPE);
+    connect(addr1Demux, &SubDemux3_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus1AssertPgmRA, CNN_TYPE);
+    connect(addr1Demux, &SubDemux3_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus1AssertIntPC, CNN_TYPE);
+    connect(addr1Demux, &SubDemux3_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus1AssertIntRA, CNN_TYPE);
 
 
     // -- ctrl1
-    connect(ctrl1, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalUpdatePgmNLatch);
-    connect(ctrl1, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalUpdateIntNLatch);
-    connect(ctrl1, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalUpdatePgmVLatch);
-    connect(ctrl1, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalUpdateIntVLatch);
-    connect(addr2Demux, &SubDemux4_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertNone);
-    connect(addr2Demux, &SubDemux4_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR1);
-    connect(addr2Demux, &SubDemux4_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR2);
-    connect(addr2Demux, &SubDemux4_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR3);
-    connect(addr2Demux, &SubDemux4_t::SignalY4Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR4);
-    connect(addr2Demux, &SubDemux4_t::SignalY5Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR5);
-    connect(addr2Demux, &SubDemux4_t::SignalY6Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR6);
-    connect(addr2Demux, &SubDemux4_t::SignalY7Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR7);
-    connect(addr2Demux, &SubDemux4_t::SignalY8Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR8);
-    connect(addr2Demux, &SubDemux4_t::SignalY9Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR9);
-    connect(addr2Demux, &SubDemux4_t::SignalYAUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR10);
-    connect(addr2Demux, &SubDemux4_t::SignalYBUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR11);
-    connect(addr2Demux, &SubDemux4_t::SignalYCUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR12);
-    connect(addr2Demux, &SubDemux4_t::SignalYDUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertFetch);
-    connect(addr2Demux, &SubDemux4_t::SignalYEUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertPgmSP);
-    connect(addr2Demux, &SubDemux4_t::SignalYFUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertIntSP);
+    connect(ctrl1, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalUpdatePgmNLatch, CNN_TYPE);
+    connect(ctrl1, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalUpdateIntNLatch, CNN_TYPE);
+    connect(ctrl1, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalUpdatePgmVLatch, CNN_TYPE);
+    connect(ctrl1, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalUpdateIntVLatch, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertNone, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR1, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR2, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR3, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalY4Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR4, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalY5Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR5, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalY6Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR6, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalY7Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR7, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalY8Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR8, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalY9Updated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR9, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalYAUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR10, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalYBUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR11, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalYCUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertR12, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalYDUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertFetch, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalYEUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertPgmSP, CNN_TYPE);
+    connect(addr2Demux, &SubDemux4_t::SignalYFUpdated, this, &ControlLogic_MidPlane_t::SignalAddrBus2AssertIntSP, CNN_TYPE);
 
 
     // -- ctrl2
-    connect(ctrl2, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalUpdatePgmLLatch);
-    connect(ctrl2, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalUpdateIntLLatch);
-    connect(ctrl2, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalUpdateCLV);
-    connect(ctrl2, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalUpdateSTC);
-    connect(aluADemux, &SubDemux4_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertNone);
-    connect(aluADemux, &SubDemux4_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR1);
-    connect(aluADemux, &SubDemux4_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR2);
-    connect(aluADemux, &SubDemux4_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR3);
-    connect(aluADemux, &SubDemux4_t::SignalY4Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR4);
-    connect(aluADemux, &SubDemux4_t::SignalY5Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR5);
-    connect(aluADemux, &SubDemux4_t::SignalY6Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR6);
-    connect(aluADemux, &SubDemux4_t::SignalY7Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR7);
-    connect(aluADemux, &SubDemux4_t::SignalY8Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR8);
-    connect(aluADemux, &SubDemux4_t::SignalY9Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR9);
-    connect(aluADemux, &SubDemux4_t::SignalYAUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR10);
-    connect(aluADemux, &SubDemux4_t::SignalYBUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR11);
-    connect(aluADemux, &SubDemux4_t::SignalYCUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR12);
+    connect(ctrl2, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalUpdatePgmLLatch, CNN_TYPE);
+    connect(ctrl2, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalUpdateIntLLatch, CNN_TYPE);
+    connect(ctrl2, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalUpdateCLV, CNN_TYPE);
+    connect(ctrl2, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalUpdateSTC, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertNone, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR1, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR2, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR3, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY4Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR4, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY5Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR5, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY6Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR6, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY7Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR7, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY8Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR8, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY9Updated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR9, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalYAUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR10, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalYBUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR11, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalYCUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertR12, CNN_TYPE);
     // 0b1101 is unused
-    connect(aluADemux, &SubDemux4_t::SignalYEUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertPgmSP);
-    connect(aluADemux, &SubDemux4_t::SignalYFUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertIntSP);
+    connect(aluADemux, &SubDemux4_t::SignalYEUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertPgmSP, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalYFUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusAAssertIntSP, CNN_TYPE);
 
 
     // -- ctrl3
-    connect(ctrl3, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalALULogicResultBit3);
-    connect(ctrl3, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalALULogicResultBit2);
-    connect(ctrl3, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalALULogicResultBit1);
-    connect(ctrl3, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalALULogicResultBit0);
-    connect(aluADemux, &SubDemux4_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertNone);
-    connect(aluADemux, &SubDemux4_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR1);
-    connect(aluADemux, &SubDemux4_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR2);
-    connect(aluADemux, &SubDemux4_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR3);
-    connect(aluADemux, &SubDemux4_t::SignalY4Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR4);
-    connect(aluADemux, &SubDemux4_t::SignalY5Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR5);
-    connect(aluADemux, &SubDemux4_t::SignalY6Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR6);
-    connect(aluADemux, &SubDemux4_t::SignalY7Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR7);
-    connect(aluADemux, &SubDemux4_t::SignalY8Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR8);
-    connect(aluADemux, &SubDemux4_t::SignalY9Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR9);
-    connect(aluADemux, &SubDemux4_t::SignalYAUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR10);
-    connect(aluADemux, &SubDemux4_t::SignalYBUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR11);
-    connect(aluADemux, &SubDemux4_t::SignalYCUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR12);
-    connect(aluADemux, &SubDemux4_t::SignalYCUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertFetch);
-    connect(aluADemux, &SubDemux4_t::SignalYEUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertPgmSP);
-    connect(aluADemux, &SubDemux4_t::SignalYFUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertIntSP);
+    connect(ctrl3, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalALULogicResultBit3, CNN_TYPE);
+    connect(ctrl3, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalALULogicResultBit2, CNN_TYPE);
+    connect(ctrl3, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalALULogicResultBit1, CNN_TYPE);
+    connect(ctrl3, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalALULogicResultBit0, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertNone, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR1, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR2, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR3, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY4Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR4, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY5Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR5, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY6Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR6, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY7Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR7, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY8Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR8, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalY9Updated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR9, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalYAUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR10, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalYBUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR11, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalYCUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertR12, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalYCUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertFetch, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalYEUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertPgmSP, CNN_TYPE);
+    connect(aluADemux, &SubDemux4_t::SignalYFUpdated, this, &ControlLogic_MidPlane_t::SignalALUBusBAssertIntSP, CNN_TYPE);
 
 
     // -- ctrl4
-    connect(ctrl4, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalInstructionSuppress);
-    connect(mainDemux, &SubDemux7_t::SignalY000Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertNone);
-    connect(mainDemux, &SubDemux7_t::SignalY001Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR1);
-    connect(mainDemux, &SubDemux7_t::SignalY002Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR2);
-    connect(mainDemux, &SubDemux7_t::SignalY003Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR3);
-    connect(mainDemux, &SubDemux7_t::SignalY004Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR4);
-    connect(mainDemux, &SubDemux7_t::SignalY005Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR5);
-    connect(mainDemux, &SubDemux7_t::SignalY006Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR6);
-    connect(mainDemux, &SubDemux7_t::SignalY007Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR7);
-    connect(mainDemux, &SubDemux7_t::SignalY010Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR8);
-    connect(mainDemux, &SubDemux7_t::SignalY011Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR9);
-    connect(mainDemux, &SubDemux7_t::SignalY012Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR10);
-    connect(mainDemux, &SubDemux7_t::SignalY013Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR11);
-    connect(mainDemux, &SubDemux7_t::SignalY014Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR12);
-    connect(mainDemux, &SubDemux7_t::SignalY015Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertPgmSP);
-    connect(mainDemux, &SubDemux7_t::SignalY016Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertPgmRA);
-    connect(mainDemux, &SubDemux7_t::SignalY017Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertPgmPC);
-    connect(mainDemux, &SubDemux7_t::SignalY020Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertIntSP);
-    connect(mainDemux, &SubDemux7_t::SignalY021Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertIntRA);
-    connect(mainDemux, &SubDemux7_t::SignalY022Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertIntPC);
-    connect(mainDemux, &SubDemux7_t::SignalY023Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertFetch);
-    connect(mainDemux, &SubDemux7_t::SignalY024Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev01);
-    connect(mainDemux, &SubDemux7_t::SignalY025Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev02);
-    connect(mainDemux, &SubDemux7_t::SignalY026Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev03);
-    connect(mainDemux, &SubDemux7_t::SignalY027Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev04);
-    connect(mainDemux, &SubDemux7_t::SignalY030Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev05);
-    connect(mainDemux, &SubDemux7_t::SignalY031Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev06);
-    connect(mainDemux, &SubDemux7_t::SignalY032Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev07);
-    connect(mainDemux, &SubDemux7_t::SignalY033Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev08);
-    connect(mainDemux, &SubDemux7_t::SignalY034Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev09);
-    connect(mainDemux, &SubDemux7_t::SignalY035Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev10);
-    connect(mainDemux, &SubDemux7_t::SignalY036Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertALUResult);
-    connect(mainDemux, &SubDemux7_t::SignalY037Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertMemory);
-    connect(mainDemux, &SubDemux7_t::SignalY044Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl01);
-    connect(mainDemux, &SubDemux7_t::SignalY045Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl02);
-    connect(mainDemux, &SubDemux7_t::SignalY046Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl03);
-    connect(mainDemux, &SubDemux7_t::SignalY047Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl04);
-    connect(mainDemux, &SubDemux7_t::SignalY050Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl05);
-    connect(mainDemux, &SubDemux7_t::SignalY051Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl06);
-    connect(mainDemux, &SubDemux7_t::SignalY052Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl07);
-    connect(mainDemux, &SubDemux7_t::SignalY053Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl08);
-    connect(mainDemux, &SubDemux7_t::SignalY054Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl09);
-    connect(mainDemux, &SubDemux7_t::SignalY055Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl10);
-    connect(mainDemux, &SubDemux7_t::SignalY101Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR1);
-    connect(mainDemux, &SubDemux7_t::SignalY102Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR2);
-    connect(mainDemux, &SubDemux7_t::SignalY103Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR3);
-    connect(mainDemux, &SubDemux7_t::SignalY104Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR4);
-    connect(mainDemux, &SubDemux7_t::SignalY105Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR5);
-    connect(mainDemux, &SubDemux7_t::SignalY106Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR6);
-    connect(mainDemux, &SubDemux7_t::SignalY107Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR7);
-    connect(mainDemux, &SubDemux7_t::SignalY110Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR8);
-    connect(mainDemux, &SubDemux7_t::SignalY111Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR9);
-    connect(mainDemux, &SubDemux7_t::SignalY112Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR10);
-    connect(mainDemux, &SubDemux7_t::SignalY113Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR11);
-    connect(mainDemux, &SubDemux7_t::SignalY114Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR12);
-    connect(mainDemux, &SubDemux7_t::SignalY115Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapPgmSP);
-    connect(mainDemux, &SubDemux7_t::SignalY116Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapPgmRA);
-    connect(mainDemux, &SubDemux7_t::SignalY117Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapPgmPC);
-    connect(mainDemux, &SubDemux7_t::SignalY120Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapIntSP);
-    connect(mainDemux, &SubDemux7_t::SignalY121Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapIntRA);
-    connect(mainDemux, &SubDemux7_t::SignalY122Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapIntPC);
-    connect(mainDemux, &SubDemux7_t::SignalY123Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapFetch);
-    connect(mainDemux, &SubDemux7_t::SignalY124Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev01);
-    connect(mainDemux, &SubDemux7_t::SignalY125Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev02);
-    connect(mainDemux, &SubDemux7_t::SignalY126Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev03);
-    connect(mainDemux, &SubDemux7_t::SignalY127Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev04);
-    connect(mainDemux, &SubDemux7_t::SignalY130Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev05);
-    connect(mainDemux, &SubDemux7_t::SignalY131Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev06);
-    connect(mainDemux, &SubDemux7_t::SignalY132Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev07);
-    connect(mainDemux, &SubDemux7_t::SignalY133Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev08);
-    connect(mainDemux, &SubDemux7_t::SignalY134Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev09);
-    connect(mainDemux, &SubDemux7_t::SignalY135Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev10);
-    connect(mainDemux, &SubDemux7_t::SignalY136Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapALUResult);
-    connect(mainDemux, &SubDemux7_t::SignalY137Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapMemory);
-    connect(mainDemux, &SubDemux7_t::SignalY144Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl01);
-    connect(mainDemux, &SubDemux7_t::SignalY145Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl02);
-    connect(mainDemux, &SubDemux7_t::SignalY146Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl03);
-    connect(mainDemux, &SubDemux7_t::SignalY147Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl04);
-    connect(mainDemux, &SubDemux7_t::SignalY150Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl05);
-    connect(mainDemux, &SubDemux7_t::SignalY151Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl06);
-    connect(mainDemux, &SubDemux7_t::SignalY152Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl07);
-    connect(mainDemux, &SubDemux7_t::SignalY153Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl08);
-    connect(mainDemux, &SubDemux7_t::SignalY154Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl09);
-    connect(mainDemux, &SubDemux7_t::SignalY155Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl10);
+    connect(ctrl4, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalInstructionSuppress, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY000Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertNone, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY001Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR1, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY002Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR2, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY003Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR3, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY004Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR4, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY005Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR5, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY006Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR6, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY007Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR7, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY010Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR8, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY011Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR9, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY012Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR10, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY013Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR11, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY014Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertR12, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY015Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertPgmSP, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY016Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertPgmRA, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY017Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertPgmPC, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY020Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertIntSP, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY021Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertIntRA, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY022Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertIntPC, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY023Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertFetch, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY024Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev01, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY025Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev02, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY026Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev03, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY027Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev04, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY030Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev05, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY031Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev06, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY032Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev07, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY033Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev08, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY034Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev09, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY035Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertDev10, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY036Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertALUResult, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY037Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertMemory, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY044Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl01, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY045Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl02, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY046Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl03, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY047Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl04, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY050Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl05, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY051Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl06, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY052Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl07, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY053Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl08, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY054Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl09, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY055Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertCtl10, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY101Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR1, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY102Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR2, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY103Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR3, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY104Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR4, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY105Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR5, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY106Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR6, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY107Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR7, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY110Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR8, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY111Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR9, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY112Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR10, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY113Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR11, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY114Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapR12, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY115Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapPgmSP, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY116Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapPgmRA, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY117Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapPgmPC, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY120Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapIntSP, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY121Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapIntRA, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY122Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapIntPC, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY123Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapFetch, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY124Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev01, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY125Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev02, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY126Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev03, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY127Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev04, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY130Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev05, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY131Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev06, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY132Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev07, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY133Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev08, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY134Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev09, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY135Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapDev10, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY136Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapALUResult, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY137Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapMemory, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY144Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl01, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY145Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl02, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY146Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl03, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY147Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl04, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY150Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl05, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY151Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl06, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY152Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl07, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY153Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl08, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY154Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl09, CNN_TYPE);
+    connect(mainDemux, &SubDemux7_t::SignalY155Updated, this, &ControlLogic_MidPlane_t::SignalMainBusAssertSwapCtl10, CNN_TYPE);
 
 
     // -- ctrl5
     // Bits 7:2 are unused
-    connect(carrySelectDemux, &SubDemux3_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalCarrySelect0);
-    connect(carrySelectDemux, &SubDemux3_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalCarrySelectLast);
-    connect(carrySelectDemux, &SubDemux3_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalCarrySelectInverted);
-    connect(carrySelectDemux, &SubDemux3_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalCarrySelect1);
+    connect(carrySelectDemux, &SubDemux3_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalCarrySelect0, CNN_TYPE);
+    connect(carrySelectDemux, &SubDemux3_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalCarrySelectLast, CNN_TYPE);
+    connect(carrySelectDemux, &SubDemux3_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalCarrySelectInverted, CNN_TYPE);
+    connect(carrySelectDemux, &SubDemux3_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalCarrySelect1, CNN_TYPE);
 
 
     // -- ctrl6
     // Bits 7:6 are unused
-    connect(ctrl6, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalBreak);
-    connect(ctrl6, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalLeaveIntContext);
-    connect(ctrl6, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalFetchSuppress);
-    connect(shiftDemux, &SubDemux3_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalAluShiftNone);
-    connect(shiftDemux, &SubDemux3_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalAluArighShiftLeft);
-    connect(shiftDemux, &SubDemux3_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalAluArighShiftRight);
-    connect(shiftDemux, &SubDemux3_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalAluLogicShiftLeft);
-    connect(shiftDemux, &SubDemux3_t::SignalY4Updated, this, &ControlLogic_MidPlane_t::SignalAluRotateCarryLeft);
-    connect(shiftDemux, &SubDemux3_t::SignalY5Updated, this, &ControlLogic_MidPlane_t::SignalAluRotateCarryRight);
-    connect(shiftDemux, &SubDemux3_t::SignalY6Updated, this, &ControlLogic_MidPlane_t::SignalAluRotateLeft);
-    connect(shiftDemux, &SubDemux3_t::SignalY7Updated, this, &ControlLogic_MidPlane_t::SignalAluRotateRight);
+    connect(ctrl6, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalBreak, CNN_TYPE);
+    connect(ctrl6, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalLeaveIntContext, CNN_TYPE);
+    connect(ctrl6, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalFetchSuppress, CNN_TYPE);
+    connect(shiftDemux, &SubDemux3_t::SignalY0Updated, this, &ControlLogic_MidPlane_t::SignalAluShiftNone, CNN_TYPE);
+    connect(shiftDemux, &SubDemux3_t::SignalY1Updated, this, &ControlLogic_MidPlane_t::SignalAluArighShiftLeft, CNN_TYPE);
+    connect(shiftDemux, &SubDemux3_t::SignalY2Updated, this, &ControlLogic_MidPlane_t::SignalAluArighShiftRight, CNN_TYPE);
+    connect(shiftDemux, &SubDemux3_t::SignalY3Updated, this, &ControlLogic_MidPlane_t::SignalAluLogicShiftLeft, CNN_TYPE);
+    connect(shiftDemux, &SubDemux3_t::SignalY4Updated, this, &ControlLogic_MidPlane_t::SignalAluRotateCarryLeft, CNN_TYPE);
+    connect(shiftDemux, &SubDemux3_t::SignalY5Updated, this, &ControlLogic_MidPlane_t::SignalAluRotateCarryRight, CNN_TYPE);
+    connect(shiftDemux, &SubDemux3_t::SignalY6Updated, this, &ControlLogic_MidPlane_t::SignalAluRotateLeft, CNN_TYPE);
+    connect(shiftDemux, &SubDemux3_t::SignalY7Updated, this, &ControlLogic_MidPlane_t::SignalAluRotateRight, CNN_TYPE);
 
 
     // -- ctrl7
-    connect(ctrl7, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalPgmPCInc);
-    connect(ctrl7, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalPgmPCLoad);
-    connect(ctrl7, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalPgmRAInc);
-    connect(ctrl7, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalPgmRALoad);
-    connect(ctrl7, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalIntPCInc);
-    connect(ctrl7, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalIntPCLoad);
-    connect(ctrl7, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalIntRAInc);
-    connect(ctrl7, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalIntRALoad);
+    connect(ctrl7, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalPgmPCInc, CNN_TYPE);
+    connect(ctrl7, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalPgmPCLoad, CNN_TYPE);
+    connect(ctrl7, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalPgmRAInc, CNN_TYPE);
+    connect(ctrl7, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalPgmRALoad, CNN_TYPE);
+    connect(ctrl7, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalIntPCInc, CNN_TYPE);
+    connect(ctrl7, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalIntPCLoad, CNN_TYPE);
+    connect(ctrl7, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalIntRAInc, CNN_TYPE);
+    connect(ctrl7, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalIntRALoad, CNN_TYPE);
 
 
     // -- ctrl8
-    connect(ctrl8, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalPgmSPLoad);
-    connect(ctrl8, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalPgmSPInc);
-    connect(ctrl8, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalPgmSPDec);
-    connect(ctrl8, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalIntSPLoad);
-    connect(ctrl8, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalIntSPInc);
-    connect(ctrl8, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalIntSPDec);
-    connect(ctrl8, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalAluSubtract);
-    connect(ctrl8, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalMemoryWrite);
+    connect(ctrl8, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalPgmSPLoad, CNN_TYPE);
+    connect(ctrl8, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalPgmSPInc, CNN_TYPE);
+    connect(ctrl8, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalPgmSPDec, CNN_TYPE);
+    connect(ctrl8, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalIntSPLoad, CNN_TYPE);
+    connect(ctrl8, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalIntSPInc, CNN_TYPE);
+    connect(ctrl8, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalIntSPDec, CNN_TYPE);
+    connect(ctrl8, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalAluSubtract, CNN_TYPE);
+    connect(ctrl8, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalMemoryWrite, CNN_TYPE);
 
 
     // -- ctrl9
-    connect(ctrl9, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalR1Load);
-    connect(ctrl9, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SingalR1Inc);
-    connect(ctrl9, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SingalR1Dec);
-    connect(ctrl9, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalR2Load);
-    connect(ctrl9, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SingalR2Inc);
-    connect(ctrl9, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SingalR2Dec);
-    connect(ctrl9, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalR3Load);
-    connect(ctrl9, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SingalR3Inc);
+    connect(ctrl9, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalR1Load, CNN_TYPE);
+    connect(ctrl9, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SingalR1Inc, CNN_TYPE);
+    connect(ctrl9, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SingalR1Dec, CNN_TYPE);
+    connect(ctrl9, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalR2Load, CNN_TYPE);
+    connect(ctrl9, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SingalR2Inc, CNN_TYPE);
+    connect(ctrl9, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SingalR2Dec, CNN_TYPE);
+    connect(ctrl9, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalR3Load, CNN_TYPE);
+    connect(ctrl9, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SingalR3Inc, CNN_TYPE);
 
 
     // -- ctrl10
-    connect(ctrla, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SingalR3Dec);
-    connect(ctrla, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalR4Load);
-    connect(ctrla, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SingalR4Inc);
-    connect(ctrla, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SingalR4Dec);
-    connect(ctrla, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalR5Load);
-    connect(ctrla, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SingalR5Inc);
-    connect(ctrla, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SingalR5Dec);
-    connect(ctrla, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalR6Load);
+    connect(ctrla, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SingalR3Dec, CNN_TYPE);
+    connect(ctrla, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalR4Load, CNN_TYPE);
+    connect(ctrla, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SingalR4Inc, CNN_TYPE);
+    connect(ctrla, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SingalR4Dec, CNN_TYPE);
+    connect(ctrla, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalR5Load, CNN_TYPE);
+    connect(ctrla, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SingalR5Inc, CNN_TYPE);
+    connect(ctrla, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SingalR5Dec, CNN_TYPE);
+    connect(ctrla, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalR6Load, CNN_TYPE);
 
 
     // -- ctrl11
-    connect(ctrlb, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SingalR6Inc);
-    connect(ctrlb, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SingalR6Dec);
-    connect(ctrlb, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalR7Load);
-    connect(ctrlb, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SingalR7Inc);
-    connect(ctrlb, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SingalR7Dec);
-    connect(ctrlb, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalR8Load);
-    connect(ctrlb, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SingalR8Inc);
-    connect(ctrlb, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SingalR8Dec);
+    connect(ctrlb, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SingalR6Inc, CNN_TYPE);
+    connect(ctrlb, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SingalR6Dec, CNN_TYPE);
+    connect(ctrlb, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalR7Load, CNN_TYPE);
+    connect(ctrlb, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SingalR7Inc, CNN_TYPE);
+    connect(ctrlb, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SingalR7Dec, CNN_TYPE);
+    connect(ctrlb, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalR8Load, CNN_TYPE);
+    connect(ctrlb, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SingalR8Inc, CNN_TYPE);
+    connect(ctrlb, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SingalR8Dec, CNN_TYPE);
 
 
     // -- ctrl12
-    connect(ctrlc, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalR9Load);
-    connect(ctrlc, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SingalR9Inc);
-    connect(ctrlc, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SingalR9Dec);
-    connect(ctrlc, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalR10Load);
-    connect(ctrlc, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SingalR10Inc);
-    connect(ctrlc, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SingalR10Dec);
-    connect(ctrlc, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalR11Load);
-    connect(ctrlc, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SingalR11Inc);
+    connect(ctrlc, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalR9Load, CNN_TYPE);
+    connect(ctrlc, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SingalR9Inc, CNN_TYPE);
+    connect(ctrlc, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SingalR9Dec, CNN_TYPE);
+    connect(ctrlc, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalR10Load, CNN_TYPE);
+    connect(ctrlc, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SingalR10Inc, CNN_TYPE);
+    connect(ctrlc, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SingalR10Dec, CNN_TYPE);
+    connect(ctrlc, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalR11Load, CNN_TYPE);
+    connect(ctrlc, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SingalR11Inc, CNN_TYPE);
 
 
     // -- ctrl13
-    connect(ctrld, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SingalR11Dec);
-    connect(ctrld, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalR12Load);
-    connect(ctrld, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SingalR12Inc);
-    connect(ctrld, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SingalR12Dec);
-    connect(ctrld, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalDev01Load);
-    connect(ctrld, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalCtl01Load);
-    connect(ctrld, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalDev02Load);
-    connect(ctrld, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalCtl02Load);
+    connect(ctrld, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SingalR11Dec, CNN_TYPE);
+    connect(ctrld, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalR12Load, CNN_TYPE);
+    connect(ctrld, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SingalR12Inc, CNN_TYPE);
+    connect(ctrld, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SingalR12Dec, CNN_TYPE);
+    connect(ctrld, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalDev01Load, CNN_TYPE);
+    connect(ctrld, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalCtl01Load, CNN_TYPE);
+    connect(ctrld, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalDev02Load, CNN_TYPE);
+    connect(ctrld, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalCtl02Load, CNN_TYPE);
 
 
     // -- ctrl14
-    connect(ctrle, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalDev03Load);
-    connect(ctrle, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalCtl03Load);
-    connect(ctrle, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalDev04Load);
-    connect(ctrle, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalCtl04Load);
-    connect(ctrle, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalDev05Load);
-    connect(ctrle, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalCtl05Load);
-    connect(ctrle, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalDev06Load);
-    connect(ctrle, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalCtl06Load);
+    connect(ctrle, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalDev03Load, CNN_TYPE);
+    connect(ctrle, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalCtl03Load, CNN_TYPE);
+    connect(ctrle, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalDev04Load, CNN_TYPE);
+    connect(ctrle, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalCtl04Load, CNN_TYPE);
+    connect(ctrle, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalDev05Load, CNN_TYPE);
+    connect(ctrle, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalCtl05Load, CNN_TYPE);
+    connect(ctrle, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalDev06Load, CNN_TYPE);
+    connect(ctrle, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalCtl06Load, CNN_TYPE);
 
 
     // -- ctrl15
-    connect(ctrlf, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalDev07Load);
-    connect(ctrlf, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalCtl07Load);
-    connect(ctrlf, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalDev08Load);
-    connect(ctrlf, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalCtl08Load);
-    connect(ctrlf, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalDev09Load);
-    connect(ctrlf, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalCtl09Load);
-    connect(ctrlf, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalDev10Load);
-    connect(ctrlf, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalCtl10Load);
-
-
-    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalCpuClockLatch, this, &ControlLogic_MidPlane_t::ProcessCpuClockLatch);
-    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalCpuClockOutput, this, &ControlLogic_MidPlane_t::ProcessCpuClockOutput);
+    connect(ctrlf, &CtrlRomModule_t::SignalBit7Updated, this, &ControlLogic_MidPlane_t::SignalDev07Load, CNN_TYPE);
+    connect(ctrlf, &CtrlRomModule_t::SignalBit6Updated, this, &ControlLogic_MidPlane_t::SignalCtl07Load, CNN_TYPE);
+    connect(ctrlf, &CtrlRomModule_t::SignalBit5Updated, this, &ControlLogic_MidPlane_t::SignalDev08Load, CNN_TYPE);
+    connect(ctrlf, &CtrlRomModule_t::SignalBit4Updated, this, &ControlLogic_MidPlane_t::SignalCtl08Load, CNN_TYPE);
+    connect(ctrlf, &CtrlRomModule_t::SignalBit3Updated, this, &ControlLogic_MidPlane_t::SignalDev09Load, CNN_TYPE);
+    connect(ctrlf, &CtrlRomModule_t::SignalBit2Updated, this, &ControlLogic_MidPlane_t::SignalCtl09Load, CNN_TYPE);
+    connect(ctrlf, &CtrlRomModule_t::SignalBit1Updated, this, &ControlLogic_MidPlane_t::SignalDev10Load, CNN_TYPE);
+    connect(ctrlf, &CtrlRomModule_t::SignalBit0Updated, this, &ControlLogic_MidPlane_t::SignalCtl10Load, CNN_TYPE);
+
+
+    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalCpuClockLatch, this, &ControlLogic_MidPlane_t::ProcessCpuClockLatch, CNN_TYPE);
+    connect(HW_Computer_t::GetClock(), &ClockModule_t::SignalCpuClockOutput, this, &ControlLogic_MidPlane_t::ProcessCpuClockOutput, CNN_TYPE);
 }
 
 
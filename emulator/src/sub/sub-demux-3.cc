@@ -45,14 +45,14 @@ void SubDemux3_t::WireUp(void)
     demux->ProcessUpdateG2A(LOW);
     demux->ProcessUpdateG2B(LOW);
 
-    connect(demux, &IC_74xx238_t::SignalY0Updated, this, &SubDemux3_t::SignalY0Updated);
-    connect(demux, &IC_74xx238_t::SignalY1Updated, this, &SubDemux3_t::SignalY1Updated);
-    connect(demux, &IC_74xx238_t::SignalY2Updated, this, &SubDemux3_t::SignalY2Updated);
-    connect(demux, &IC_74xx238_t::SignalY3Updated, this, &SubDemux3_t::SignalY3Updated);
-    connect(demux, &IC_74xx238_t::SignalY4Updated, this, &SubDemux3_t::SignalY4Updated);
-    connect(demux, &IC_74xx238_t::SignalY5Updated, this, &SubDemux3_t::SignalY5Updated);
-    connect(demux, &IC_74xx238_t::SignalY6Updated, this, &SubDemux3_t::SignalY6Updated);
-    connect(demux, &IC_74xx238_t::SignalY7Updated, this, &SubDemux3_t::SignalY7Updated);
+    connect(demux, &IC_74xx238_t::SignalY0Updated, this, &SubDemux3_t::SignalY0Updated, CNN_TYPE);
+    connect(demux, &IC_74xx238_t::SignalY1Updated, this, &SubDemux3_t::SignalY1Updated, CNN_TYPE);
+    connect(demux, &IC_74xx238_t::SignalY2Updated, this, &SubDemux3_t::SignalY2Updated, CNN_TYPE);
+    connect(demux, &IC_74xx238_t::SignalY3Updated, this, &SubDemux3_t::SignalY3Updated, CNN_TYPE);
+    connect(demux, &IC_74xx238_t::SignalY4Updated, this, &SubDemux3_t::SignalY4Updated, CNN_TYPE);
+    connect(demux, &IC_74xx238_t::SignalY5Updated, this, &SubDemux3_t::SignalY5Updated, CNN_TYPE);
+    connect(demux, &IC_74xx238_t::SignalY6Updated, this, &SubDemux3_t::SignalY6Updated, CNN_TYPE);
+    connect(demux, &IC_74xx238_t::SignalY7Updated, this, &SubDemux3_t::SignalY7Updated, CNN_TYPE);
 }
 
 
@@ -21,6 +21,7 @@ SubDemux4_t::SubDemux4_t(void) : QObject()
 {
     AllocateComponents();
     WireUp();
+    netlist->Levelize();
     TriggerFirstUpdate();
 }
 
@@ -33,6 +34,8 @@ void SubDemux4_t::AllocateComponents(void)
 {
     demuxLo = new IC_74xx238_t;
     demuxHi = new IC_74xx238_t;
+
+    netlist = new HW_Netlist_t("Demux4", this);
 }
 
 
@@ -47,23 +50,37 @@ void SubDemux4_t::WireUp(void)
     demuxHi->ProcessUpdateG2A(LOW);
     demuxHi->ProcessUpdateG2B(LOW);
 
-    connect(demuxLo, &IC_74xx238_t::SignalY0Updated, this, &SubDemux4_t::SignalY0Updated);
-    connect(demuxLo, &IC_74xx238_t::SignalY1Updated, this, &SubDemux4_t::SignalY1Updated);
-    connect(demuxLo, &IC_74xx238_t::SignalY2Updated, this, &SubDemux4_t::SignalY2Updated);
-    connect(demuxLo, &IC_74xx238_t::SignalY3Updated, this, &SubDemux4_t::SignalY3Updated);
-    connect(demuxLo, &IC_74xx238_t::SignalY4Updated, this, &SubDemux4_t::SignalY4Updated);
-    connect(demuxLo, &IC_74xx238_t::SignalY5Updated, this, &SubDemux4_t::SignalY5Updated);
-    connect(demuxLo, &IC_74xx238_t::SignalY6Updated, this, &SubDemux4_t::SignalY6Updated);
-    connect(demuxLo, &IC_74xx238_t::SignalY7Updated, this, &SubDemux4_t::SignalY7Updated);
-
-    connect(demuxHi, &IC_74xx238_t::SignalY0Updated, this, &SubDemux4_t::SignalY0Updated);
-    connect(demuxHi, &IC_74xx238_t::SignalY1Updated, this, &SubDemux4_t::SignalY1Updated);
-    connect(demuxHi, &IC_74xx238_t::SignalY2Updated, this, &SubDemux4_t::SignalY2Updated);
-    connect(demuxHi, &IC_74xx238_t::SignalY3Updated, this, &SubDemux4_t::SignalY3Updated);
-    connect(demuxHi, &IC_74xx238_t::SignalY4Updated, this, &SubDemux4_t::SignalY4Updated);
-    connect(demuxHi, &IC_74xx238_t::SignalY5Updated, this, &SubDemux4_t::SignalY5Updated);
-    connect(demuxHi, &IC_74xx238_t::SignalY6Updated, this, &SubDemux4_t::SignalY6Updated);
-    connect(demuxHi, &IC_74xx238_t::SignalY7Updated, this, &SubDemux4_t::SignalY7Updated);
+    netA = netlist->NewNet(LOW);
+    netB = netlist->NewNet(LOW);
+    netC = netlist->NewNet(LOW);
+    netD = netlist->NewNet(LOW);
+
+    demuxLo->BindInput(netlist, IC_74xx238_t::A, netA);
+    demuxLo->BindInput(netlist, IC_74xx238_t::B, netB);
+    demuxLo->BindInput(netlist, IC_74xx238_t::C, netC);
+    demuxLo->BindInput(netlist, IC_74xx238_t::G2Ab, netD);
+    demuxHi->BindInput(netlist, IC_74xx238_t::A, netA);
+    demuxHi->BindInput(netlist, IC_74xx238_t::B, netB);
+    demuxHi->BindInput(netlist, IC_74xx238_t::C, netC);
+    demuxHi->BindInput(netlist, IC_74xx238_t::G1, netD);
+
+    connect(demuxLo, &IC_74xx238_t::SignalY0Updated, this, &SubDemux4_t::SignalY0Updated, CNN_TYPE);
+    connect(demuxLo, &IC_74xx238_t::SignalY1Updated, this, &SubDemux4_t::SignalY1Updated, CNN_TYPE);
+    connect(demuxLo, &IC_74xx238_t::SignalY2Updated, this, &SubDemux4_t::SignalY2Updated, CNN_TYPE);
+    connect(demuxLo, &IC_74xx238_t::SignalY3Updated, this, &SubDemux4_t::SignalY3Updated, CNN_TYPE);
+    connect(demuxLo, &IC_74xx238_t::SignalY4Updated, this, &SubDemux4_t::SignalY4Updated, CNN_TYPE);
+    connect(demuxLo, &IC_74xx238_t::SignalY5Updated, this, &SubDemux4_t::SignalY5Updated, CNN_TYPE);
+    connect(demuxLo, &IC_74xx238_t::SignalY6Updated, this, &SubDemux4_t::SignalY6Updated, CNN_TYPE);
+    connect(demuxLo, &IC_74xx238_t::SignalY7Updated, this, &SubDemux4_t::SignalY7Updated, CNN_TYPE);
+
+    connect(demuxHi, &IC_74xx238_t::SignalY0Updated, this, &SubDemux4_t::SignalY0Updated, CNN_TYPE);
+    connect(demuxHi, &IC_74xx238_t::SignalY1Updated, this, &SubDemux4_t::SignalY1Updated, CNN_TYPE);
+    connect(demuxHi, &IC_74xx238_t::SignalY2Updated, this, &SubDemux4_t::SignalY2Updated, CNN_TYPE);
+    connect(demuxHi, &IC_74xx238_t::SignalY3Updated, this, &SubDemux4_t::SignalY3Updated, CNN_TYPE);
+    connect(demuxHi, &IC_74xx238_t::SignalY4Updated, this, &SubDemux4_t::SignalY4Updated, CNN_TYPE);
+    connect(demuxHi, &IC_74xx238_t::SignalY5Updated, this, &SubDemux4_t::SignalY5Updated, CNN_TYPE);
+    connect(demuxHi, &IC_74xx238_t::SignalY6Updated, this, &SubDemux4_t::SignalY6Updated, CNN_TYPE);
+    connect(demuxHi, &IC_74xx238_t::SignalY7Updated, this, &SubDemux4_t::SignalY7Updated, CNN_TYPE);
 }
 
 
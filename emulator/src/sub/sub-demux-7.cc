@@ -21,6 +21,7 @@ SubDemux7_t::SubDemux7_t(void) : QObject()
 {
     AllocateComponents();
     WireUp();
+    netlist->Levelize();
     TriggerFirstUpdate();
 }
 
@@ -50,6 +51,14 @@ void SubDemux7_t::AllocateComponents(void)
     demux15 = new IC_74xx238_t;
     demux16 = new IC_74xx238_t;
     demux17 = new IC_74xx238_t;
+
+    // -- the second level, in output order
+    second[0] = demux00;  second[1] = demux01;  second[2] = demux02;  second[3] = demux03;
+    second[4] = demux04;  second[5] = demux05;  second[6] = demux06;  second[7] = demux07;
+    second[8] = demux10;  second[9] = demux11;  second[10] = demux12; second[11] = demux13;
+    second[12] = demux14; second[13] = demux15; second[14] = demux16; second[15] = demux17;
+
+    netlist = new HW_Netlist_t("Demux7", this);
 }
 
 
@@ -98,241 +107,184 @@ void SubDemux7_t::WireUp(void)
     demux17->ProcessUpdateG2B(LOW);
     demux17->ProcessUpdateG1(HIGH);
 
-    connect(demuxLo, &IC_74xx138_t::SignalY0Updated, demux00, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxLo, &IC_74xx138_t::SignalY1Updated, demux01, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxLo, &IC_74xx138_t::SignalY2Updated, demux02, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxLo, &IC_74xx138_t::SignalY3Updated, demux03, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxLo, &IC_74xx138_t::SignalY4Updated, demux04, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxLo, &IC_74xx138_t::SignalY5Updated, demux05, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxLo, &IC_74xx138_t::SignalY6Updated, demux06, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxLo, &IC_74xx138_t::SignalY7Updated, demux07, &IC_74xx238_t::ProcessUpdateG2A);
-
-    connect(demuxHi, &IC_74xx138_t::SignalY0Updated, demux10, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxHi, &IC_74xx138_t::SignalY1Updated, demux11, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxHi, &IC_74xx138_t::SignalY2Updated, demux12, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxHi, &IC_74xx138_t::SignalY3Updated, demux13, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxHi, &IC_74xx138_t::SignalY4Updated, demux14, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxHi, &IC_74xx138_t::SignalY5Updated, demux15, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxHi, &IC_74xx138_t::SignalY6Updated, demux16, &IC_74xx238_t::ProcessUpdateG2A);
-    connect(demuxHi, &IC_74xx138_t::SignalY7Updated, demux17, &IC_74xx238_t::ProcessUpdateG2A);
-
-    connect(demux00, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY000Updated);
-    connect(demux00, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY001Updated);
-    connect(demux00, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY002Updated);
-    connect(demux00, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY003Updated);
-    connect(demux00, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY004Updated);
-    connect(demux00, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY005Updated);
-    connect(demux00, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY006Updated);
-    connect(demux00, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY007Updated);
-
-    connect(demux01, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY010Updated);
-    connect(demux01, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY011Updated);
-    connect(demux01, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY012Updated);
-    connect(demux01, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY013Updated);
-    connect(demux01, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY014Updated);
-    connect(demux01, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY015Updated);
-    connect(demux01, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY016Updated);
-    connect(demux01, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY017Updated);
-
-    connect(demux02, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY020Updated);
-    connect(demux02, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY021Updated);
-    connect(demux02, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY022Updated);
-    connect(demux02, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY023Updated);
-    connect(demux02, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY024Updated);
-    connect(demux02, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY025Updated);
-    connect(demux02, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY026Updated);
-    connect(demux02, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY027Updated);
-
-    connect(demux03, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY030Updated);
-    connect(demux03, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY031Updated);
-    connect(demux03, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY032Updated);
-    connect(demux03, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY033Updated);
-    connect(demux03, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY034Updated);
-    connect(demux03, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY035Updated);
-    connect(demux03, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY036Updated);
-    connect(demux03, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY037Updated);
-
-    connect(demux04, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY040Updated);
-    connect(demux04, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY041Updated);
-    connect(demux04, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY042Updated);
-    connect(demux04, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY043Updated);
-    connect(demux04, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY044Updated);
-    connect(demux04, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY045Updated);
-    connect(demux04, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY046Updated);
-    connect(demux04, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY047Updated);
-
-    connect(demux05, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY050Updated);
-    connect(demux05, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY051Updated);
-    connect(demux05, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY052Updated);
-    connect(demux05, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY053Updated);
-    connect(demux05, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY054Updated);
-    connect(demux05, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY055Updated);
-    connect(demux05, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY056Updated);
-    connect(demux05, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY057Updated);
-
-    connect(demux06, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY060Updated);
-    connect(demux06, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY061Updated);
-    connect(demux06, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY062Updated);
-    connect(demux06, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY063Updated);
-    connect(demux06, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY064Updated);
-    connect(demux06, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY065Updated);
-    connect(demux06, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY066Updated);
-    connect(demux06, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY067Updated);
-
-    connect(demux07, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY070Updated);
-    connect(demux07, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY071Updated);
-    connect(demux07, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY072Updated);
-    connect(demux07, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY073Updated);
-    connect(demux07, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY074Updated);
-    connect(demux07, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY075Updated);
-    connect(demux07, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY076Updated);
-    connect(demux07, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY077Updated);
-
-    connect(demux10, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY100Updated);
-    connect(demux10, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY101Updated);
-    connect(demux10, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY102Updated);
-    connect(demux10, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY103Updated);
-    connect(demux10, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY104Updated);
-    connect(demux10, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY105Updated);
-    connect(demux10, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY106Updated);
-    connect(demux10, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY107Updated);
-
-    connect(demux11, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY110Updated);
-    connect(demux11, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY111Updated);
-    connect(demux11, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY112Updated);
-    connect(demux11, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY113Updated);
-    connect(demux11, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY114Updated);
-    connect(demux11, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY115Updated);
-    connect(demux11, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY116Updated);
-    connect(demux11, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY117Updated);
-
-    connect(demux12, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY120Updated);
-    connect(demux12, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY121Updated);
-    connect(demux12, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY122Updated);
-    connect(demux12, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY123Updated);
-    connect(demux12, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY124Updated);
-    connect(demux12, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY125Updated);
-    connect(demux12, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY126Updated);
-    connect(demux12, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY127Updated);
-
-    connect(demux13, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY130Updated);
-    connect(demux13, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY131Updated);
-    connect(demux13, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY132Updated);
-    connect(demux13, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY133Updated);
-    connect(demux13, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY134Updated);
-    connect(demux13, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY135Updated);
-    connect(demux13, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY136Updated);
-    connect(demux13, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY137Updated);
-
-    connect(demux14, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY140Updated);
-    connect(demux14, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY141Updated);
-    connect(demux14, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY142Updated);
-    connect(demux14, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY143Updated);
-    connect(demux14, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY144Updated);
-    connect(demux14, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY145Updated);
-    connect(demux14, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY146Updated);
-    connect(demux14, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY147Updated);
-
-    connect(demux15, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY150Updated);
-    connect(demux15, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY151Updated);
-    connect(demux15, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY152Updated);
-    connect(demux15, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY153Updated);
-    connect(demux15, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY154Updated);
-    connect(demux15, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY155Updated);
-    connect(demux15, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY156Updated);
-    connect(demux15, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY157Updated);
-
-    connect(demux16, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY160Updated);
-    connect(demux16, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY161Updated);
-    connect(demux16, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY162Updated);
-    connect(demux16, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY163Updated);
-    connect(demux16, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY164Updated);
-    connect(demux16, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY165Updated);
-    connect(demux16, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY166Updated);
-    connect(demux16, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY167Updated);
-
-    connect(demux17, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY170Updated);
-    connect(demux17, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY171Updated);
-    connect(demux17, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY172Updated);
-    connect(demux17, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY173Updated);
-    connect(demux17, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY174Updated);
-    connect(demux17, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY175Updated);
-    connect(demux17, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY176Updated);
-    connect(demux17, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY177Updated);
-}
-
-
-//
-// -- Process Updated to bit A
-//    ------------------------
-void SubDemux7_t::ProcessUpdateA(TriState_t state)
-{
-    demux00->ProcessUpdateA(state);
-    demux01->ProcessUpdateA(state);
-    demux02->ProcessUpdateA(state);
-    demux03->ProcessUpdateA(state);
-    demux04->ProcessUpdateA(state);
-    demux05->ProcessUpdateA(state);
-    demux06->ProcessUpdateA(state);
-    demux07->ProcessUpdateA(state);
-    demux10->ProcessUpdateA(state);
-    demux11->ProcessUpdateA(state);
-    demux12->ProcessUpdateA(state);
-    demux13->ProcessUpdateA(state);
-    demux14->ProcessUpdateA(state);
-    demux15->ProcessUpdateA(state);
-    demux16->ProcessUpdateA(state);
-    demux17->ProcessUpdateA(state);
-}
-
-
-
-//
-// -- Process Updated to bit B
-//    ------------------------
-void SubDemux7_t::ProcessUpdateB(TriState_t state)
-{
-    demux00->ProcessUpdateB(state);
-    demux01->ProcessUpdateB(state);
-    demux02->ProcessUpdateB(state);
-    demux03->ProcessUpdateB(state);
-    demux04->ProcessUpdateB(state);
-    demux05->ProcessUpdateB(state);
-    demux06->ProcessUpdateB(state);
-    demux07->ProcessUpdateB(state);
-    demux10->ProcessUpdateB(state);
-    demux11->ProcessUpdateB(state);
-    demux12->ProcessUpdateB(state);
-    demux13->ProcessUpdateB(state);
-    demux14->ProcessUpdateB(state);
-    demux15->ProcessUpdateB(state);
-    demux16->ProcessUpdateB(state);
-    demux17->ProcessUpdateB(state);
-}
-
-
-
-//
-// -- Process Updated to bit C
-//    ------------------------
-void SubDemux7_t::ProcessUpdateC(TriState_t state)
-{
-    demux00->ProcessUpdateC(state);
-    demux01->ProcessUpdateC(state);
-    demux02->ProcessUpdateC(state);
-    demux03->ProcessUpdateC(state);
-    demux04->ProcessUpdateC(state);
-    demux05->ProcessUpdateC(state);
-    demux06->ProcessUpdateC(state);
-    demux07->ProcessUpdateC(state);
-    demux10->ProcessUpdateC(state);
-    demux11->ProcessUpdateC(state);
-    demux12->ProcessUpdateC(state);
-    demux13->ProcessUpdateC(state);
-    demux14->ProcessUpdateC(state);
-    demux15->ProcessUpdateC(state);
-    demux16->ProcessUpdateC(state);
-    demux17->ProcessUpdateC(state);
+    // -- the select lines fan out to all the demultiplexers through the netlist
+    netA = netlist->NewNet(LOW);
+    netB = netlist->NewNet(LOW);
+    netC = netlist->NewNet(LOW);
+    netD = netlist->NewNet(LOW);
+    netE = netlist->NewNet(LOW);
+    netF = netlist->NewNet(LOW);
+    netG = netlist->NewNet(LOW);
+
+    demuxLo->BindInput(netlist, IC_74xx138_t::A, netD);
+    demuxLo->BindInput(netlist, IC_74xx138_t::B, netE);
+    demuxLo->BindInput(netlist, IC_74xx138_t::C, netF);
+    demuxLo->BindInput(netlist, IC_74xx138_t::G2Ab, netG);
+    demuxHi->BindInput(netlist, IC_74xx138_t::A, netD);
+    demuxHi->BindInput(netlist, IC_74xx138_t::B, netE);
+    demuxHi->BindInput(netlist, IC_74xx138_t::C, netF);
+    demuxHi->BindInput(netlist, IC_74xx138_t::G1, netG);
+
+    // -- each output of the first level enables one of the second level demultiplexers
+    const int first[8] = {
+        IC_74xx138_t::Y0, IC_74xx138_t::Y1, IC_74xx138_t::Y2, IC_74xx138_t::Y3,
+        IC_74xx138_t::Y4, IC_74xx138_t::Y5, IC_74xx138_t::Y6, IC_74xx138_t::Y7,
+    };
+
+    for (int i = 0; i < 16; i ++) {
+        HW_Netlist_t::Net_t enable = netlist->NewNet(HIGH);
+
+        (i < 8 ? demuxLo : demuxHi)->BindOutput(netlist, first[i % 8], enable);
+
+        second[i]->BindInput(netlist, IC_74xx238_t::A, netA);
+        second[i]->BindInput(netlist, IC_74xx238_t::B, netB);
+        second[i]->BindInput(netlist, IC_74xx238_t::C, netC);
+        second[i]->BindInput(netlist, IC_74xx238_t::G2Ab, enable);
+    }
+
+    connect(demux00, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY000Updated, CNN_TYPE);
+    connect(demux00, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY001Updated, CNN_TYPE);
+    connect(demux00, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY002Updated, CNN_TYPE);
+    connect(demux00, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY003Updated, CNN_TYPE);
+    connect(demux00, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY004Updated, CNN_TYPE);
+    connect(demux00, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY005Updated, CNN_TYPE);
+    connect(demux00, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY006Updated, CNN_TYPE);
+    connect(demux00, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY007Updated, CNN_TYPE);
+
+    connect(demux01, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY010Updated, CNN_TYPE);
+    connect(demux01, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY011Updated, CNN_TYPE);
+    connect(demux01, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY012Updated, CNN_TYPE);
+    connect(demux01, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY013Updated, CNN_TYPE);
+    connect(demux01, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY014Updated, CNN_TYPE);
+    connect(demux01, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY015Updated, CNN_TYPE);
+    connect(demux01, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY016Updated, CNN_TYPE);
+    connect(demux01, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY017Updated, CNN_TYPE);
+
+    connect(demux02, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY020Updated, CNN_TYPE);
+    connect(demux02, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY021Updated, CNN_TYPE);
+    connect(demux02, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY022Updated, CNN_TYPE);
+    connect(demux02, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY023Updated, CNN_TYPE);
+    connect(demux02, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY024Updated, CNN_TYPE);
+    connect(demux02, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY025Updated, CNN_TYPE);
+    connect(demux02, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY026Updated, CNN_TYPE);
+    connect(demux02, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY027Updated, CNN_TYPE);
+
+    connect(demux03, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY030Updated, CNN_TYPE);
+    connect(demux03, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY031Updated, CNN_TYPE);
+    connect(demux03, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY032Updated, CNN_TYPE);
+    connect(demux03, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY033Updated, CNN_TYPE);
+    connect(demux03, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY034Updated, CNN_TYPE);
+    connect(demux03, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY035Updated, CNN_TYPE);
+    connect(demux03, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY036Updated, CNN_TYPE);
+    connect(demux03, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY037Updated, CNN_TYPE);
+
+    connect(demux04, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY040Updated, CNN_TYPE);
+    connect(demux04, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY041Updated, CNN_TYPE);
+    connect(demux04, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY042Updated, CNN_TYPE);
+    connect(demux04, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY043Updated, CNN_TYPE);
+    connect(demux04, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY044Updated, CNN_TYPE);
+    connect(demux04, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY045Updated, CNN_TYPE);
+    connect(demux04, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY046Updated, CNN_TYPE);
+    connect(demux04, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY047Updated, CNN_TYPE);
+
+    connect(demux05, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY050Updated, CNN_TYPE);
+    connect(demux05, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY051Updated, CNN_TYPE);
+    connect(demux05, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY052Updated, CNN_TYPE);
+    connect(demux05, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY053Updated, CNN_TYPE);
+    connect(demux05, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY054Updated, CNN_TYPE);
+    connect(demux05, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY055Updated, CNN_TYPE);
+    connect(demux05, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY056Updated, CNN_TYPE);
+    connect(demux05, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY057Updated, CNN_TYPE);
+
+    connect(demux06, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY060Updated, CNN_TYPE);
+    connect(demux06, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY061Updated, CNN_TYPE);
+    connect(demux06, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY062Updated, CNN_TYPE);
+    connect(demux06, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY063Updated, CNN_TYPE);
+    connect(demux06, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY064Updated, CNN_TYPE);
+    connect(demux06, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY065Updated, CNN_TYPE);
+    connect(demux06, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY066Updated, CNN_TYPE);
+    connect(demux06, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY067Updated, CNN_TYPE);
+
+    connect(demux07, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY070Updated, CNN_TYPE);
+    connect(demux07, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY071Updated, CNN_TYPE);
+    connect(demux07, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY072Updated, CNN_TYPE);
+    connect(demux07, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY073Updated, CNN_TYPE);
+    connect(demux07, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY074Updated, CNN_TYPE);
+    connect(demux07, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY075Updated, CNN_TYPE);
+    connect(demux07, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY076Updated, CNN_TYPE);
+    connect(demux07, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY077Updated, CNN_TYPE);
+
+    connect(demux10, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY100Updated, CNN_TYPE);
+    connect(demux10, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY101Updated, CNN_TYPE);
+    connect(demux10, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY102Updated, CNN_TYPE);
+    connect(demux10, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY103Updated, CNN_TYPE);
+    connect(demux10, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY104Updated, CNN_TYPE);
+    connect(demux10, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY105Updated, CNN_TYPE);
+    connect(demux10, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY106Updated, CNN_TYPE);
+    connect(demux10, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY107Updated, CNN_TYPE);
+
+    connect(demux11, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY110Updated, CNN_TYPE);
+    connect(demux11, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY111Updated, CNN_TYPE);
+    connect(demux11, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY112Updated, CNN_TYPE);
+    connect(demux11, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY113Updated, CNN_TYPE);
+    connect(demux11, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY114Updated, CNN_TYPE);
+    connect(demux11, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY115Updated, CNN_TYPE);
+    connect(demux11, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY116Updated, CNN_TYPE);
+    connect(demux11, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY117Updated, CNN_TYPE);
+
+    connect(demux12, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY120Updated, CNN_TYPE);
+    connect(demux12, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY121Updated, CNN_TYPE);
+    connect(demux12, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY122Updated, CNN_TYPE);
+    connect(demux12, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY123Updated, CNN_TYPE);
+    connect(demux12, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY124Updated, CNN_TYPE);
+    connect(demux12, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY125Updated, CNN_TYPE);
+    connect(demux12, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY126Updated, CNN_TYPE);
+    connect(demux12, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY127Updated, CNN_TYPE);
+
+    connect(demux13, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY130Updated, CNN_TYPE);
+    connect(demux13, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY131Updated, CNN_TYPE);
+    connect(demux13, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY132Updated, CNN_TYPE);
+    connect(demux13, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY133Updated, CNN_TYPE);
+    connect(demux13, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY134Updated, CNN_TYPE);
+    connect(demux13, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY135Updated, CNN_TYPE);
+    connect(demux13, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY136Updated, CNN_TYPE);
+    connect(demux13, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY137Updated, CNN_TYPE);
+
+    connect(demux14, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY140Updated, CNN_TYPE);
+    connect(demux14, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY141Updated, CNN_TYPE);
+    connect(demux14, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY142Updated, CNN_TYPE);
+    connect(demux14, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY143Updated, CNN_TYPE);
+    connect(demux14, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY144Updated, CNN_TYPE);
+    connect(demux14, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY145Updated, CNN_TYPE);
+    connect(demux14, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY146Updated, CNN_TYPE);
+    connect(demux14, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY147Updated, CNN_TYPE);
+
+    connect(demux15, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY150Updated, CNN_TYPE);
+    connect(demux15, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY151Updated, CNN_TYPE);
+    connect(demux15, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY152Updated, CNN_TYPE);
+    connect(demux15, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY153Updated, CNN_TYPE);
+    connect(demux15, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY154Updated, CNN_TYPE);
+    connect(demux15, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY155Updated, CNN_TYPE);
+    connect(demux15, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY156Updated, CNN_TYPE);
+    connect(demux15, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY157Updated, CNN_TYPE);
+
+    connect(demux16, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY160Updated, CNN_TYPE);
+    connect(demux16, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY161Updated, CNN_TYPE);
+    connect(demux16, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY162Updated, CNN_TYPE);
+    connect(demux16, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY163Updated, CNN_TYPE);
+    connect(demux16, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY164Updated, CNN_TYPE);
+    connect(demux16, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY165Updated, CNN_TYPE);
+    connect(demux16, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY166Updated, CNN_TYPE);
+    connect(demux16, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY167Updated, CNN_TYPE);
+
+    connect(demux17, &IC_74xx238_t::SignalY0Updated, this, &SubDemux7_t::SignalY170Updated, CNN_TYPE);
+    connect(demux17, &IC_74xx238_t::SignalY1Updated, this, &SubDemux7_t::SignalY171Updated, CNN_TYPE);
+    connect(demux17, &IC_74xx238_t::SignalY2Updated, this, &SubDemux7_t::SignalY172Updated, CNN_TYPE);
+    connect(demux17, &IC_74xx238_t::SignalY3Updated, this, &SubDemux7_t::SignalY173Updated, CNN_TYPE);
+    connect(demux17, &IC_74xx238_t::SignalY4Updated, this, &SubDemux7_t::SignalY174Updated, CNN_TYPE);
+    connect(demux17, &IC_74xx238_t::SignalY5Updated, this, &SubDemux7_t::SignalY175Updated, CNN_TYPE);
+    connect(demux17, &IC_74xx238_t::SignalY6Updated, this, &SubDemux7_t::SignalY176Updated, CNN_TYPE);
+    connect(demux17, &IC_74xx238_t::SignalY7Updated, this, &SubDemux7_t::SignalY177Updated, CNN_TYPE);
 }
 
 
@@ -364,3 +316,29 @@ void SubDemux7_t::TriggerFirstUpdate(void)
 
 
 
+//
+// -- Decode 64 independent inputs at once, one per lane
+//    --------------------------------------------------
+void SubDemux7_t::DecodeLanes(const uint64_t sel[7], uint64_t out[128])
+{
+    const int y[8] = {
+        IC_74xx238_t::Y0, IC_74xx238_t::Y1, IC_74xx238_t::Y2, IC_74xx238_t::Y3,
+        IC_74xx238_t::Y4, IC_74xx238_t::Y5, IC_74xx238_t::Y6, IC_74xx238_t::Y7,
+    };
+
+    netlist->SetLanes(netA, sel[0]);
+    netlist->SetLanes(netB, sel[1]);
+    netlist->SetLanes(netC, sel[2]);
+    netlist->SetLanes(netD, sel[3]);
+    netlist->SetLanes(netE, sel[4]);
+    netlist->SetLanes(netF, sel[5]);
+    netlist->SetLanes(netG, sel[6]);
+
+    netlist->SettleLanes();
+
+    for (int i = 0; i < 16; i ++) {
+        for (int j = 0; j < 8; j ++) out[i * 8 + j] = second[i]->GetLanes(y[j]);
+    }
+}
+
+